@@ -0,0 +1,161 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Units.hpp"
+#include "cece/core/UnitIo.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/Parameters.hpp"
+#include "cece/config/Configuration.hpp"
+#include "cece/config/MemoryImplementation.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Create configuration with a few values the way simulation loaders
+ * store them.
+ *
+ * @param parameters
+ *
+ * @return
+ */
+config::Configuration makeConfiguration(ViewPtr<Parameters> parameters = nullptr)
+{
+    config::Configuration config(makeUnique<config::MemoryImplementation>(), parameters);
+    config.set("name", "diffusion");
+    config.set("iterations", "1000");
+    config.set("coefficient", "0.5");
+    config.set("dt", "10ms");
+    config.set("size", "400um 200um");
+    config.set("rate", "{$rate}");
+
+    return config;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void Configuration_getString(benchmark::State& state)
+{
+    const auto config = makeConfiguration();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(config.get("name"));
+}
+
+BENCHMARK(Configuration_getString);
+
+/* ************************************************************************ */
+
+static void Configuration_getInt(benchmark::State& state)
+{
+    const auto config = makeConfiguration();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(config.get<int>("iterations"));
+}
+
+BENCHMARK(Configuration_getInt);
+
+/* ************************************************************************ */
+
+static void Configuration_getReal(benchmark::State& state)
+{
+    const auto config = makeConfiguration();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(config.get<RealType>("coefficient"));
+}
+
+BENCHMARK(Configuration_getReal);
+
+/* ************************************************************************ */
+
+static void Configuration_getUnit(benchmark::State& state)
+{
+    const auto config = makeConfiguration();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(config.get<units::Time>("dt"));
+}
+
+BENCHMARK(Configuration_getUnit);
+
+/* ************************************************************************ */
+
+static void Configuration_getVector(benchmark::State& state)
+{
+    const auto config = makeConfiguration();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(config.get<units::SizeVector>("size"));
+}
+
+BENCHMARK(Configuration_getVector);
+
+/* ************************************************************************ */
+
+static void Configuration_getParameter(benchmark::State& state)
+{
+    Parameters parameters;
+    parameters.set("rate", "0.25");
+
+    const auto config = makeConfiguration(&parameters);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(config.get<RealType>("rate"));
+}
+
+BENCHMARK(Configuration_getParameter);
+
+/* ************************************************************************ */
+
+static void Configuration_getDefault(benchmark::State& state)
+{
+    const auto config = makeConfiguration();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(config.get<RealType>("missing", 1.0));
+}
+
+BENCHMARK(Configuration_getDefault);
+
+/* ************************************************************************ */
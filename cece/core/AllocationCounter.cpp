@@ -0,0 +1,179 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/AllocationCounter.hpp"
+
+#ifdef CECE_ALLOCATION_COUNTING
+// C++
+#include <cstdlib>
+#include <new>
+#endif
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+#ifdef CECE_ALLOCATION_COUNTING
+namespace {
+
+/* ************************************************************************ */
+
+/// Number of allocations made by current thread.
+thread_local std::uint64_t t_allocations = 0;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Allocate memory and count the allocation.
+ *
+ * @param size
+ *
+ * @return
+ */
+void* allocate(std::size_t size) noexcept
+{
+    ++t_allocations;
+    return std::malloc(size ? size : 1);
+}
+
+/* ************************************************************************ */
+
+}
+#endif
+
+/* ************************************************************************ */
+
+bool isAllocationCountingEnabled() noexcept
+{
+#ifdef CECE_ALLOCATION_COUNTING
+    return true;
+#else
+    return false;
+#endif
+}
+
+/* ************************************************************************ */
+
+std::uint64_t getAllocationCount() noexcept
+{
+#ifdef CECE_ALLOCATION_COUNTING
+    return t_allocations;
+#else
+    return 0;
+#endif
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
+
+#ifdef CECE_ALLOCATION_COUNTING
+
+void* operator new(std::size_t size)
+{
+    if (void* ptr = cece::allocate(size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+/* ************************************************************************ */
+
+void* operator new[](std::size_t size)
+{
+    if (void* ptr = cece::allocate(size))
+        return ptr;
+
+    throw std::bad_alloc();
+}
+
+/* ************************************************************************ */
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return cece::allocate(size);
+}
+
+/* ************************************************************************ */
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return cece::allocate(size);
+}
+
+/* ************************************************************************ */
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+/* ************************************************************************ */
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+/* ************************************************************************ */
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+/* ************************************************************************ */
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+/* ************************************************************************ */
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/* ************************************************************************ */
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif
+
+#endif
+
+/* ************************************************************************ */
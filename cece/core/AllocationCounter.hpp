@@ -0,0 +1,64 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstdint>
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns if memory allocations are counted.
+ *
+ * Counting requires library built with CECE_ALLOCATION_COUNTING option which
+ * replaces global operator new.
+ *
+ * @return
+ */
+bool isAllocationCountingEnabled() noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns number of memory allocations made by current thread.
+ *
+ * @return Number of allocations or zero if counting is disabled.
+ */
+std::uint64_t getAllocationCount() noexcept;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
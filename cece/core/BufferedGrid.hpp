@@ -0,0 +1,321 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// CeCe
+#include "cece/core/Assert.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/SharedPtr.hpp"
+#include "cece/core/StaticArray.hpp"
+#include "cece/core/Grid.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid with N buffers rotated in O(1).
+ *
+ * Buffer 0 is the front (current state), buffer 1 is the back (next state)
+ * and higher buffers hold older states, buffer N - 1 is the previous state.
+ * swap() makes the back buffer the front one without copying any data.
+ *
+ * snapshot() returns shared read-only front which can be read by other
+ * threads (e.g. render state capture) while solver writes next steps. When
+ * a buffer which is still referenced by a snapshot becomes the back buffer,
+ * swap() replaces it with a new allocation, so snapshots don't change as
+ * long as only the back buffer is written. snapshot() and swap() must be
+ * called from the owning thread.
+ *
+ * @tparam T      Element type.
+ * @tparam N      Number of buffers (at least 2).
+ * @tparam Alloc  Allocator type.
+ * @tparam Layout Storage layout.
+ */
+template<typename T, unsigned int N = 2, typename Alloc = AlignedAllocator<T>, typename Layout = GridLayoutRowMajor>
+class BufferedGrid
+{
+    static_assert(N >= 2, "At least two buffers are required");
+
+// Public Types
+public:
+
+
+    /**
+     * @brief Buffer grid type.
+     */
+    using GridType = Grid<T, Alloc, Layout>;
+
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = typename GridType::SizeType;
+
+
+    /**
+     * @brief Coordinates type.
+     */
+    using CoordinateType = typename GridType::CoordinateType;
+
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Default constructor.
+     */
+    BufferedGrid()
+    {
+        for (auto& buffer : m_buffers)
+            buffer = makeShared<GridType>();
+    }
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param size Grid size.
+     */
+    explicit BufferedGrid(CoordinateType size)
+        : BufferedGrid()
+    {
+        resize(std::move(size));
+    }
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns number of buffers.
+     *
+     * @return
+     */
+    static constexpr unsigned int getBufferCount() noexcept
+    {
+        return N;
+    }
+
+
+    /**
+     * @brief Returns grid size.
+     *
+     * @return
+     */
+    const CoordinateType& getSize() const noexcept
+    {
+        return getFront().getSize();
+    }
+
+
+    /**
+     * @brief Returns buffer.
+     *
+     * @param index Buffer index, 0 is front and 1 is back.
+     *
+     * @return
+     */
+    GridType& getBuffer(unsigned int index) noexcept
+    {
+        CECE_ASSERT(index < N);
+        return *m_buffers[(m_front + index) % N];
+    }
+
+
+    /**
+     * @brief Returns buffer.
+     *
+     * @param index Buffer index, 0 is front and 1 is back.
+     *
+     * @return
+     */
+    const GridType& getBuffer(unsigned int index) const noexcept
+    {
+        CECE_ASSERT(index < N);
+        return *m_buffers[(m_front + index) % N];
+    }
+
+
+    /**
+     * @brief Returns front buffer (current state).
+     *
+     * @return
+     */
+    GridType& getFront() noexcept
+    {
+        return getBuffer(0);
+    }
+
+
+    /**
+     * @brief Returns front buffer (current state).
+     *
+     * @return
+     */
+    const GridType& getFront() const noexcept
+    {
+        return getBuffer(0);
+    }
+
+
+    /**
+     * @brief Returns back buffer (next state).
+     *
+     * @return
+     */
+    GridType& getBack() noexcept
+    {
+        return getBuffer(1);
+    }
+
+
+    /**
+     * @brief Returns back buffer (next state).
+     *
+     * @return
+     */
+    const GridType& getBack() const noexcept
+    {
+        return getBuffer(1);
+    }
+
+
+    /**
+     * @brief Returns the oldest buffer (previous state).
+     *
+     * @return
+     */
+    const GridType& getPrevious() const noexcept
+    {
+        return getBuffer(N - 1);
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Resize all buffers.
+     *
+     * @param size New size of the grid.
+     */
+    void resize(CoordinateType size)
+    {
+        for (auto& buffer : m_buffers)
+            exclusive(buffer).resize(size);
+    }
+
+
+    /**
+     * @brief Resize all buffers.
+     *
+     * @param size  New size of the grid.
+     * @param value The value to initialize the new elements with.
+     */
+    void resize(CoordinateType size, const T& value)
+    {
+        for (auto& buffer : m_buffers)
+            exclusive(buffer).resize(size, value);
+    }
+
+
+    /**
+     * @brief Make back buffer the front one.
+     */
+    void swap()
+    {
+        m_front = (m_front + 1) % N;
+
+        // New back buffer will be written
+        exclusive(m_buffers[(m_front + 1) % N]);
+    }
+
+
+    /**
+     * @brief Returns read-only shared front buffer.
+     *
+     * @return
+     */
+    SharedPtr<const GridType> snapshot() const noexcept
+    {
+        return m_buffers[m_front];
+    }
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Make sure buffer is not shared with a snapshot.
+     *
+     * @param buffer
+     *
+     * @return
+     */
+    static GridType& exclusive(SharedPtr<GridType>& buffer)
+    {
+        if (buffer.use_count() > 1)
+            buffer = makeShared<GridType>(buffer->getSize());
+
+        return *buffer;
+    }
+
+
+// Private Data Members
+private:
+
+    /// Buffers.
+    StaticArray<SharedPtr<GridType>, N> m_buffers;
+
+    /// Index of front buffer.
+    unsigned int m_front = 0;
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Double buffered grid.
+ */
+template<typename T, typename Alloc = AlignedAllocator<T>, typename Layout = GridLayoutRowMajor>
+using DoubleBufferedGrid = BufferedGrid<T, 2, Alloc, Layout>;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,340 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/Compression.hpp"
+
+// C++
+#include <cstring>
+
+// CeCe
+#include "cece/core/Assert.hpp"
+#include "cece/core/Exception.hpp"
+#include "cece/core/StaticArray.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+namespace compression {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Minimum match length.
+constexpr std::size_t MIN_MATCH = 4;
+
+/// Maximum match offset.
+constexpr std::size_t MAX_OFFSET = 0xFFFF;
+
+/// Number of bytes at the end of input that are always stored as literals.
+constexpr std::size_t LAST_LITERALS = 5;
+
+/// Inputs shorter than this are stored as literals only.
+constexpr std::size_t MIN_INPUT = 13;
+
+/// Number of hash table bits.
+constexpr unsigned HASH_BITS = 12;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Read 32-bit value from unaligned memory.
+ *
+ * @param ptr
+ *
+ * @return
+ */
+inline std::uint32_t read32(const std::uint8_t* ptr) noexcept
+{
+    std::uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate hash of 4 bytes.
+ *
+ * @param value
+ *
+ * @return
+ */
+inline std::uint32_t hash(std::uint32_t value) noexcept
+{
+    return (value * 2654435761u) >> (32 - HASH_BITS);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Write length extension bytes.
+ *
+ * @param dst
+ * @param length Length already reduced by token nibble value (15).
+ */
+inline void writeLength(DynamicArray<std::uint8_t>& dst, std::size_t length)
+{
+    for (; length >= 255; length -= 255)
+        dst.push_back(255);
+
+    dst.push_back(static_cast<std::uint8_t>(length));
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Write compressed sequence.
+ *
+ * @param dst
+ * @param literals    Literals begin.
+ * @param literalsLen Number of literals.
+ * @param offset      Match offset, zero for last sequence.
+ * @param matchLen    Match length.
+ */
+void writeSequence(DynamicArray<std::uint8_t>& dst, const std::uint8_t* literals,
+    std::size_t literalsLen, std::size_t offset, std::size_t matchLen)
+{
+    const std::size_t matchCode = offset ? matchLen - MIN_MATCH : 0;
+
+    dst.push_back(static_cast<std::uint8_t>(
+        ((literalsLen < 15 ? literalsLen : 15) << 4) |
+        (matchCode < 15 ? matchCode : 15)
+    ));
+
+    if (literalsLen >= 15)
+        writeLength(dst, literalsLen - 15);
+
+    dst.insert(dst.end(), literals, literals + literalsLen);
+
+    // Last sequence
+    if (!offset)
+        return;
+
+    dst.push_back(static_cast<std::uint8_t>(offset & 0xFF));
+    dst.push_back(static_cast<std::uint8_t>(offset >> 8));
+
+    if (matchCode >= 15)
+        writeLength(dst, matchCode - 15);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Read length extension bytes.
+ *
+ * @param ip
+ * @param end
+ *
+ * @return
+ */
+std::size_t readLength(const std::uint8_t*& ip, const std::uint8_t* end)
+{
+    std::size_t length = 0;
+    std::uint8_t byte;
+
+    do
+    {
+        if (ip == end)
+            throw RuntimeException("Corrupted compressed data");
+
+        byte = *ip++;
+        length += byte;
+    }
+    while (byte == 255);
+
+    return length;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+void shuffle(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, std::size_t typeSize) noexcept
+{
+    for (std::size_t b = 0; b < typeSize; ++b)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            dst[b * count + i] = src[i * typeSize + b];
+    }
+}
+
+/* ************************************************************************ */
+
+void unshuffle(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, std::size_t typeSize) noexcept
+{
+    for (std::size_t b = 0; b < typeSize; ++b)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            dst[i * typeSize + b] = src[b * count + i];
+    }
+}
+
+/* ************************************************************************ */
+
+std::size_t compressBound(std::size_t size) noexcept
+{
+    return size + size / 255 + 16;
+}
+
+/* ************************************************************************ */
+
+void compress(const std::uint8_t* src, std::size_t size, DynamicArray<std::uint8_t>& dst)
+{
+    dst.clear();
+    dst.reserve(compressBound(size));
+
+    const std::uint8_t* anchor = src;
+
+    if (size >= MIN_INPUT)
+    {
+        // Positions of last occurrence of 4-byte sequences
+        StaticArray<std::uint32_t, 1u << HASH_BITS> table;
+        table.fill(0);
+
+        const std::uint8_t* ip = src;
+        const std::uint8_t* const matchLimit = src + size - LAST_LITERALS;
+        const std::uint8_t* const searchLimit = src + size - MIN_INPUT + 1;
+        std::size_t misses = 0;
+
+        while (ip < searchLimit)
+        {
+            const std::uint32_t sequence = read32(ip);
+            const std::uint32_t h = hash(sequence);
+            const std::uint8_t* ref = src + table[h];
+            table[h] = static_cast<std::uint32_t>(ip - src);
+
+            if (ref >= ip || static_cast<std::size_t>(ip - ref) > MAX_OFFSET || read32(ref) != sequence)
+            {
+                // Skip faster through incompressible data
+                ip += 1 + (misses++ >> 6);
+                continue;
+            }
+
+            misses = 0;
+
+            // Extend match backward
+            while (ip > anchor && ref > src && ip[-1] == ref[-1])
+            {
+                --ip;
+                --ref;
+            }
+
+            // Extend match forward
+            std::size_t length = MIN_MATCH;
+
+            while (ip + length < matchLimit && ip[length] == ref[length])
+                ++length;
+
+            writeSequence(dst, anchor, ip - anchor, ip - ref, length);
+
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    // Last literals
+    writeSequence(dst, anchor, src + size - anchor, 0, 0);
+}
+
+/* ************************************************************************ */
+
+void decompress(const std::uint8_t* src, std::size_t size, std::uint8_t* dst, std::size_t dstSize)
+{
+    const std::uint8_t* ip = src;
+    const std::uint8_t* const ipEnd = src + size;
+    std::uint8_t* op = dst;
+    std::uint8_t* const opEnd = dst + dstSize;
+
+    while (ip < ipEnd)
+    {
+        const std::uint8_t token = *ip++;
+
+        // Literals
+        std::size_t literalsLen = token >> 4;
+
+        if (literalsLen == 15)
+            literalsLen += readLength(ip, ipEnd);
+
+        if (literalsLen > static_cast<std::size_t>(ipEnd - ip) ||
+            literalsLen > static_cast<std::size_t>(opEnd - op))
+            throw RuntimeException("Corrupted compressed data");
+
+        // Empty destination is null
+        if (literalsLen)
+        {
+            std::memcpy(op, ip, literalsLen);
+            ip += literalsLen;
+            op += literalsLen;
+        }
+
+        // Last sequence has no match
+        if (ip == ipEnd)
+            break;
+
+        // Match
+        if (ipEnd - ip < 2)
+            throw RuntimeException("Corrupted compressed data");
+
+        const std::size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+
+        std::size_t matchLen = token & 0x0F;
+
+        if (matchLen == 15)
+            matchLen += readLength(ip, ipEnd);
+
+        matchLen += MIN_MATCH;
+
+        if (offset == 0 || offset > static_cast<std::size_t>(op - dst) ||
+            matchLen > static_cast<std::size_t>(opEnd - op))
+            throw RuntimeException("Corrupted compressed data");
+
+        // Byte copy handles overlapping matches
+        const std::uint8_t* ref = op - offset;
+
+        for (std::size_t i = 0; i < matchLen; ++i)
+            op[i] = ref[i];
+
+        op += matchLen;
+    }
+
+    if (op != opEnd)
+        throw RuntimeException("Corrupted compressed data");
+}
+
+/* ************************************************************************ */
+
+}
+}
+}
+
+/* ************************************************************************ */
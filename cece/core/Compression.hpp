@@ -0,0 +1,117 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+#include <cstdint>
+
+// CeCe
+#include "cece/core/DynamicArray.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+namespace compression {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Shuffle bytes of array elements.
+ *
+ * Bytes are reordered in a way the first bytes of all elements are stored
+ * together, then the second bytes, etc. Numeric data with slowly varying
+ * values (e.g. grid fields) have much longer repeated byte sequences after
+ * shuffle, which improves compression ratio.
+ *
+ * @param src      Source data.
+ * @param dst      Destination buffer, must not overlap with source.
+ * @param count    Number of elements.
+ * @param typeSize Size of single element in bytes.
+ */
+void shuffle(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, std::size_t typeSize) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Revert shuffle made by shuffle().
+ *
+ * @param src      Source (shuffled) data.
+ * @param dst      Destination buffer, must not overlap with source.
+ * @param count    Number of elements.
+ * @param typeSize Size of single element in bytes.
+ */
+void unshuffle(const std::uint8_t* src, std::uint8_t* dst, std::size_t count, std::size_t typeSize) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns maximum size of compressed data.
+ *
+ * @param size Size of input data.
+ *
+ * @return
+ */
+std::size_t compressBound(std::size_t size) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compress data with fast LZ77 based codec.
+ *
+ * Format is a sequence of tokens (literal length, match length) followed by
+ * literal bytes and 16-bit match offset, similar to LZ4 block format.
+ *
+ * @param src  Source data.
+ * @param size Size of source data.
+ * @param dst  Output buffer. It's resized to the compressed data size.
+ */
+void compress(const std::uint8_t* src, std::size_t size, DynamicArray<std::uint8_t>& dst);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Decompress data compressed by compress().
+ *
+ * @param src     Compressed data.
+ * @param size    Size of compressed data.
+ * @param dst     Output buffer.
+ * @param dstSize Exact size of decompressed data.
+ *
+ * @throw RuntimeException In case of corrupted data.
+ */
+void decompress(const std::uint8_t* src, std::size_t size, std::uint8_t* dst, std::size_t dstSize);
+
+/* ************************************************************************ */
+
+}
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,89 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+
+// Declaration
+#include "cece/core/CpuFeatures.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Query supported features.
+ *
+ * @return Bit mask indexed by CpuFeature.
+ */
+unsigned int queryFeatures() noexcept
+{
+    unsigned int mask = 0;
+
+#ifdef CECE_CPU_DISPATCH
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx"))
+        mask |= 1u << static_cast<unsigned int>(CpuFeature::Avx);
+
+    if (__builtin_cpu_supports("avx2"))
+        mask |= 1u << static_cast<unsigned int>(CpuFeature::Avx2);
+
+    if (__builtin_cpu_supports("fma"))
+        mask |= 1u << static_cast<unsigned int>(CpuFeature::Fma);
+
+    if (__builtin_cpu_supports("f16c"))
+        mask |= 1u << static_cast<unsigned int>(CpuFeature::F16c);
+
+    if (__builtin_cpu_supports("avx512f"))
+        mask |= 1u << static_cast<unsigned int>(CpuFeature::Avx512f);
+#endif
+
+    return mask;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+bool hasCpuFeature(CpuFeature feature) noexcept
+{
+    static const unsigned int features = queryFeatures();
+    return (features >> static_cast<unsigned int>(feature)) & 1u;
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
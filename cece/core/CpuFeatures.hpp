@@ -0,0 +1,109 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+
+#pragma once
+
+/* ************************************************************************ */
+
+/**
+ * @brief Runtime instruction set dispatch is supported.
+ *
+ * Kernels are compiled for several instruction sets with the target
+ * attribute and the best one is selected by hasCpuFeature() at runtime.
+ * It requires GCC 4.9 or clang 3.8 (older clang has neither the target
+ * attribute nor __builtin_cpu_supports) on x86. Otherwise only default
+ * kernels are compiled.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (\
+    (defined(__clang__) && (__clang_major__ > 3 || (__clang_major__ == 3 && __clang_minor__ >= 8))) || \
+    (!defined(__clang__) && defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define CECE_CPU_DISPATCH 1
+#endif
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compile function for given instruction set, e.g.
+ * CECE_TARGET("avx2,fma"). Only for use under CECE_CPU_DISPATCH.
+ */
+#ifdef CECE_CPU_DISPATCH
+#define CECE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CECE_TARGET(isa)
+#endif
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compile vectorized kernel which selects values after computation.
+ *
+ * GCC doesn't if-convert floating point operations which can trap, so such
+ * loops wouldn't vectorize without it.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#define CECE_KERNEL __attribute__((optimize("no-trapping-math")))
+#else
+#define CECE_KERNEL
+#endif
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief CPU features used by kernel dispatch.
+ */
+enum class CpuFeature
+{
+    Avx,
+    Avx2,
+    Fma,
+    F16c,
+    Avx512f
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Check if current CPU supports the feature.
+ *
+ * CPU is queried once, later calls are cheap.
+ *
+ * @param feature
+ *
+ * @return False if runtime dispatch is not supported by the compiler.
+ */
+bool hasCpuFeature(CpuFeature feature) noexcept;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -36,6 +36,10 @@ inline namespace core {
 
 /* ************************************************************************ */
 
+constexpr std::size_t CsvFile::BUFFER_SIZE;
+
+/* ************************************************************************ */
+
 CsvFile::CsvFile(FilePath path)
 {
     open(std::move(path));
@@ -43,6 +47,13 @@ CsvFile::CsvFile(FilePath path)
 
 /* ************************************************************************ */
 
+CsvFile::~CsvFile()
+{
+    flushBuffer();
+}
+
+/* ************************************************************************ */
+
 bool CsvFile::isOpen() const noexcept
 {
     return m_file.is_open();
@@ -59,6 +70,8 @@ void CsvFile::open()
 
 void CsvFile::open(FilePath path)
 {
+    close();
+
     m_path = std::move(path);
     m_file.open(m_path.toString(), std::ios::binary | std::ios::out | std::ios::trunc);
 
@@ -68,6 +81,33 @@ void CsvFile::open(FilePath path)
 
 /* ************************************************************************ */
 
+void CsvFile::close() noexcept
+{
+    flushBuffer();
+    m_file.close();
+}
+
+/* ************************************************************************ */
+
+void CsvFile::flush() noexcept
+{
+    flushBuffer();
+    m_file.flush();
+}
+
+/* ************************************************************************ */
+
+void CsvFile::flushBuffer() noexcept
+{
+    if (m_bufferSize == 0)
+        return;
+
+    m_file.write(m_buffer.data(), m_bufferSize);
+    m_bufferSize = 0;
+}
+
+/* ************************************************************************ */
+
 }
 }
 
@@ -28,14 +28,19 @@
 /* ************************************************************************ */
 
 // C++
+#include <cstring>
 #include <utility>
+#include <type_traits>
 
 // CeCe
 #include "cece/core/Tuple.hpp"
 #include "cece/core/DynamicArray.hpp"
 #include "cece/core/String.hpp"
+#include "cece/core/StringView.hpp"
+#include "cece/core/StringStream.hpp"
 #include "cece/core/FilePath.hpp"
 #include "cece/core/FileStream.hpp"
+#include "cece/core/NumberFormat.hpp"
 #include "cece/core/IntegerSequence.hpp"
 
 /* ************************************************************************ */
@@ -47,10 +52,43 @@ inline namespace core {
 
 /**
  * @brief CSV file.
+ *
+ * Output is collected in a large internal buffer which is written to the
+ * file in big blocks. Numbers are formatted directly into the buffer without
+ * iostreams. Integers are written in decimal and reals as default stream
+ * output would write them, see RealFormat.
  */
 class CsvFile
 {
 
+// Public Enums
+public:
+
+
+    /**
+     * @brief Output format of real values.
+     */
+    enum class RealFormat
+    {
+        /// Six significant digits like default stream output, e.g. `1.5`.
+        General,
+
+        /// Scientific notation with six decimal digits, e.g. `1.500000e+00`.
+        Scientific,
+
+        /// Shortest round-trip scientific notation, e.g. `1.5e+00`.
+        Shortest
+    };
+
+
+// Public Constants
+public:
+
+
+    /// Size of output buffer.
+    static constexpr std::size_t BUFFER_SIZE = 1024 * 1024;
+
+
 // Public Ctors & Dtors
 public:
 
@@ -69,6 +107,12 @@ public:
     explicit CsvFile(FilePath path);
 
 
+    /**
+     * @brief Destructor.
+     */
+    ~CsvFile();
+
+
 // Public Accessors & Mutators
 public:
 
@@ -102,6 +146,31 @@ public:
     }
 
 
+    /**
+     * @brief Returns output format of real values.
+     *
+     * @return
+     */
+    RealFormat getRealFormat() const noexcept
+    {
+        return m_realFormat;
+    }
+
+
+    /**
+     * @brief Change output format of real values.
+     *
+     * Shortest format writes values which parse back exactly and it's
+     * the fastest one, but it's not compatible with the default output.
+     *
+     * @param format
+     */
+    void setRealFormat(RealFormat format) noexcept
+    {
+        m_realFormat = format;
+    }
+
+
 // Public Operations
 public:
 
@@ -123,10 +192,7 @@ public:
     /**
      * @brief Close file.
      */
-    void close() noexcept
-    {
-        m_file.close();
-    }
+    void close() noexcept;
 
 
     /**
@@ -176,14 +242,144 @@ public:
 
 
     /**
-     * @brief Flush output.
+     * @brief Write value separator.
+     */
+    void writeSeparator() noexcept
+    {
+        writeChar(';');
+    }
+
+
+    /**
+     * @brief Write end of line.
      */
-    void flush() noexcept
+    void writeEndLine() noexcept
     {
-        m_file.flush();
+        writeString("\r\n", 2);
     }
 
 
+    /**
+     * @brief Write single character.
+     *
+     * @param value
+     */
+    void writeValue(char value) noexcept
+    {
+        writeChar(value);
+    }
+
+
+    /**
+     * @brief Write string value.
+     *
+     * @param value
+     */
+    void writeValue(const char* value) noexcept
+    {
+        writeString(value, std::strlen(value));
+    }
+
+
+    /**
+     * @brief Write string value.
+     *
+     * @param value
+     */
+    void writeValue(const String& value) noexcept
+    {
+        writeString(value.data(), value.size());
+    }
+
+
+    /**
+     * @brief Write string value.
+     *
+     * @param value
+     */
+    void writeValue(const StringView& value) noexcept
+    {
+        writeString(value.getData(), value.getLength());
+    }
+
+
+    /**
+     * @brief Write signed integer value.
+     *
+     * @param value
+     */
+    template<typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+    void writeValue(T value) noexcept
+    {
+        char* ptr = reserve(NUMBER_FORMAT_BUFFER_SIZE);
+        m_bufferSize = formatInteger(ptr, value) - m_buffer.data();
+    }
+
+
+    /**
+     * @brief Write unsigned integer value.
+     *
+     * @param value
+     */
+    template<typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, int>::type = 0>
+    void writeValue(T value) noexcept
+    {
+        char* ptr = reserve(NUMBER_FORMAT_BUFFER_SIZE);
+        m_bufferSize = formatUnsigned(ptr, value) - m_buffer.data();
+    }
+
+
+    /**
+     * @brief Write real value.
+     *
+     * @param value
+     */
+    template<typename T, typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    void writeValue(T value) noexcept
+    {
+        char* ptr = reserve(NUMBER_FORMAT_BUFFER_SIZE);
+
+        switch (m_realFormat)
+        {
+        case RealFormat::General:
+            ptr = formatRealGeneral(ptr, static_cast<double>(value));
+            break;
+
+        case RealFormat::Scientific:
+            ptr = formatRealScientific(ptr, static_cast<double>(value));
+            break;
+
+        case RealFormat::Shortest:
+            ptr = formatReal(ptr, static_cast<double>(value));
+            break;
+        }
+
+        m_bufferSize = ptr - m_buffer.data();
+    }
+
+
+    /**
+     * @brief Write value of any other type using its output operator.
+     *
+     * @param value
+     */
+    template<typename T, typename std::enable_if<
+        !std::is_arithmetic<typename std::decay<T>::type>::value &&
+        !std::is_convertible<const T&, StringView>::value, int>::type = 0>
+    void writeValue(const T& value) noexcept
+    {
+        OutStringStream oss;
+        oss << value;
+        writeValue(oss.str());
+    }
+
+
+    /**
+     * @brief Flush output.
+     */
+    void flush() noexcept;
+
+
 // Protected Operations
 protected:
 
@@ -206,7 +402,8 @@ protected:
     template<typename Arg, typename... Args>
     void writeValues(Arg&& arg, Args&&... args) noexcept
     {
-        m_file << ';' << arg;
+        writeSeparator();
+        writeValue(arg);
         writeValues(std::forward<Args>(args)...);
     }
 
@@ -221,12 +418,12 @@ protected:
         for (auto it = values.begin(); it != values.end(); ++it)
         {
             if (it != values.begin())
-                m_file << ';';
+                writeSeparator();
 
-            m_file << *it;
+            writeValue(*it);
         }
 
-        m_file << "\r\n";
+        writeEndLine();
     }
 
 
@@ -239,12 +436,70 @@ protected:
     template<typename Arg, typename... Args>
     void writeLine(Arg&& arg, Args&&... args) noexcept
     {
-        m_file << arg;
+        writeValue(arg);
         writeValues(std::forward<Args>(args)...);
-        m_file << "\r\n";
+        writeEndLine();
     }
 
 
+// Private Operations
+private:
+
+
+    /**
+     * @brief Reserve space in output buffer.
+     *
+     * @param size Number of required characters, at most BUFFER_SIZE.
+     *
+     * @return Pointer to the first free character.
+     */
+    char* reserve(std::size_t size) noexcept
+    {
+        if (m_buffer.size() - m_bufferSize < size)
+            flushBuffer();
+
+        return m_buffer.data() + m_bufferSize;
+    }
+
+
+    /**
+     * @brief Write single character.
+     *
+     * @param value
+     */
+    void writeChar(char value) noexcept
+    {
+        *reserve(1) = value;
+        ++m_bufferSize;
+    }
+
+
+    /**
+     * @brief Write string.
+     *
+     * @param data
+     * @param size
+     */
+    void writeString(const char* data, std::size_t size) noexcept
+    {
+        if (size > BUFFER_SIZE)
+        {
+            flushBuffer();
+            m_file.write(data, size);
+            return;
+        }
+
+        std::memcpy(reserve(size), data, size);
+        m_bufferSize += size;
+    }
+
+
+    /**
+     * @brief Write buffered data to file.
+     */
+    void flushBuffer() noexcept;
+
+
 // Private Data Members
 private:
 
@@ -254,6 +509,15 @@ private:
     /// File stream.
     FileStream m_file;
 
+    /// Output buffer.
+    DynamicArray<char> m_buffer = DynamicArray<char>(BUFFER_SIZE);
+
+    /// Number of used characters in output buffer.
+    std::size_t m_bufferSize = 0;
+
+    /// Output format of real values.
+    RealFormat m_realFormat = RealFormat::General;
+
 };
 
 /* ************************************************************************ */
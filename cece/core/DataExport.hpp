@@ -166,6 +166,59 @@ struct DataExportFormat<double> : public DataExportFormatBase<double, double, DA
 template<>
 struct DataExportFormat<float> : public DataExportFormatBase<float, double, DATA_EXPORT_FORMAT_DOUBLE> {};
 
+template<>
+struct DataExportFormat<long double> : public DataExportFormatBase<long double, double, DATA_EXPORT_FORMAT_DOUBLE> {};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Formatting structure for strings, passed without copying.
+ */
+template<>
+struct DataExportFormat<String>
+{
+    /// Format character.
+    static constexpr char FORMAT = DATA_EXPORT_FORMAT_STRING;
+
+    /// Types
+    using StoreType = const String&;
+    using PassType = const char*;
+
+
+    /**
+     * @brief Convert value.
+     *
+     * @param value Value to convert.
+     *
+     * @return Stored value.
+     */
+    static StoreType convertStorage(const String& value) noexcept
+    {
+        return value;
+    }
+
+
+    /**
+     * @brief Convert value.
+     *
+     * @param value Value to convert.
+     *
+     * @return Passed value.
+     */
+    static PassType convertPass(const String& value) noexcept
+    {
+        return value.c_str();
+    }
+};
+
+/* ************************************************************************ */
+
+template<>
+struct DataExportFormat<const char*> : public DataExportFormatBase<const char*, const char*, DATA_EXPORT_FORMAT_STRING> {};
+
+template<>
+struct DataExportFormat<char*> : public DataExportFormatBase<char*, const char*, DATA_EXPORT_FORMAT_STRING> {};
+
 /* ************************************************************************ */
 
 /**
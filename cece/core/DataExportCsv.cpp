@@ -29,11 +29,6 @@
 // C++
 #include <cstdarg>
 #include <utility>
-#include <iostream>
-
-// CeCe
-#include "cece/core/DynamicArray.hpp"
-#include "cece/core/StringStream.hpp"
 
 /* ************************************************************************ */
 
@@ -45,7 +40,8 @@ inline namespace core {
 DataExportCsv::DataExportCsv(FilePath path)
     : m_file(path.append(".csv"))
 {
-    // Nothing to do
+    // Keep format of the previous stream output
+    m_file.setRealFormat(CsvFile::RealFormat::Scientific);
 }
 
 /* ************************************************************************ */
@@ -66,14 +62,17 @@ void DataExportCsv::writeHeaderImpl(int count, ...)
     va_list args;
     va_start(args, count);
 
-    DynamicArray<String> names(count);
-
     for (int i = 0; i < count; ++i)
-        names[i] = va_arg(args, const char*);
+    {
+        if (i)
+            m_file.writeSeparator();
+
+        m_file.writeValue(va_arg(args, const char*));
+    }
 
     va_end(args);
 
-    m_file.writeHeaderArray(names);
+    m_file.writeEndLine();
 }
 
 /* ************************************************************************ */
@@ -83,37 +82,34 @@ void DataExportCsv::writeRecordImpl(int count, const char* format, ...)
     va_list args;
     va_start(args, format);
 
-    DynamicArray<String> values(count);
-
     for (int i = 0; i < count; ++i)
     {
+        if (i)
+            m_file.writeSeparator();
+
         switch (format[i])
         {
         case DATA_EXPORT_FORMAT_INT:
-            values[i] = toString(va_arg(args, int));
+            m_file.writeValue(va_arg(args, int));
             break;
 
         case DATA_EXPORT_FORMAT_LONG:
-            values[i] = toString(va_arg(args, long));
+            m_file.writeValue(va_arg(args, long));
             break;
 
         case DATA_EXPORT_FORMAT_DOUBLE:
-        {
-            OutStringStream oss;
-            oss << std::scientific << va_arg(args, double);
-            values[i] = oss.str();
+            m_file.writeValue(va_arg(args, double));
             break;
-        }
 
         case DATA_EXPORT_FORMAT_STRING:
-            values[i] = va_arg(args, const char*);
+            m_file.writeValue(va_arg(args, const char*));
             break;
         }
     }
 
     va_end(args);
 
-    m_file.writeRecordArray(values);
+    m_file.writeEndLine();
 }
 
 /* ************************************************************************ */
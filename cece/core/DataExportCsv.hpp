@@ -78,6 +78,35 @@ public:
     }
 
 
+    /**
+     * @brief Returns output format of real values.
+     *
+     * @return
+     */
+    CsvFile::RealFormat getRealFormat() const noexcept
+    {
+        return m_file.getRealFormat();
+    }
+
+
+// Public Mutators
+public:
+
+
+    /**
+     * @brief Change output format of real values.
+     *
+     * Reals are written in scientific notation with six decimal digits by
+     * default.
+     *
+     * @param format
+     */
+    void setRealFormat(CsvFile::RealFormat format) noexcept
+    {
+        m_file.setRealFormat(format);
+    }
+
+
 // Public Operations
 public:
 
@@ -0,0 +1,350 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/FastMath.hpp"
+
+// C++
+#include <algorithm>
+
+// CeCe
+#include "cece/core/CpuFeatures.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+namespace math {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Array operations.
+ */
+enum Operation
+{
+    OP_EXP,
+    OP_LOG,
+    OP_POW,
+    OP_SIGMOID,
+    OP_HILL,
+    OP_COUNT
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Array kernel type.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ * @param a     First operation parameter.
+ * @param b     Second operation parameter.
+ */
+using KernelFn = void (*)(const RealType*, RealType*, std::size_t, double, double);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Number of values processed together.
+ *
+ * Constant block length lets the compiler vectorize the loops without
+ * runtime trip count checks.
+ */
+constexpr std::size_t BLOCK_SIZE = 16;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Evaluate operation for single value.
+ */
+template<int Op, bool Precise>
+CECE_FAST_MATH_INLINE double evaluate(double x, double a, double b) noexcept
+{
+    switch (Op)
+    {
+    case OP_EXP:
+        return expApprox<Precise>(x);
+
+    case OP_LOG:
+        return logApprox<Precise>(x);
+
+    case OP_POW:
+        // a = y, y = 0 is handled by caller
+        return expApprox<Precise>(a * logApprox<Precise>(x));
+
+    case OP_SIGMOID:
+        return 1.0 / (1.0 + expApprox<Precise>(-x));
+
+    case OP_HILL:
+        // a = n, b = ln(K)
+        return 1.0 / (1.0 + expApprox<Precise>(a * (b - logApprox<Precise>(x))));
+    }
+
+    return x;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Array kernel implementation.
+ */
+template<int Op, bool Precise>
+CECE_FAST_MATH_INLINE void applyImpl(const RealType* in, RealType* out, std::size_t count, double a, double b) noexcept
+{
+    std::size_t i = 0;
+
+    for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+    {
+        RealType block[BLOCK_SIZE];
+
+        for (std::size_t j = 0; j < BLOCK_SIZE; ++j)
+            block[j] = static_cast<RealType>(evaluate<Op, Precise>(in[i + j], a, b));
+
+        for (std::size_t j = 0; j < BLOCK_SIZE; ++j)
+            out[i + j] = block[j];
+    }
+
+    for (; i < count; ++i)
+        out[i] = static_cast<RealType>(evaluate<Op, Precise>(in[i], a, b));
+}
+
+/* ************************************************************************ */
+
+template<int Op, bool Precise>
+CECE_KERNEL
+void applyDefault(const RealType* in, RealType* out, std::size_t count, double a, double b) noexcept
+{
+    applyImpl<Op, Precise>(in, out, count, a, b);
+}
+
+/* ************************************************************************ */
+
+#ifdef CECE_CPU_DISPATCH
+
+template<int Op, bool Precise>
+CECE_TARGET("avx2,fma") CECE_KERNEL
+void applyAvx2(const RealType* in, RealType* out, std::size_t count, double a, double b) noexcept
+{
+    applyImpl<Op, Precise>(in, out, count, a, b);
+}
+
+/* ************************************************************************ */
+
+template<int Op, bool Precise>
+CECE_TARGET("avx512f") CECE_KERNEL
+void applyAvx512(const RealType* in, RealType* out, std::size_t count, double a, double b) noexcept
+{
+    applyImpl<Op, Precise>(in, out, count, a, b);
+}
+
+#endif
+
+/* ************************************************************************ */
+
+/**
+ * @brief Selected kernels.
+ */
+struct Kernels
+{
+    /// Kernels for operations, fast and precise version.
+    KernelFn fns[OP_COUNT][2];
+
+    /// Instruction set name.
+    const char* isa;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Select kernels for current CPU.
+ *
+ * @return
+ */
+Kernels selectKernels() noexcept
+{
+#ifdef CECE_CPU_DISPATCH
+    if (hasCpuFeature(CpuFeature::Avx512f))
+    {
+        return {{
+            {applyAvx512<OP_EXP, false>, applyAvx512<OP_EXP, true>},
+            {applyAvx512<OP_LOG, false>, applyAvx512<OP_LOG, true>},
+            {applyAvx512<OP_POW, false>, applyAvx512<OP_POW, true>},
+            {applyAvx512<OP_SIGMOID, false>, applyAvx512<OP_SIGMOID, true>},
+            {applyAvx512<OP_HILL, false>, applyAvx512<OP_HILL, true>}
+        }, "avx512f"};
+    }
+
+    if (hasCpuFeature(CpuFeature::Avx2) && hasCpuFeature(CpuFeature::Fma))
+    {
+        return {{
+            {applyAvx2<OP_EXP, false>, applyAvx2<OP_EXP, true>},
+            {applyAvx2<OP_LOG, false>, applyAvx2<OP_LOG, true>},
+            {applyAvx2<OP_POW, false>, applyAvx2<OP_POW, true>},
+            {applyAvx2<OP_SIGMOID, false>, applyAvx2<OP_SIGMOID, true>},
+            {applyAvx2<OP_HILL, false>, applyAvx2<OP_HILL, true>}
+        }, "avx2"};
+    }
+#endif
+
+    return {{
+        {applyDefault<OP_EXP, false>, applyDefault<OP_EXP, true>},
+        {applyDefault<OP_LOG, false>, applyDefault<OP_LOG, true>},
+        {applyDefault<OP_POW, false>, applyDefault<OP_POW, true>},
+        {applyDefault<OP_SIGMOID, false>, applyDefault<OP_SIGMOID, true>},
+        {applyDefault<OP_HILL, false>, applyDefault<OP_HILL, true>}
+    }, "default"};
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns kernels for current CPU.
+ *
+ * @return
+ */
+const Kernels& getKernels() noexcept
+{
+    static const Kernels kernels = selectKernels();
+    return kernels;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Run kernel for given operation and accuracy.
+ */
+void apply(Operation op, Accuracy accuracy, const RealType* in, RealType* out,
+    std::size_t count, double a = 0, double b = 0) noexcept
+{
+    getKernels().fns[op][accuracy == Accuracy::Precise ? 1 : 0](in, out, count, a, b);
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+void exp(const RealType* in, RealType* out, std::size_t count, Accuracy accuracy) noexcept
+{
+    if (accuracy == Accuracy::Exact)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = std::exp(in[i]);
+
+        return;
+    }
+
+    apply(OP_EXP, accuracy, in, out, count);
+}
+
+/* ************************************************************************ */
+
+void log(const RealType* in, RealType* out, std::size_t count, Accuracy accuracy) noexcept
+{
+    if (accuracy == Accuracy::Exact)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = std::log(in[i]);
+
+        return;
+    }
+
+    apply(OP_LOG, accuracy, in, out, count);
+}
+
+/* ************************************************************************ */
+
+void pow(const RealType* in, RealType y, RealType* out, std::size_t count, Accuracy accuracy) noexcept
+{
+    if (accuracy == Accuracy::Exact)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = std::pow(in[i], y);
+
+        return;
+    }
+
+    // x^0 = 1 for any x, including zero and NaN
+    if (y == 0)
+    {
+        std::fill(out, out + count, RealType(1));
+        return;
+    }
+
+    apply(OP_POW, accuracy, in, out, count, y);
+}
+
+/* ************************************************************************ */
+
+void sigmoid(const RealType* in, RealType* out, std::size_t count, Accuracy accuracy) noexcept
+{
+    if (accuracy == Accuracy::Exact)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = sigmoid<Accuracy::Exact>(in[i]);
+
+        return;
+    }
+
+    apply(OP_SIGMOID, accuracy, in, out, count);
+}
+
+/* ************************************************************************ */
+
+void hill(const RealType* in, RealType k, RealType n, RealType* out, std::size_t count,
+    Accuracy accuracy) noexcept
+{
+    if (accuracy == Accuracy::Exact)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = hill<Accuracy::Exact>(in[i], k, n);
+
+        return;
+    }
+
+    apply(OP_HILL, accuracy, in, out, count, n, logApprox<true>(k));
+}
+
+/* ************************************************************************ */
+
+const char* getMathIsa() noexcept
+{
+    return getKernels().isa;
+}
+
+/* ************************************************************************ */
+
+}
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,472 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Macro.hpp"
+
+/* ************************************************************************ */
+
+#define CECE_FAST_MATH_INLINE CECE_FORCE_INLINE
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+namespace math {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Accuracy of math functions.
+ *
+ * Bounds are maximum relative errors against <cmath> in the domain
+ * described by each function.
+ */
+enum class Accuracy
+{
+    /// Relative error below 1e-4.
+    Fast,
+
+    /// Relative error below 1e-7.
+    Precise,
+
+    /// Functions from <cmath>, correctly rounded where the library is.
+    Exact
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Reinterpret double bits.
+ *
+ * @param value
+ *
+ * @return
+ */
+CECE_FAST_MATH_INLINE std::int64_t doubleToBits(double value) noexcept
+{
+    std::int64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Reinterpret bits as double.
+ *
+ * @param bits
+ *
+ * @return
+ */
+CECE_FAST_MATH_INLINE double bitsToDouble(std::int64_t bits) noexcept
+{
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Exponential function without library calls and branches.
+ *
+ * Argument is split into k * ln(2) + r with |r| <= ln(2) / 2 and e^r is
+ * approximated by Taylor polynomial: degree 4 for Fast and 9 for Precise.
+ * Results below ~1e-307 are flushed to zero.
+ *
+ * @tparam Precise If precise version is used.
+ *
+ * @param x
+ *
+ * @return
+ */
+template<bool Precise>
+CECE_FAST_MATH_INLINE double expApprox(double x) noexcept
+{
+    constexpr double MAGIC = 6755399441055744.0; // 1.5 * 2^52
+    constexpr double LOG2E = 1.4426950408889634;
+    constexpr double LN2_HI = 6.93147180369123816490e-01;
+    constexpr double LN2_LO = 1.90821492927058770002e-10;
+    constexpr double MAX = 709.782712893384;
+    constexpr double MIN = -707.0;
+
+    // NaN passes through the comparisons
+    const double xc = x > MAX ? MAX : (x < MIN ? MIN : x);
+
+    // Round to nearest by magic number, low bits of t contain k
+    const double t = xc * LOG2E + MAGIC;
+    const double k = t - MAGIC;
+    const double r = (xc - k * LN2_HI) - k * LN2_LO;
+
+    double p;
+
+    if (Precise)
+    {
+        p = 1.0 / 362880;
+        p = p * r + 1.0 / 40320;
+        p = p * r + 1.0 / 5040;
+        p = p * r + 1.0 / 720;
+        p = p * r + 1.0 / 120;
+        p = p * r + 1.0 / 24;
+        p = p * r + 1.0 / 6;
+        p = p * r + 0.5;
+        p = p * r + 1.0;
+        p = p * r + 1.0;
+    }
+    else
+    {
+        p = 1.0 / 24;
+        p = p * r + 1.0 / 6;
+        p = p * r + 0.5;
+        p = p * r + 1.0;
+        p = p * r + 1.0;
+    }
+
+    // 2^(k - 1) * 2, k can be 1024 near the overflow threshold
+    // Shift is unsigned, kb is garbage for NaN input
+    const std::int64_t kb = doubleToBits(t) - doubleToBits(MAGIC);
+    const auto scale = static_cast<std::int64_t>(static_cast<std::uint64_t>(kb + 1022) << 52);
+    const double result = p * bitsToDouble(scale) * 2.0;
+
+    return x > MAX ? std::numeric_limits<double>::infinity() : (x < MIN ? 0.0 : result);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Natural logarithm without library calls and branches.
+ *
+ * Argument is split into 2^e * m with m in [sqrt(2)/2, sqrt(2)) and
+ * ln(m) = 2 atanh(s), s = (m - 1) / (m + 1), is approximated by series up
+ * to s^5 for Fast and s^13 for Precise.
+ *
+ * @tparam Precise If precise version is used.
+ *
+ * @param x
+ *
+ * @return
+ */
+template<bool Precise>
+CECE_FAST_MATH_INLINE double logApprox(double x) noexcept
+{
+    constexpr double TWO52 = 4503599627370496.0;
+    constexpr double TWO54 = 18014398509481984.0;
+    constexpr double SQRT2 = 1.4142135623730951;
+    constexpr double LN2_HI = 6.93147180369123816490e-01;
+    constexpr double LN2_LO = 1.90821492927058770002e-10;
+    constexpr std::int64_t MANTISSA = 0x000fffffffffffffLL;
+    constexpr std::int64_t ONE = 0x3ff0000000000000LL;
+
+    // Subnormals are scaled into normal range
+    const bool subnormal = x < std::numeric_limits<double>::min();
+    const double xs = subnormal ? x * TWO54 : x;
+    const std::int64_t bits = doubleToBits(xs);
+
+    // Exponent converted by magic number, there is no vector int64 -> double
+    const double exponent = bitsToDouble(doubleToBits(TWO52) | static_cast<std::int64_t>(static_cast<std::uint64_t>(bits) >> 52)) - TWO52;
+    const double m1 = bitsToDouble((bits & MANTISSA) | ONE);
+
+    const bool big = m1 > SQRT2;
+    const double m = big ? m1 * 0.5 : m1;
+    const double e = exponent - 1023.0 + (big ? 1.0 : 0.0) - (subnormal ? 54.0 : 0.0);
+
+    const double s = (m - 1.0) / (m + 1.0);
+    const double s2 = s * s;
+
+    double p;
+
+    if (Precise)
+    {
+        p = 1.0 / 13;
+        p = p * s2 + 1.0 / 11;
+        p = p * s2 + 1.0 / 9;
+        p = p * s2 + 1.0 / 7;
+        p = p * s2 + 1.0 / 5;
+        p = p * s2 + 1.0 / 3;
+        p = p * s2 + 1.0;
+    }
+    else
+    {
+        p = 1.0 / 5;
+        p = p * s2 + 1.0 / 3;
+        p = p * s2 + 1.0;
+    }
+
+    const double result = e * LN2_HI + (2.0 * s * p + e * LN2_LO);
+    const double inf = std::numeric_limits<double>::infinity();
+
+    return x > 0
+        ? (x == inf ? inf : result)
+        : (x == 0 ? -inf : std::numeric_limits<double>::quiet_NaN())
+    ;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Inverse square root without library calls and branches.
+ *
+ * Initial estimate from exponent bits is refined by Newton iterations: two
+ * for Fast and three for Precise. Only normal positive arguments are
+ * supported, the caller is responsible for zero and special values.
+ *
+ * @tparam Precise If precise version is used.
+ *
+ * @param x
+ *
+ * @return
+ */
+template<bool Precise>
+CECE_FAST_MATH_INLINE double rsqrtApprox(double x) noexcept
+{
+    constexpr std::int64_t MAGIC = 0x5fe6eb50c7b537a9LL;
+
+    const double half = 0.5 * x;
+    double y = bitsToDouble(MAGIC - static_cast<std::int64_t>(static_cast<std::uint64_t>(doubleToBits(x)) >> 1));
+
+    y = y * (1.5 - half * y * y);
+    y = y * (1.5 - half * y * y);
+
+    if (Precise)
+        y = y * (1.5 - half * y * y);
+
+    return y;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Exponential function.
+ *
+ * @tparam A Accuracy.
+ *
+ * @param x
+ *
+ * @return
+ */
+template<Accuracy A = Accuracy::Precise>
+CECE_FAST_MATH_INLINE RealType exp(RealType x) noexcept
+{
+    return A == Accuracy::Exact
+        ? std::exp(x)
+        : static_cast<RealType>(expApprox<A == Accuracy::Precise>(x))
+    ;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Natural logarithm.
+ *
+ * @tparam A Accuracy.
+ *
+ * @param x
+ *
+ * @return
+ */
+template<Accuracy A = Accuracy::Precise>
+CECE_FAST_MATH_INLINE RealType log(RealType x) noexcept
+{
+    return A == Accuracy::Exact
+        ? std::log(x)
+        : static_cast<RealType>(logApprox<A == Accuracy::Precise>(x))
+    ;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Power function for non-negative base.
+ *
+ * Approximations return NaN for negative base, use Exact for integer
+ * powers of negative numbers. Relative error bound holds for results in
+ * normal range with |y * ln(x)| < 100.
+ *
+ * @tparam A Accuracy.
+ *
+ * @param x Base.
+ * @param y Exponent.
+ *
+ * @return
+ */
+template<Accuracy A = Accuracy::Precise>
+CECE_FAST_MATH_INLINE RealType pow(RealType x, RealType y) noexcept
+{
+    constexpr bool P = A == Accuracy::Precise;
+
+    return A == Accuracy::Exact
+        ? std::pow(x, y)
+        : static_cast<RealType>(y == 0 ? 1.0 : expApprox<P>(y * logApprox<P>(x)))
+    ;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Logistic sigmoid 1 / (1 + e^-x).
+ *
+ * @tparam A Accuracy.
+ *
+ * @param x
+ *
+ * @return
+ */
+template<Accuracy A = Accuracy::Precise>
+CECE_FAST_MATH_INLINE RealType sigmoid(RealType x) noexcept
+{
+    return A == Accuracy::Exact
+        ? RealType(1) / (RealType(1) + std::exp(-x))
+        : static_cast<RealType>(1.0 / (1.0 + expApprox<A == Accuracy::Precise>(-x)))
+    ;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Activating Hill function x^n / (K^n + x^n) for non-negative x.
+ *
+ * Repressing Hill function is 1 - hill(x, k, n) or hill(k, x, n).
+ *
+ * @tparam A Accuracy.
+ *
+ * @param x Concentration.
+ * @param k Half-activation constant.
+ * @param n Hill coefficient.
+ *
+ * @return
+ */
+template<Accuracy A = Accuracy::Precise>
+CECE_FAST_MATH_INLINE RealType hill(RealType x, RealType k, RealType n) noexcept
+{
+    constexpr bool P = A == Accuracy::Precise;
+
+    if (A == Accuracy::Exact)
+    {
+        const RealType xn = std::pow(x, n);
+        return xn / (std::pow(k, n) + xn);
+    }
+
+    // 1 / (1 + (K / x)^n)
+    return static_cast<RealType>(1.0 / (1.0 + expApprox<P>(n * (logApprox<P>(k) - logApprox<P>(x)))));
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate exponential function of array.
+ *
+ * Array functions use SIMD instructions selected by CPU at runtime for
+ * Fast and Precise accuracy. Output can be the same as input.
+ *
+ * @param in       Input values.
+ * @param out      Output values.
+ * @param count    Number of values.
+ * @param accuracy Required accuracy.
+ */
+void exp(const RealType* in, RealType* out, std::size_t count, Accuracy accuracy = Accuracy::Precise) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate natural logarithm of array.
+ *
+ * @param in       Input values.
+ * @param out      Output values.
+ * @param count    Number of values.
+ * @param accuracy Required accuracy.
+ */
+void log(const RealType* in, RealType* out, std::size_t count, Accuracy accuracy = Accuracy::Precise) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate power of array values.
+ *
+ * Approximations are defined for non-negative base only.
+ *
+ * @param in       Input base values.
+ * @param y        Exponent.
+ * @param out      Output values.
+ * @param count    Number of values.
+ * @param accuracy Required accuracy.
+ */
+void pow(const RealType* in, RealType y, RealType* out, std::size_t count, Accuracy accuracy = Accuracy::Precise) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate logistic sigmoid of array.
+ *
+ * @param in       Input values.
+ * @param out      Output values.
+ * @param count    Number of values.
+ * @param accuracy Required accuracy.
+ */
+void sigmoid(const RealType* in, RealType* out, std::size_t count, Accuracy accuracy = Accuracy::Precise) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate activating Hill function of array.
+ *
+ * @param in       Input concentrations.
+ * @param k        Half-activation constant.
+ * @param n        Hill coefficient.
+ * @param out      Output values.
+ * @param count    Number of values.
+ * @param accuracy Required accuracy.
+ */
+void hill(const RealType* in, RealType k, RealType n, RealType* out, std::size_t count,
+    Accuracy accuracy = Accuracy::Precise) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns instruction set used by array functions.
+ *
+ * @return "avx512f", "avx2" or "default".
+ */
+const char* getMathIsa() noexcept;
+
+/* ************************************************************************ */
+
+}
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,429 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/Float16.hpp"
+
+// C++
+#include <cstddef>
+
+// CeCe
+#include "cece/core/Macro.hpp"
+#include "cece/core/CpuFeatures.hpp"
+
+#ifdef CECE_CPU_DISPATCH
+#include <immintrin.h>
+#endif
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+static_assert(sizeof(Half) == 2, "Half must be 2 bytes");
+static_assert(sizeof(BFloat16) == 2, "BFloat16 must be 2 bytes");
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Number of values converted together.
+ *
+ * Constant block length lets the compiler vectorize the conversion loops
+ * without runtime trip count checks.
+ */
+constexpr std::size_t BLOCK_SIZE = 32;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Narrow value to float before rounding to 16 bits.
+ */
+CECE_FORCE_INLINE float narrowToFloat(float value) noexcept
+{
+    return value;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Narrow value to float before rounding to 16 bits, double is
+ * rounded to odd to prevent double rounding.
+ */
+CECE_FORCE_INLINE float narrowToFloat(double value) noexcept
+{
+    return roundToOddFloat(value);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert bfloat16 values in blocks.
+ */
+template<typename Out>
+CECE_FORCE_INLINE void bfloat16To(const BFloat16* in, Out* out, std::size_t count) noexcept
+{
+    const std::uint16_t* src = reinterpret_cast<const std::uint16_t*>(in);
+    std::size_t i = 0;
+
+    for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+    {
+        for (std::size_t j = 0; j < BLOCK_SIZE; ++j)
+            out[i + j] = bitsToFloat(static_cast<std::uint32_t>(src[i + j]) << 16);
+    }
+
+    for (; i < count; ++i)
+        out[i] = bitsToFloat(static_cast<std::uint32_t>(src[i]) << 16);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert float bits to bfloat16 bits without branches.
+ */
+CECE_FORCE_INLINE std::uint16_t toBFloat16Bits(std::uint32_t bits) noexcept
+{
+    const std::uint32_t rounded = (bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16;
+    const std::uint32_t quiet = (bits >> 16) | 0x40u;
+    return static_cast<std::uint16_t>((bits & 0x7fffffffu) > 0x7f800000u ? quiet : rounded);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert values to bfloat16 in blocks.
+ */
+template<typename In>
+CECE_FORCE_INLINE void bfloat16From(const In* in, BFloat16* out, std::size_t count) noexcept
+{
+    std::uint16_t* dst = reinterpret_cast<std::uint16_t*>(out);
+    std::size_t i = 0;
+
+    for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+    {
+        for (std::size_t j = 0; j < BLOCK_SIZE; ++j)
+            dst[i + j] = toBFloat16Bits(floatToBits(narrowToFloat(in[i + j])));
+    }
+
+    for (; i < count; ++i)
+        dst[i] = toBFloat16Bits(floatToBits(narrowToFloat(in[i])));
+}
+
+/* ************************************************************************ */
+
+template<typename Out>
+void bfloat16ToDefault(const BFloat16* in, Out* out, std::size_t count)
+{
+    bfloat16To(in, out, count);
+}
+
+/* ************************************************************************ */
+
+template<typename In>
+void bfloat16FromDefault(const In* in, BFloat16* out, std::size_t count)
+{
+    bfloat16From(in, out, count);
+}
+
+/* ************************************************************************ */
+
+#ifdef CECE_CPU_DISPATCH
+
+template<typename Out>
+CECE_TARGET("avx2")
+void bfloat16ToAvx2(const BFloat16* in, Out* out, std::size_t count)
+{
+    bfloat16To(in, out, count);
+}
+
+/* ************************************************************************ */
+
+template<typename In>
+CECE_TARGET("avx2")
+void bfloat16FromAvx2(const In* in, BFloat16* out, std::size_t count)
+{
+    bfloat16From(in, out, count);
+}
+
+#endif
+
+/* ************************************************************************ */
+
+template<typename Out>
+void halfToDefault(const Half* in, Out* out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = Half::toFloat(in[i].getBits());
+}
+
+/* ************************************************************************ */
+
+template<typename In>
+void halfFromDefault(const In* in, Half* out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = Half::fromBits(Half::fromFloat(narrowToFloat(in[i])));
+}
+
+/* ************************************************************************ */
+
+#ifdef CECE_CPU_DISPATCH
+
+CECE_TARGET("avx,f16c")
+void halfToFloatF16c(const Half* in, float* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(h));
+    }
+
+    halfToDefault(in + i, out + i, count - i);
+}
+
+/* ************************************************************************ */
+
+CECE_TARGET("avx,f16c")
+void halfToDoubleF16c(const Half* in, double* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m256 f = _mm256_cvtph_ps(h);
+        _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm256_castps256_ps128(f)));
+        _mm256_storeu_pd(out + i + 4, _mm256_cvtps_pd(_mm256_extractf128_ps(f, 1)));
+    }
+
+    halfToDefault(in + i, out + i, count - i);
+}
+
+/* ************************************************************************ */
+
+CECE_TARGET("avx,f16c")
+void halfFromFloatF16c(const float* in, Half* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), h);
+    }
+
+    halfFromDefault(in + i, out + i, count - i);
+}
+
+/* ************************************************************************ */
+
+CECE_TARGET("avx,f16c")
+void halfFromDoubleF16c(const double* in, Half* out, std::size_t count)
+{
+    std::size_t i = 0;
+
+    for (; i + 8 <= count; i += 8)
+    {
+        alignas(32) float narrowed[8];
+
+        for (std::size_t j = 0; j < 8; ++j)
+            narrowed[j] = narrowToFloat(in[i + j]);
+
+        const __m128i h = _mm256_cvtps_ph(_mm256_load_ps(narrowed), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), h);
+    }
+
+    halfFromDefault(in + i, out + i, count - i);
+}
+
+#endif
+
+/* ************************************************************************ */
+
+/**
+ * @brief Bulk conversion functions.
+ */
+struct Kernels
+{
+    /// Half to float.
+    void (*halfToFloat)(const Half*, float*, std::size_t);
+
+    /// Half to double.
+    void (*halfToDouble)(const Half*, double*, std::size_t);
+
+    /// Float to half.
+    void (*halfFromFloat)(const float*, Half*, std::size_t);
+
+    /// Double to half.
+    void (*halfFromDouble)(const double*, Half*, std::size_t);
+
+    /// BFloat16 to float.
+    void (*bfloat16ToFloat)(const BFloat16*, float*, std::size_t);
+
+    /// BFloat16 to double.
+    void (*bfloat16ToDouble)(const BFloat16*, double*, std::size_t);
+
+    /// Float to bfloat16.
+    void (*bfloat16FromFloat)(const float*, BFloat16*, std::size_t);
+
+    /// Double to bfloat16.
+    void (*bfloat16FromDouble)(const double*, BFloat16*, std::size_t);
+
+    /// Instruction set name.
+    const char* isa;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Select conversions for current CPU.
+ *
+ * @return
+ */
+Kernels selectKernels() noexcept
+{
+#ifdef CECE_CPU_DISPATCH
+    const bool f16c = hasCpuFeature(CpuFeature::Avx) && hasCpuFeature(CpuFeature::F16c);
+
+    if (f16c && hasCpuFeature(CpuFeature::Avx2))
+    {
+        return {
+            halfToFloatF16c, halfToDoubleF16c, halfFromFloatF16c, halfFromDoubleF16c,
+            bfloat16ToAvx2<float>, bfloat16ToAvx2<double>,
+            bfloat16FromAvx2<float>, bfloat16FromAvx2<double>, "avx2"
+        };
+    }
+
+    if (f16c)
+    {
+        return {
+            halfToFloatF16c, halfToDoubleF16c, halfFromFloatF16c, halfFromDoubleF16c,
+            bfloat16ToDefault<float>, bfloat16ToDefault<double>,
+            bfloat16FromDefault<float>, bfloat16FromDefault<double>, "f16c"
+        };
+    }
+#endif
+
+    return {
+        halfToDefault<float>, halfToDefault<double>,
+        halfFromDefault<float>, halfFromDefault<double>,
+        bfloat16ToDefault<float>, bfloat16ToDefault<double>,
+        bfloat16FromDefault<float>, bfloat16FromDefault<double>, "default"
+    };
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns conversions for current CPU.
+ *
+ * @return
+ */
+const Kernels& getKernels() noexcept
+{
+    static const Kernels kernels = selectKernels();
+    return kernels;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+void convertValues(const Half* in, float* out, std::size_t count) noexcept
+{
+    getKernels().halfToFloat(in, out, count);
+}
+
+/* ************************************************************************ */
+
+void convertValues(const Half* in, double* out, std::size_t count) noexcept
+{
+    getKernels().halfToDouble(in, out, count);
+}
+
+/* ************************************************************************ */
+
+void convertValues(const float* in, Half* out, std::size_t count) noexcept
+{
+    getKernels().halfFromFloat(in, out, count);
+}
+
+/* ************************************************************************ */
+
+void convertValues(const double* in, Half* out, std::size_t count) noexcept
+{
+    getKernels().halfFromDouble(in, out, count);
+}
+
+/* ************************************************************************ */
+
+void convertValues(const BFloat16* in, float* out, std::size_t count) noexcept
+{
+    getKernels().bfloat16ToFloat(in, out, count);
+}
+
+/* ************************************************************************ */
+
+void convertValues(const BFloat16* in, double* out, std::size_t count) noexcept
+{
+    getKernels().bfloat16ToDouble(in, out, count);
+}
+
+/* ************************************************************************ */
+
+void convertValues(const float* in, BFloat16* out, std::size_t count) noexcept
+{
+    getKernels().bfloat16FromFloat(in, out, count);
+}
+
+/* ************************************************************************ */
+
+void convertValues(const double* in, BFloat16* out, std::size_t count) noexcept
+{
+    getKernels().bfloat16FromDouble(in, out, count);
+}
+
+/* ************************************************************************ */
+
+const char* getFloat16Isa() noexcept
+{
+    return getKernels().isa;
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,667 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// CeCe
+#include "cece/core/Real.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Reinterpret float bits.
+ *
+ * @param value
+ *
+ * @return
+ */
+inline std::uint32_t floatToBits(float value) noexcept
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Reinterpret bits as float.
+ *
+ * @param bits
+ *
+ * @return
+ */
+inline float bitsToFloat(std::uint32_t bits) noexcept
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert double to float with round-to-odd.
+ *
+ * Inexact result is truncated towards zero and its lowest bit is set.
+ * Rounding such float to a type with at least two bits less precision
+ * gives the same result as rounding the double directly, a plain
+ * double to float conversion would round twice.
+ *
+ * @param value
+ *
+ * @return
+ */
+inline float roundToOddFloat(double value) noexcept
+{
+    const float rounded = static_cast<float>(value);
+    std::uint32_t bits = floatToBits(rounded);
+
+    // Rounded away from zero
+    if (std::fabs(static_cast<double>(rounded)) > std::fabs(value))
+        --bits;
+
+    if (static_cast<double>(bitsToFloat(bits)) != value)
+        bits |= 1u;
+
+    return bitsToFloat(bits);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief IEEE 754 half precision storage type.
+ *
+ * Intended as grid storage type only: values are converted from and to
+ * float with round-to-nearest-even, arithmetic is done in the wider type.
+ * Range is +-65504 with ~3 significant decimal digits.
+ */
+class Half
+{
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Default constructor, value is uninitialized.
+     */
+    Half() = default;
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param value
+     */
+    Half(float value) noexcept
+        : m_bits(fromFloat(value))
+    {
+        // Nothing to do
+    }
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param value
+     */
+    Half(double value) noexcept
+        : Half(roundToOddFloat(value))
+    {
+        // Nothing to do
+    }
+
+
+// Public Operators
+public:
+
+
+    /**
+     * @brief Convert to float.
+     *
+     * @return
+     */
+    operator float() const noexcept
+    {
+        return toFloat(m_bits);
+    }
+
+
+    /**
+     * @brief Add value.
+     *
+     * @param value
+     *
+     * @return
+     */
+    Half& operator+=(float value) noexcept
+    {
+        return *this = static_cast<float>(*this) + value;
+    }
+
+
+    /**
+     * @brief Subtract value.
+     *
+     * @param value
+     *
+     * @return
+     */
+    Half& operator-=(float value) noexcept
+    {
+        return *this = static_cast<float>(*this) - value;
+    }
+
+
+    /**
+     * @brief Multiply by value.
+     *
+     * @param value
+     *
+     * @return
+     */
+    Half& operator*=(float value) noexcept
+    {
+        return *this = static_cast<float>(*this) * value;
+    }
+
+
+    /**
+     * @brief Divide by value.
+     *
+     * @param value
+     *
+     * @return
+     */
+    Half& operator/=(float value) noexcept
+    {
+        return *this = static_cast<float>(*this) / value;
+    }
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns raw bits.
+     *
+     * @return
+     */
+    std::uint16_t getBits() const noexcept
+    {
+        return m_bits;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Create from raw bits.
+     *
+     * @param bits
+     *
+     * @return
+     */
+    static Half fromBits(std::uint16_t bits) noexcept
+    {
+        Half res;
+        res.m_bits = bits;
+        return res;
+    }
+
+
+    /**
+     * @brief Convert float to half bits (round to nearest even).
+     *
+     * @param value
+     *
+     * @return
+     *
+     * @see https://gist.github.com/rygorous/2156668
+     */
+    static std::uint16_t fromFloat(float value) noexcept
+    {
+        const std::uint32_t infinity = 255u << 23;
+        const std::uint32_t maximum = (127u + 16u) << 23;
+        const std::uint32_t denormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+        std::uint32_t bits = floatToBits(value);
+        const std::uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        std::uint32_t result;
+
+        if (bits >= maximum)
+        {
+            // Infinity or NaN
+            result = bits > infinity ? 0x7e00u : 0x7c00u;
+        }
+        else if (bits < (113u << 23))
+        {
+            // Subnormal or zero
+            result = floatToBits(bitsToFloat(bits) + bitsToFloat(denormMagic)) - denormMagic;
+        }
+        else
+        {
+            const std::uint32_t odd = (bits >> 13) & 1u;
+            bits += (static_cast<std::uint32_t>(15 - 127) << 23) + 0xfffu + odd;
+            result = bits >> 13;
+        }
+
+        return static_cast<std::uint16_t>(result | (sign >> 16));
+    }
+
+
+    /**
+     * @brief Convert half bits to float.
+     *
+     * @param value
+     *
+     * @return
+     */
+    static float toFloat(std::uint16_t value) noexcept
+    {
+        const std::uint32_t shiftedExp = 0x7c00u << 13;
+
+        std::uint32_t bits = (value & 0x7fffu) << 13;
+        const std::uint32_t exp = shiftedExp & bits;
+        bits += (127u - 15u) << 23;
+
+        if (exp == shiftedExp)
+        {
+            // Infinity or NaN
+            bits += (128u - 16u) << 23;
+        }
+        else if (exp == 0)
+        {
+            // Subnormal
+            bits += 1u << 23;
+            bits = floatToBits(bitsToFloat(bits) - bitsToFloat(113u << 23));
+        }
+
+        return bitsToFloat(bits | ((value & 0x8000u) << 16));
+    }
+
+
+// Private Data Members
+private:
+
+    /// Value bits.
+    std::uint16_t m_bits;
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Brain floating point (bfloat16) storage type.
+ *
+ * Upper half of float: same range as float with ~2 significant decimal
+ * digits. Conversion is just a shift, so it's cheaper than Half.
+ */
+class BFloat16
+{
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Default constructor, value is uninitialized.
+     */
+    BFloat16() = default;
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param value
+     */
+    BFloat16(float value) noexcept
+        : m_bits(fromFloat(value))
+    {
+        // Nothing to do
+    }
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param value
+     */
+    BFloat16(double value) noexcept
+        : BFloat16(roundToOddFloat(value))
+    {
+        // Nothing to do
+    }
+
+
+// Public Operators
+public:
+
+
+    /**
+     * @brief Convert to float.
+     *
+     * @return
+     */
+    operator float() const noexcept
+    {
+        return toFloat(m_bits);
+    }
+
+
+    /**
+     * @brief Add value.
+     *
+     * @param value
+     *
+     * @return
+     */
+    BFloat16& operator+=(float value) noexcept
+    {
+        return *this = static_cast<float>(*this) + value;
+    }
+
+
+    /**
+     * @brief Subtract value.
+     *
+     * @param value
+     *
+     * @return
+     */
+    BFloat16& operator-=(float value) noexcept
+    {
+        return *this = static_cast<float>(*this) - value;
+    }
+
+
+    /**
+     * @brief Multiply by value.
+     *
+     * @param value
+     *
+     * @return
+     */
+    BFloat16& operator*=(float value) noexcept
+    {
+        return *this = static_cast<float>(*this) * value;
+    }
+
+
+    /**
+     * @brief Divide by value.
+     *
+     * @param value
+     *
+     * @return
+     */
+    BFloat16& operator/=(float value) noexcept
+    {
+        return *this = static_cast<float>(*this) / value;
+    }
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns raw bits.
+     *
+     * @return
+     */
+    std::uint16_t getBits() const noexcept
+    {
+        return m_bits;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Create from raw bits.
+     *
+     * @param bits
+     *
+     * @return
+     */
+    static BFloat16 fromBits(std::uint16_t bits) noexcept
+    {
+        BFloat16 res;
+        res.m_bits = bits;
+        return res;
+    }
+
+
+    /**
+     * @brief Convert float to bfloat16 bits (round to nearest even).
+     *
+     * @param value
+     *
+     * @return
+     */
+    static std::uint16_t fromFloat(float value) noexcept
+    {
+        const std::uint32_t bits = floatToBits(value);
+
+        // Keep NaN quiet
+        if ((bits & 0x7fffffffu) > 0x7f800000u)
+            return static_cast<std::uint16_t>((bits >> 16) | 0x40u);
+
+        return static_cast<std::uint16_t>((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+    }
+
+
+    /**
+     * @brief Convert bfloat16 bits to float.
+     *
+     * @param value
+     *
+     * @return
+     */
+    static float toFloat(std::uint16_t value) noexcept
+    {
+        return bitsToFloat(static_cast<std::uint32_t>(value) << 16);
+    }
+
+
+// Private Data Members
+private:
+
+    /// Value bits.
+    std::uint16_t m_bits;
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Half values are accumulated at least in float.
+ */
+template<>
+struct AccumulatorType<Half>
+{
+    /// Accumulator type.
+    using type = std::common_type<float, AccumulatorRealType>::type;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief BFloat16 values are accumulated at least in float.
+ */
+template<>
+struct AccumulatorType<BFloat16>
+{
+    /// Accumulator type.
+    using type = std::common_type<float, AccumulatorRealType>::type;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of values between storage and compute types.
+ *
+ * Plain loop over contiguous memory, used to load grid rows into RealType
+ * buffers and store them back (e.g. float storage with double compute).
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+template<typename In, typename Out>
+inline void convertValues(const In* in, Out* out, std::size_t count) noexcept
+{
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = static_cast<Out>(in[i]);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of half values.
+ *
+ * Uses F16C instructions when the CPU supports them.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+void convertValues(const Half* in, float* out, std::size_t count) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of half values.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+void convertValues(const Half* in, double* out, std::size_t count) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of values to half.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+void convertValues(const float* in, Half* out, std::size_t count) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of values to half.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+void convertValues(const double* in, Half* out, std::size_t count) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of bfloat16 values.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+void convertValues(const BFloat16* in, float* out, std::size_t count) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of bfloat16 values.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+void convertValues(const BFloat16* in, double* out, std::size_t count) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of values to bfloat16.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+void convertValues(const float* in, BFloat16* out, std::size_t count) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert array of values to bfloat16.
+ *
+ * @param in    Input values.
+ * @param out   Output values.
+ * @param count Number of values.
+ */
+void convertValues(const double* in, BFloat16* out, std::size_t count) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns instruction set used by bulk conversions.
+ *
+ * @return "avx2", "f16c" or "default".
+ */
+const char* getFloat16Isa() noexcept;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
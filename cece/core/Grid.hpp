@@ -28,9 +28,11 @@
 /* ************************************************************************ */
 
 // CeCe
+#include "cece/core/Real.hpp"
 #include "cece/core/Vector.hpp"
 #include "cece/core/DynamicArray.hpp"
 #include "cece/core/AlignedAllocator.hpp"
+#include "cece/core/GridLayout.hpp"
 
 /* ************************************************************************ */
 
@@ -42,13 +44,22 @@ inline namespace core {
 /**
  * @brief Class for storing data in grid.
  *
- * Data is stored in linear array in layout where each row is together,
- * e.g. <row0><row1>...
+ * Data is stored in linear array in layout given by layout policy. The
+ * default layout stores each row together, e.g. <row0><row1>...
+ * (see GridLayout.hpp for tiled and Morton layouts).
  *
- * @tparam T     Stored value type.
- * @tparam Alloc Type of used allocator.
+ * Iterators and getData() traverse the storage in layout order including
+ * padding cells of non row-major layouts. Use forEach() to visit only grid
+ * cells together with their coordinates.
+ *
+ * Number of dimensions is given by the layout coordinate type, the 2D
+ * layouts use Vector<SizeType> and the 3D ones BasicVector<SizeType, 3>.
+ *
+ * @tparam T      Stored value type.
+ * @tparam Alloc  Type of used allocator.
+ * @tparam Layout Layout policy.
  */
-template<typename T, typename Alloc = AlignedAllocator<T>>
+template<typename T, typename Alloc = AlignedAllocator<T>, typename Layout = GridLayoutRowMajor>
 class Grid
 {
 
@@ -69,6 +80,12 @@ public:
     using AllocatorType = Alloc;
 
 
+    /**
+     * @brief Layout type.
+     */
+    using LayoutType = Layout;
+
+
     /**
      * @brief Size type.
      */
@@ -84,7 +101,7 @@ public:
     /**
      * @brief Coordinates type.
      */
-    using CoordinateType = Vector<SizeType>;
+    using CoordinateType = typename LayoutType::CoordinateType;
 
 
 // Public Ctors & Dtors
@@ -102,7 +119,32 @@ public:
      *
      * @param size
      */
-    explicit Grid(Vector<SizeType> size)
+    explicit Grid(CoordinateType size)
+    {
+        resize(std::move(size));
+    }
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param alloc Allocator.
+     */
+    explicit Grid(const AllocatorType& alloc)
+        : m_data(alloc)
+    {
+        // Nothing to do
+    }
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param size
+     * @param alloc Allocator.
+     */
+    Grid(CoordinateType size, const AllocatorType& alloc)
+        : m_data(alloc)
     {
         resize(std::move(size));
     }
@@ -114,7 +156,7 @@ public:
      * @param size
      */
     explicit Grid(SizeType size)
-        : Grid(Vector<SizeType>::createSingle(size))
+        : Grid(CoordinateType::createSingle(size))
     {
         // Nothing to do
     }
@@ -185,7 +227,7 @@ public:
      *
      * @return
      */
-    const Vector<SizeType>& getSize() const noexcept
+    const CoordinateType& getSize() const noexcept
     {
         return m_size;
     }
@@ -224,9 +266,23 @@ public:
     }
 
 
+    /**
+     * @brief Returns allocator.
+     *
+     * @return
+     */
+    AllocatorType getAllocator() const noexcept
+    {
+        return m_data.get_allocator();
+    }
+
+
     /**
      * @brief Returns begin iterator.
      *
+     * Iterates the storage including padding cells of tiled and Morton
+     * layouts, use forEach() to visit only grid cells.
+     *
      * @return
      */
     typename ContainerType::iterator begin() noexcept
@@ -238,6 +294,9 @@ public:
     /**
      * @brief Returns begin constant iterator.
      *
+     * Iterates the storage including padding cells of tiled and Morton
+     * layouts, use forEach() to visit only grid cells.
+     *
      * @return
      */
     typename ContainerType::const_iterator begin() const noexcept
@@ -249,6 +308,9 @@ public:
     /**
      * @brief Returns begin constant iterator.
      *
+     * Iterates the storage including padding cells of tiled and Morton
+     * layouts, use forEach() to visit only grid cells.
+     *
      * @return
      */
     typename ContainerType::const_iterator cbegin() const noexcept
@@ -260,6 +322,9 @@ public:
     /**
      * @brief Returns end iterator.
      *
+     * Iterates the storage including padding cells of tiled and Morton
+     * layouts, use forEach() to visit only grid cells.
+     *
      * @return
      */
     typename ContainerType::iterator end() noexcept
@@ -271,6 +336,9 @@ public:
     /**
      * @brief Returns end constant iterator.
      *
+     * Iterates the storage including padding cells of tiled and Morton
+     * layouts, use forEach() to visit only grid cells.
+     *
      * @return
      */
     typename ContainerType::const_iterator end() const noexcept
@@ -282,6 +350,9 @@ public:
     /**
      * @brief Returns end constant iterator.
      *
+     * Iterates the storage including padding cells of tiled and Morton
+     * layouts, use forEach() to visit only grid cells.
+     *
      * @return
      */
     typename ContainerType::const_iterator cend() const noexcept
@@ -301,7 +372,7 @@ public:
      */
     void resize(SizeType size)
     {
-        resize(Vector<SizeType>::createSingle(size));
+        resize(CoordinateType::createSingle(size));
     }
 
 
@@ -313,7 +384,7 @@ public:
      */
     void resize(SizeType size, const ValueType& value)
     {
-        resize(Vector<SizeType>::createSingle(size), value);
+        resize(CoordinateType::createSingle(size), value);
     }
 
 
@@ -322,10 +393,10 @@ public:
      *
      * @param size New size of the grid.
      */
-    void resize(Vector<SizeType> size)
+    void resize(CoordinateType size)
     {
         m_size = std::move(size);
-        m_data.resize(m_size.getWidth() * m_size.getHeight());
+        m_data.resize(LayoutType::calcCapacity(m_size));
     }
 
 
@@ -335,10 +406,10 @@ public:
      * @param size  New size of the grid.
      * @param value The value to initialize the new elements with.
      */
-    void resize(Vector<SizeType> size, const ValueType& value)
+    void resize(CoordinateType size, const ValueType& value)
     {
         m_size = std::move(size);
-        m_data.resize(m_size.getWidth() * m_size.getHeight(), value);
+        m_data.resize(LayoutType::calcCapacity(m_size), value);
     }
 
 
@@ -353,12 +424,7 @@ public:
     {
         // Unsigned type for SizeType is allways greater than or equal to zero,
         // the optimizer should remove that checks
-        return
-            coord.getX() >= 0 &&
-            coord.getY() >= 0 &&
-            coord.getX() < getSize().getWidth() &&
-            coord.getY() < getSize().getHeight()
-        ;
+        return coord.inRange(CoordinateType::createSingle(0), getSize());
     }
 
 
@@ -371,7 +437,104 @@ public:
      */
     SizeType calcOffset(const CoordinateType& coord) const noexcept
     {
-        return coord.getX() + coord.getY() * getSize().getWidth();
+        return LayoutType::calcOffset(getSize(), coord);
+    }
+
+
+    /**
+     * @brief Calculate coordinates from array offset.
+     *
+     * @param offset
+     *
+     * @return
+     */
+    CoordinateType calcCoordinate(SizeType offset) const noexcept
+    {
+        return LayoutType::calcCoordinate(getSize(), offset);
+    }
+
+
+    /**
+     * @brief Calculate array offset of neighbour cell.
+     *
+     * It's cheaper than calcOffset() when the cell offset is known, e.g.
+     * in stencil operations inside forEachOffset().
+     *
+     * @tparam DX Step in x direction: -1, 0 or 1.
+     * @tparam DY Step in y direction: -1, 0 or 1.
+     *
+     * @param coord  Cell coordinates.
+     * @param offset Cell array offset.
+     *
+     * @return Neighbour offset, neighbour must be in grid range.
+     */
+    template<int DX, int DY>
+    SizeType calcNeighbourOffset(const CoordinateType& coord, SizeType offset) const noexcept
+    {
+        return LayoutType::template calcNeighbourOffset<DX, DY>(getSize(), coord, offset);
+    }
+
+
+    /**
+     * @brief Calculate array offset of neighbour cell in 3D grid.
+     *
+     * @tparam DX Step in x direction: -1, 0 or 1.
+     * @tparam DY Step in y direction: -1, 0 or 1.
+     * @tparam DZ Step in z direction: -1, 0 or 1.
+     *
+     * @param coord  Cell coordinates.
+     * @param offset Cell array offset.
+     *
+     * @return Neighbour offset, neighbour must be in grid range.
+     */
+    template<int DX, int DY, int DZ>
+    SizeType calcNeighbourOffset(const CoordinateType& coord, SizeType offset) const noexcept
+    {
+        return LayoutType::template calcNeighbourOffset<DX, DY, DZ>(getSize(), coord, offset);
+    }
+
+
+    /**
+     * @brief Call function for each grid cell in storage order.
+     *
+     * @param fn Function called with cell coordinates and array offset.
+     */
+    template<typename Fn>
+    void forEachOffset(Fn fn) const
+    {
+        LayoutType::forEach(getSize(), fn);
+    }
+
+
+    /**
+     * @brief Call function for each grid cell in storage order.
+     *
+     * @param fn Function called with cell coordinates and value reference.
+     */
+    template<typename Fn>
+    void forEach(Fn fn)
+    {
+        auto data = m_data.data();
+
+        LayoutType::forEach(getSize(), [data, &fn] (const CoordinateType& coord, SizeType offset) {
+            fn(coord, data[offset]);
+        });
+    }
+
+
+    /**
+     * @brief Call function for each grid cell in storage order.
+     *
+     * @param fn Function called with cell coordinates and value reference.
+     */
+    template<typename Fn>
+    void forEach(Fn fn) const
+    {
+        auto data = m_data.data();
+
+        LayoutType::forEach(getSize(), [data, &fn] (const CoordinateType& coord, SizeType offset) {
+            fn(coord, data[offset]);
+        });
     }
 
 
@@ -382,12 +545,41 @@ private:
     ContainerType m_data;
 
     /// Grid size
-    Vector<SizeType> m_size;
+    CoordinateType m_size;
 
 };
 
 /* ************************************************************************ */
 
+/**
+ * @brief 3D grid.
+ *
+ * Row-major layout is the fastest for sweeps in storage order, use
+ * GridLayoutBlocked3 when the grid is accessed mostly across slices.
+ *
+ * @tparam T      Stored value type.
+ * @tparam Alloc  Type of used allocator.
+ * @tparam Layout 3D layout policy.
+ */
+template<typename T, typename Alloc = AlignedAllocator<T>, typename Layout = GridLayoutRowMajor3>
+using Grid3 = Grid<T, Alloc, Layout>;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid of real values in storage precision.
+ */
+using RealGrid = Grid<StorageRealType>;
+
+/* ************************************************************************ */
+
+/**
+ * @brief 3D grid of real values in storage precision.
+ */
+using RealGrid3 = Grid3<StorageRealType>;
+
+/* ************************************************************************ */
+
 }
 }
 
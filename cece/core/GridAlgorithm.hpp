@@ -0,0 +1,332 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+
+// CeCe
+#include "cece/core/Assert.hpp"
+#include "cece/core/Real.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Grid.hpp"
+#include "cece/core/ThreadPool.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+namespace parallel {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Approximate number of cells processed by one task.
+ */
+constexpr unsigned int BAND_CELLS = 16384;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate number of rows in one band.
+ *
+ * Partitioning depends only on grid size, never on number of threads, so
+ * reductions give bit-identical results on every machine.
+ *
+ * @param size Grid size.
+ *
+ * @return
+ */
+inline unsigned int calcBandRows(const Vector<unsigned int>& size) noexcept
+{
+    return std::max(BAND_CELLS / std::max(size.getWidth(), 1u), 1u);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate number of bands.
+ *
+ * @param size Grid size.
+ *
+ * @return
+ */
+inline unsigned int calcBandCount(const Vector<unsigned int>& size) noexcept
+{
+    if (size.getWidth() == 0)
+        return 0;
+
+    const auto rows = calcBandRows(size);
+    return (size.getHeight() + rows - 1) / rows;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Call function for row bands in parallel.
+ *
+ * @param size Grid size.
+ * @param fn   Function called with band index, first row and end row.
+ * @param pool Thread pool.
+ */
+template<typename Fn>
+void forEachBand(const Vector<unsigned int>& size, Fn fn, ThreadPool& pool = ThreadPool::getDefault())
+{
+    const auto rows = calcBandRows(size);
+    const auto height = size.getHeight();
+
+    pool.run(calcBandCount(size), [&fn, rows, height] (std::size_t band) {
+        const auto begin = static_cast<unsigned int>(band) * rows;
+        fn(band, begin, std::min(begin + rows, height));
+    });
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Call function for row bands in parallel.
+ *
+ * @param size Grid size.
+ * @param fn   Function called with first row and end row.
+ * @param pool Thread pool.
+ */
+template<typename Fn>
+void forEachRowBand(const Vector<unsigned int>& size, Fn fn, ThreadPool& pool = ThreadPool::getDefault())
+{
+    forEachBand(size, [&fn] (std::size_t, unsigned int begin, unsigned int end) {
+        fn(begin, end);
+    }, pool);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Call function for every grid cell in parallel.
+ *
+ * @param grid Grid.
+ * @param fn   Function called with cell coordinates and value reference.
+ * @param pool Thread pool.
+ */
+template<typename T, typename Alloc, typename Layout, typename Fn>
+void forEachCell(Grid<T, Alloc, Layout>& grid, Fn fn, ThreadPool& pool = ThreadPool::getDefault())
+{
+    using CoordinateType = typename Grid<T, Alloc, Layout>::CoordinateType;
+    const auto width = grid.getSize().getWidth();
+
+    forEachRowBand(grid.getSize(), [&grid, &fn, width] (unsigned int begin, unsigned int end) {
+        for (unsigned int y = begin; y < end; ++y)
+        {
+            for (unsigned int x = 0; x < width; ++x)
+            {
+                const CoordinateType coord{x, y};
+                fn(coord, grid[coord]);
+            }
+        }
+    }, pool);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Set all grid cells to value in parallel.
+ *
+ * @param grid  Grid.
+ * @param value Value.
+ * @param pool  Thread pool.
+ */
+template<typename T, typename Alloc, typename Layout>
+void fill(Grid<T, Alloc, Layout>& grid, const T& value, ThreadPool& pool = ThreadPool::getDefault())
+{
+    forEachCell(grid, [&value] (const typename Grid<T, Alloc, Layout>::CoordinateType&, T& cell) {
+        cell = value;
+    }, pool);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Store function result for every input cell into output grid.
+ *
+ * Output grid is resized to input size.
+ *
+ * @param in   Input grid.
+ * @param out  Output grid, may be the same as input.
+ * @param fn   Function called with input value.
+ * @param pool Thread pool.
+ */
+template<typename T, typename AllocT, typename LayoutT, typename U, typename AllocU, typename LayoutU, typename Fn>
+void transform(const Grid<T, AllocT, LayoutT>& in, Grid<U, AllocU, LayoutU>& out, Fn fn,
+    ThreadPool& pool = ThreadPool::getDefault())
+{
+    if (out.getSize() != in.getSize())
+        out.resize(in.getSize());
+
+    forEachCell(out, [&in, &fn] (const typename Grid<U, AllocU, LayoutU>::CoordinateType& coord, U& value) {
+        value = fn(in[coord]);
+    }, pool);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Store function result for every pair of input cells into output grid.
+ *
+ * Output grid is resized to input size.
+ *
+ * @param first  First input grid.
+ * @param second Second input grid, must have same size as the first one.
+ * @param out    Output grid, may be the same as one of inputs.
+ * @param fn     Function called with input values.
+ * @param pool   Thread pool.
+ */
+template<typename T1, typename A1, typename L1, typename T2, typename A2, typename L2,
+    typename U, typename AllocU, typename LayoutU, typename Fn>
+void zipTransform(const Grid<T1, A1, L1>& first, const Grid<T2, A2, L2>& second,
+    Grid<U, AllocU, LayoutU>& out, Fn fn, ThreadPool& pool = ThreadPool::getDefault())
+{
+    CECE_ASSERT(first.getSize() == second.getSize());
+
+    if (out.getSize() != first.getSize())
+        out.resize(first.getSize());
+
+    forEachCell(out, [&first, &second, &fn] (const typename Grid<U, AllocU, LayoutU>::CoordinateType& coord, U& value) {
+        value = fn(first[coord], second[coord]);
+    }, pool);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Reduce grid values.
+ *
+ * Every band is reduced in row-major order and band results are combined
+ * in band order with initial value first, so floating point results don't
+ * depend on number of threads or scheduling.
+ *
+ * @param grid Grid.
+ * @param init Initial value.
+ * @param op   Binary reduction operation.
+ * @param pool Thread pool.
+ *
+ * @return
+ */
+template<typename T, typename Alloc, typename Layout, typename R, typename Op>
+R reduce(const Grid<T, Alloc, Layout>& grid, R init, Op op, ThreadPool& pool = ThreadPool::getDefault())
+{
+    using CoordinateType = typename Grid<T, Alloc, Layout>::CoordinateType;
+    const auto width = grid.getSize().getWidth();
+    DynamicArray<R> partial(calcBandCount(grid.getSize()), init);
+
+    forEachBand(grid.getSize(), [&] (std::size_t band, unsigned int begin, unsigned int end) {
+        R result = grid[CoordinateType{0, begin}];
+
+        for (unsigned int y = begin; y < end; ++y)
+        {
+            for (unsigned int x = (y == begin ? 1 : 0); x < width; ++x)
+                result = op(result, grid[CoordinateType{x, y}]);
+        }
+
+        partial[band] = result;
+    }, pool);
+
+    for (const auto& value : partial)
+        init = op(init, value);
+
+    return init;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns sum of grid values.
+ *
+ * Values are summed in accumulator type so grids stored in reduced
+ * precision don't lose accuracy.
+ *
+ * @param grid Grid.
+ * @param pool Thread pool.
+ *
+ * @return
+ */
+template<typename T, typename Alloc, typename Layout>
+typename AccumulatorType<T>::type reduceSum(const Grid<T, Alloc, Layout>& grid,
+    ThreadPool& pool = ThreadPool::getDefault())
+{
+    using ResultType = typename AccumulatorType<T>::type;
+
+    return reduce(grid, ResultType{}, std::plus<ResultType>{}, pool);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns minimum grid value.
+ *
+ * @param grid Non-empty grid.
+ * @param pool Thread pool.
+ *
+ * @return
+ */
+template<typename T, typename Alloc, typename Layout>
+T reduceMin(const Grid<T, Alloc, Layout>& grid, ThreadPool& pool = ThreadPool::getDefault())
+{
+    CECE_ASSERT(grid.getSize().getWidth() > 0 && grid.getSize().getHeight() > 0);
+
+    return reduce(grid, grid[typename Grid<T, Alloc, Layout>::CoordinateType{0, 0}],
+        [] (const T& lhs, const T& rhs) { return std::min(lhs, rhs); }, pool);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns maximum grid value.
+ *
+ * @param grid Non-empty grid.
+ * @param pool Thread pool.
+ *
+ * @return
+ */
+template<typename T, typename Alloc, typename Layout>
+T reduceMax(const Grid<T, Alloc, Layout>& grid, ThreadPool& pool = ThreadPool::getDefault())
+{
+    CECE_ASSERT(grid.getSize().getWidth() > 0 && grid.getSize().getHeight() > 0);
+
+    return reduce(grid, grid[typename Grid<T, Alloc, Layout>::CoordinateType{0, 0}],
+        [] (const T& lhs, const T& rhs) { return std::max(lhs, rhs); }, pool);
+}
+
+/* ************************************************************************ */
+
+}
+}
+}
+
+/* ************************************************************************ */
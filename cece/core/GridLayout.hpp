@@ -0,0 +1,964 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <algorithm>
+
+// CeCe
+#include "cece/core/Assert.hpp"
+#include "cece/core/Vector.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid layout where each row is stored together, e.g. <row0><row1>...
+ *
+ * Layout policy maps grid coordinates to storage offsets and back. Grid
+ * passes its size to every call so the policies are stateless.
+ */
+struct GridLayoutRowMajor
+{
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = unsigned int;
+
+
+    /**
+     * @brief Coordinates type.
+     */
+    using CoordinateType = Vector<SizeType>;
+
+
+    /**
+     * @brief Returns number of stored cells for grid size.
+     *
+     * @param size Grid size.
+     *
+     * @return
+     */
+    static SizeType calcCapacity(const Vector<SizeType>& size) noexcept
+    {
+        return size.getWidth() * size.getHeight();
+    }
+
+
+    /**
+     * @brief Calculate storage offset.
+     *
+     * @param size  Grid size.
+     * @param coord Cell coordinates.
+     *
+     * @return
+     */
+    static SizeType calcOffset(const Vector<SizeType>& size, const CoordinateType& coord) noexcept
+    {
+        return coord.getX() + coord.getY() * size.getWidth();
+    }
+
+
+    /**
+     * @brief Calculate cell coordinates from storage offset.
+     *
+     * @param size   Grid size.
+     * @param offset Storage offset.
+     *
+     * @return
+     */
+    static CoordinateType calcCoordinate(const Vector<SizeType>& size, SizeType offset) noexcept
+    {
+        return {offset % size.getWidth(), offset / size.getWidth()};
+    }
+
+
+    /**
+     * @brief Calculate storage offset of neighbour cell.
+     *
+     * @tparam DX Step in x direction: -1, 0 or 1.
+     * @tparam DY Step in y direction: -1, 0 or 1.
+     *
+     * @param size   Grid size.
+     * @param coord  Cell coordinates.
+     * @param offset Cell storage offset.
+     *
+     * @return Neighbour offset, neighbour must be in grid range.
+     */
+    template<int DX, int DY>
+    static SizeType calcNeighbourOffset(const Vector<SizeType>& size, const CoordinateType&, SizeType offset) noexcept
+    {
+        return offset + DX + DY * static_cast<int>(size.getWidth());
+    }
+
+
+    /**
+     * @brief Call function for each cell in storage order.
+     *
+     * @param size Grid size.
+     * @param fn   Function called with cell coordinates and storage offset.
+     */
+    template<typename Fn>
+    static void forEach(const Vector<SizeType>& size, Fn fn)
+    {
+        SizeType offset = 0;
+
+        for (SizeType y = 0; y < size.getHeight(); ++y)
+            for (SizeType x = 0; x < size.getWidth(); ++x)
+                fn(CoordinateType{x, y}, offset++);
+    }
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid layout where cells are grouped into square tiles stored
+ * together, tiles are stored in row-major order.
+ *
+ * Neighbouring cells in both directions are mostly in the same tile so
+ * stencil operations touch fewer cache lines than with row-major layout.
+ * Storage is padded to whole tiles, the padding cells are not accessible
+ * by coordinates.
+ *
+ * @tparam TileSize Tile width and height, must be power of two.
+ */
+template<unsigned int TileSize = 8>
+struct GridLayoutTiled
+{
+    static_assert(TileSize > 0 && (TileSize & (TileSize - 1)) == 0, "Tile size must be power of two");
+
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = unsigned int;
+
+
+    /**
+     * @brief Coordinates type.
+     */
+    using CoordinateType = Vector<SizeType>;
+
+
+    /**
+     * @brief Tile width and height.
+     */
+    static constexpr SizeType TILE_SIZE = TileSize;
+
+
+    /**
+     * @brief Number of cells in a tile.
+     */
+    static constexpr SizeType TILE_CELLS = TileSize * TileSize;
+
+
+    /**
+     * @brief Returns number of tiles in each direction.
+     *
+     * @param size Grid size.
+     *
+     * @return
+     */
+    static Vector<SizeType> calcTiles(const Vector<SizeType>& size) noexcept
+    {
+        return {
+            (size.getWidth() + TileSize - 1) / TileSize,
+            (size.getHeight() + TileSize - 1) / TileSize
+        };
+    }
+
+
+    /**
+     * @brief Returns number of stored cells for grid size.
+     *
+     * @param size Grid size.
+     *
+     * @return
+     */
+    static SizeType calcCapacity(const Vector<SizeType>& size) noexcept
+    {
+        const auto tiles = calcTiles(size);
+        return tiles.getWidth() * tiles.getHeight() * TILE_CELLS;
+    }
+
+
+    /**
+     * @brief Calculate storage offset.
+     *
+     * @param size  Grid size.
+     * @param coord Cell coordinates.
+     *
+     * @return
+     */
+    static SizeType calcOffset(const Vector<SizeType>& size, const CoordinateType& coord) noexcept
+    {
+        const SizeType tilesX = (size.getWidth() + TileSize - 1) / TileSize;
+        const SizeType tile = (coord.getY() / TileSize) * tilesX + coord.getX() / TileSize;
+        const SizeType inner = (coord.getY() % TileSize) * TileSize + coord.getX() % TileSize;
+
+        return tile * TILE_CELLS + inner;
+    }
+
+
+    /**
+     * @brief Calculate cell coordinates from storage offset.
+     *
+     * @param size   Grid size.
+     * @param offset Storage offset.
+     *
+     * @return Coordinates, they can be out of grid range for padding cells.
+     */
+    static CoordinateType calcCoordinate(const Vector<SizeType>& size, SizeType offset) noexcept
+    {
+        const SizeType tilesX = (size.getWidth() + TileSize - 1) / TileSize;
+        const SizeType tile = offset / TILE_CELLS;
+        const SizeType inner = offset % TILE_CELLS;
+
+        return {
+            (tile % tilesX) * TileSize + inner % TileSize,
+            (tile / tilesX) * TileSize + inner / TileSize
+        };
+    }
+
+
+    /**
+     * @brief Calculate storage offset of neighbour cell.
+     *
+     * Inside a tile it's a constant step, only cells on tile border step
+     * into the neighbour tile.
+     *
+     * @tparam DX Step in x direction: -1, 0 or 1.
+     * @tparam DY Step in y direction: -1, 0 or 1.
+     *
+     * @param size   Grid size.
+     * @param coord  Cell coordinates.
+     * @param offset Cell storage offset.
+     *
+     * @return Neighbour offset, neighbour must be in grid range.
+     */
+    template<int DX, int DY>
+    static SizeType calcNeighbourOffset(const Vector<SizeType>& size, const CoordinateType& coord, SizeType offset) noexcept
+    {
+        if (DX > 0)
+            offset += (coord.getX() + 1) % TileSize ? 1 : TILE_CELLS - (TileSize - 1);
+        else if (DX < 0)
+            offset -= coord.getX() % TileSize ? 1 : TILE_CELLS - (TileSize - 1);
+
+        if (DY != 0)
+        {
+            const SizeType tilesX = (size.getWidth() + TileSize - 1) / TileSize;
+            const SizeType rowStep = tilesX * TILE_CELLS - (TileSize - 1) * TileSize;
+
+            if (DY > 0)
+                offset += (coord.getY() + 1) % TileSize ? TileSize : rowStep;
+            else
+                offset -= coord.getY() % TileSize ? TileSize : rowStep;
+        }
+
+        return offset;
+    }
+
+
+    /**
+     * @brief Call function for each cell in storage order, tile by tile.
+     * Padding cells are skipped.
+     *
+     * @param size Grid size.
+     * @param fn   Function called with cell coordinates and storage offset.
+     */
+    template<typename Fn>
+    static void forEach(const Vector<SizeType>& size, Fn fn)
+    {
+        const auto tiles = calcTiles(size);
+        SizeType offset = 0;
+
+        for (SizeType ty = 0; ty < tiles.getHeight(); ++ty)
+        {
+            for (SizeType tx = 0; tx < tiles.getWidth(); ++tx)
+            {
+                const SizeType x0 = tx * TileSize;
+                const SizeType y0 = ty * TileSize;
+
+                // Whole tile
+                if (x0 + TileSize <= size.getWidth() && y0 + TileSize <= size.getHeight())
+                {
+                    for (SizeType y = y0; y < y0 + TileSize; ++y)
+                        for (SizeType x = x0; x < x0 + TileSize; ++x)
+                            fn(CoordinateType{x, y}, offset++);
+                }
+                else
+                {
+                    for (SizeType y = y0; y < y0 + TileSize; ++y)
+                    {
+                        for (SizeType x = x0; x < x0 + TileSize; ++x, ++offset)
+                        {
+                            if (x < size.getWidth() && y < size.getHeight())
+                                fn(CoordinateType{x, y}, offset);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+};
+
+/* ************************************************************************ */
+
+template<unsigned int TileSize>
+constexpr typename GridLayoutTiled<TileSize>::SizeType GridLayoutTiled<TileSize>::TILE_SIZE;
+
+/* ************************************************************************ */
+
+template<unsigned int TileSize>
+constexpr typename GridLayoutTiled<TileSize>::SizeType GridLayoutTiled<TileSize>::TILE_CELLS;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid layout in Morton (Z-order) curve tiled into square blocks.
+ *
+ * Cells inside a block are stored in Morton order, blocks are stored in
+ * row-major order. Locality is preserved at all scales up to the block
+ * size. Block side is BlockSize or the smaller grid dimension rounded up to
+ * power of two when the grid is thinner, so the storage is padded to whole
+ * blocks only, not to a power of two square covering the grid.
+ *
+ * @tparam BlockSize Maximum block width and height, must be power of two.
+ */
+template<unsigned int BlockSize = 64>
+struct GridLayoutMorton
+{
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "Block size must be power of two");
+    static_assert(BlockSize <= 0x10000, "Block coordinates are limited to 16 bits");
+
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = unsigned int;
+
+
+    /**
+     * @brief Coordinates type.
+     */
+    using CoordinateType = Vector<SizeType>;
+
+
+    /**
+     * @brief Maximum block width and height.
+     */
+    static constexpr SizeType BLOCK_SIZE = BlockSize;
+
+
+    /**
+     * @brief Spread lower 16 bits to even bits.
+     *
+     * Only coordinates inside a block are spread so 16 bits are enough.
+     *
+     * @param value Value in range [0, 0xFFFF].
+     *
+     * @return
+     */
+    static SizeType spreadBits(SizeType value) noexcept
+    {
+        CECE_ASSERT(value <= 0xFFFF);
+
+        value = (value | (value << 8)) & 0x00FF00FF;
+        value = (value | (value << 4)) & 0x0F0F0F0F;
+        value = (value | (value << 2)) & 0x33333333;
+        value = (value | (value << 1)) & 0x55555555;
+        return value;
+    }
+
+
+    /**
+     * @brief Compact even bits into lower 16 bits.
+     *
+     * @param value
+     *
+     * @return
+     */
+    static SizeType compactBits(SizeType value) noexcept
+    {
+        value &= 0x55555555;
+        value = (value | (value >> 1)) & 0x33333333;
+        value = (value | (value >> 2)) & 0x0F0F0F0F;
+        value = (value | (value >> 4)) & 0x00FF00FF;
+        value = (value | (value >> 8)) & 0x0000FFFF;
+        return value;
+    }
+
+
+    /**
+     * @brief Returns block side for grid size.
+     *
+     * @param size Grid size.
+     *
+     * @return
+     */
+    static SizeType calcBlockSide(const Vector<SizeType>& size) noexcept
+    {
+        const SizeType min = std::min(size.getWidth(), size.getHeight());
+
+        if (min >= BlockSize)
+            return BlockSize;
+
+        // Round up to power of two
+        SizeType side = min > 0 ? min - 1 : 0;
+        side |= side >> 1;
+        side |= side >> 2;
+        side |= side >> 4;
+        side |= side >> 8;
+        side |= side >> 16;
+        return side + 1;
+    }
+
+
+    /**
+     * @brief Returns number of blocks in each direction.
+     *
+     * @param size Grid size.
+     * @param side Block side.
+     *
+     * @return
+     */
+    static Vector<SizeType> calcBlocks(const Vector<SizeType>& size, SizeType side) noexcept
+    {
+        return {
+            (size.getWidth() + side - 1) / side,
+            (size.getHeight() + side - 1) / side
+        };
+    }
+
+
+    /**
+     * @brief Returns number of stored cells for grid size.
+     *
+     * @param size Grid size.
+     *
+     * @return
+     */
+    static SizeType calcCapacity(const Vector<SizeType>& size) noexcept
+    {
+        if (size.getWidth() == 0 || size.getHeight() == 0)
+            return 0;
+
+        const auto side = calcBlockSide(size);
+        const auto blocks = calcBlocks(size, side);
+        return blocks.getWidth() * blocks.getHeight() * side * side;
+    }
+
+
+    /**
+     * @brief Calculate storage offset.
+     *
+     * @param size  Grid size.
+     * @param coord Cell coordinates.
+     *
+     * @return
+     */
+    static SizeType calcOffset(const Vector<SizeType>& size, const CoordinateType& coord) noexcept
+    {
+        const SizeType side = calcBlockSide(size);
+        const SizeType blocksX = (size.getWidth() + side - 1) / side;
+        const SizeType block = (coord.getY() / side) * blocksX + coord.getX() / side;
+        const SizeType mask = side - 1;
+
+        return block * side * side
+            + (spreadBits(coord.getX() & mask) | (spreadBits(coord.getY() & mask) << 1));
+    }
+
+
+    /**
+     * @brief Calculate cell coordinates from storage offset.
+     *
+     * @param size   Grid size.
+     * @param offset Storage offset.
+     *
+     * @return Coordinates, they can be out of grid range for padding cells.
+     */
+    static CoordinateType calcCoordinate(const Vector<SizeType>& size, SizeType offset) noexcept
+    {
+        const SizeType side = calcBlockSide(size);
+        const SizeType blocksX = (size.getWidth() + side - 1) / side;
+        const SizeType block = offset / (side * side);
+        const SizeType inner = offset % (side * side);
+
+        return {
+            (block % blocksX) * side + compactBits(inner),
+            (block / blocksX) * side + compactBits(inner >> 1)
+        };
+    }
+
+
+    /**
+     * @brief Calculate storage offset of neighbour cell.
+     *
+     * Inside a block the step is done by Morton code arithmetic, only cells
+     * on block border calculate the offset from coordinates.
+     *
+     * @tparam DX Step in x direction: -1, 0 or 1.
+     * @tparam DY Step in y direction: -1, 0 or 1.
+     *
+     * @param size   Grid size.
+     * @param coord  Cell coordinates.
+     * @param offset Cell storage offset.
+     *
+     * @return Neighbour offset, neighbour must be in grid range.
+     */
+    template<int DX, int DY>
+    static SizeType calcNeighbourOffset(const Vector<SizeType>& size, const CoordinateType& coord, SizeType offset) noexcept
+    {
+        const SizeType side = calcBlockSide(size);
+        const SizeType mask = side - 1;
+        const SizeType innerX = coord.getX() & mask;
+        const SizeType innerY = coord.getY() & mask;
+
+        if ((DX > 0 && innerX == mask) || (DX < 0 && innerX == 0) ||
+            (DY > 0 && innerY == mask) || (DY < 0 && innerY == 0))
+        {
+            return calcOffset(size, {coord.getX() + DX, coord.getY() + DY});
+        }
+
+        const SizeType cellMask = side * side - 1;
+        const SizeType bitsX = 0x55555555 & cellMask;
+        const SizeType bitsY = bitsX << 1;
+        SizeType x = offset & bitsX;
+        SizeType y = offset & bitsY;
+
+        if (DX > 0)
+            x = ((x | ~bitsX) + 1) & bitsX;
+        else if (DX < 0)
+            x = (x - 1) & bitsX;
+
+        if (DY > 0)
+            y = ((y | ~bitsY) + 1) & bitsY;
+        else if (DY < 0)
+            y = (y - 1) & bitsY;
+
+        return (offset & ~cellMask) | x | y;
+    }
+
+
+    /**
+     * @brief Call function for each cell in storage order, block by block.
+     * Padding cells are skipped.
+     *
+     * @param size Grid size.
+     * @param fn   Function called with cell coordinates and storage offset.
+     */
+    template<typename Fn>
+    static void forEach(const Vector<SizeType>& size, Fn fn)
+    {
+        if (size.getWidth() == 0 || size.getHeight() == 0)
+            return;
+
+        const SizeType side = calcBlockSide(size);
+        const SizeType cells = side * side;
+        const auto blocks = calcBlocks(size, side);
+        SizeType offset = 0;
+
+        for (SizeType by = 0; by < blocks.getHeight(); ++by)
+        {
+            for (SizeType bx = 0; bx < blocks.getWidth(); ++bx)
+            {
+                const SizeType x0 = bx * side;
+                const SizeType y0 = by * side;
+
+                for (SizeType inner = 0; inner < cells; ++inner, ++offset)
+                {
+                    const CoordinateType coord{x0 + compactBits(inner), y0 + compactBits(inner >> 1)};
+
+                    if (coord.getX() < size.getWidth() && coord.getY() < size.getHeight())
+                        fn(coord, offset);
+                }
+            }
+        }
+    }
+
+};
+
+/* ************************************************************************ */
+
+template<unsigned int BlockSize>
+constexpr typename GridLayoutMorton<BlockSize>::SizeType GridLayoutMorton<BlockSize>::BLOCK_SIZE;
+
+/* ************************************************************************ */
+
+/**
+ * @brief 3D grid layout where each row is stored together and rows are
+ * grouped into slices, e.g. <slice0<row0><row1>...><slice1>...
+ */
+struct GridLayoutRowMajor3
+{
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = unsigned int;
+
+
+    /**
+     * @brief Coordinates type.
+     */
+    using CoordinateType = BasicVector<SizeType, 3>;
+
+
+    /**
+     * @brief Returns number of stored cells for grid size.
+     *
+     * @param size Grid size.
+     *
+     * @return
+     */
+    static SizeType calcCapacity(const CoordinateType& size) noexcept
+    {
+        return size.getWidth() * size.getHeight() * size.getDepth();
+    }
+
+
+    /**
+     * @brief Calculate storage offset.
+     *
+     * @param size  Grid size.
+     * @param coord Cell coordinates.
+     *
+     * @return
+     */
+    static SizeType calcOffset(const CoordinateType& size, const CoordinateType& coord) noexcept
+    {
+        return coord.getX() + (coord.getY() + coord.getZ() * size.getHeight()) * size.getWidth();
+    }
+
+
+    /**
+     * @brief Calculate cell coordinates from storage offset.
+     *
+     * @param size   Grid size.
+     * @param offset Storage offset.
+     *
+     * @return
+     */
+    static CoordinateType calcCoordinate(const CoordinateType& size, SizeType offset) noexcept
+    {
+        const SizeType row = offset / size.getWidth();
+
+        return {offset % size.getWidth(), row % size.getHeight(), row / size.getHeight()};
+    }
+
+
+    /**
+     * @brief Calculate storage offset of neighbour cell.
+     *
+     * @tparam DX Step in x direction: -1, 0 or 1.
+     * @tparam DY Step in y direction: -1, 0 or 1.
+     * @tparam DZ Step in z direction: -1, 0 or 1.
+     *
+     * @param size   Grid size.
+     * @param coord  Cell coordinates.
+     * @param offset Cell storage offset.
+     *
+     * @return Neighbour offset, neighbour must be in grid range.
+     */
+    template<int DX, int DY, int DZ>
+    static SizeType calcNeighbourOffset(const CoordinateType& size, const CoordinateType&, SizeType offset) noexcept
+    {
+        const int width = static_cast<int>(size.getWidth());
+        return offset + DX + DY * width + DZ * width * static_cast<int>(size.getHeight());
+    }
+
+
+    /**
+     * @brief Call function for each cell in storage order.
+     *
+     * @param size Grid size.
+     * @param fn   Function called with cell coordinates and storage offset.
+     */
+    template<typename Fn>
+    static void forEach(const CoordinateType& size, Fn fn)
+    {
+        SizeType offset = 0;
+
+        for (SizeType z = 0; z < size.getDepth(); ++z)
+            for (SizeType y = 0; y < size.getHeight(); ++y)
+                for (SizeType x = 0; x < size.getWidth(); ++x)
+                    fn(CoordinateType{x, y, z}, offset++);
+    }
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief 3D grid layout where cells are grouped into cubic blocks stored
+ * together, blocks are stored in row-major order.
+ *
+ * 3D stencils in row-major layout touch cells one slice apart, which for
+ * larger grids are too far to stay in cache between uses. Inside a block
+ * all neighbours are at most BlockSize^2 cells away. Storage is padded to
+ * whole blocks, the padding cells are not accessible by coordinates.
+ *
+ * @tparam BlockSize Block width, height and depth, must be power of two.
+ */
+template<unsigned int BlockSize = 4>
+struct GridLayoutBlocked3
+{
+    static_assert(BlockSize > 0 && (BlockSize & (BlockSize - 1)) == 0, "Block size must be power of two");
+
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = unsigned int;
+
+
+    /**
+     * @brief Coordinates type.
+     */
+    using CoordinateType = BasicVector<SizeType, 3>;
+
+
+    /**
+     * @brief Block width, height and depth.
+     */
+    static constexpr SizeType BLOCK_SIZE = BlockSize;
+
+
+    /**
+     * @brief Number of cells in a block.
+     */
+    static constexpr SizeType BLOCK_CELLS = BlockSize * BlockSize * BlockSize;
+
+
+    /**
+     * @brief Returns number of blocks in each direction.
+     *
+     * @param size Grid size.
+     *
+     * @return
+     */
+    static CoordinateType calcBlocks(const CoordinateType& size) noexcept
+    {
+        return {
+            (size.getWidth() + BlockSize - 1) / BlockSize,
+            (size.getHeight() + BlockSize - 1) / BlockSize,
+            (size.getDepth() + BlockSize - 1) / BlockSize
+        };
+    }
+
+
+    /**
+     * @brief Returns number of stored cells for grid size.
+     *
+     * @param size Grid size.
+     *
+     * @return
+     */
+    static SizeType calcCapacity(const CoordinateType& size) noexcept
+    {
+        const auto blocks = calcBlocks(size);
+        return blocks.getWidth() * blocks.getHeight() * blocks.getDepth() * BLOCK_CELLS;
+    }
+
+
+    /**
+     * @brief Calculate storage offset.
+     *
+     * @param size  Grid size.
+     * @param coord Cell coordinates.
+     *
+     * @return
+     */
+    static SizeType calcOffset(const CoordinateType& size, const CoordinateType& coord) noexcept
+    {
+        const auto blocks = calcBlocks(size);
+        const SizeType block =
+            (coord.getZ() / BlockSize * blocks.getHeight() + coord.getY() / BlockSize) * blocks.getWidth() +
+            coord.getX() / BlockSize
+        ;
+        const SizeType inner =
+            ((coord.getZ() % BlockSize) * BlockSize + coord.getY() % BlockSize) * BlockSize +
+            coord.getX() % BlockSize
+        ;
+
+        return block * BLOCK_CELLS + inner;
+    }
+
+
+    /**
+     * @brief Calculate cell coordinates from storage offset.
+     *
+     * @param size   Grid size.
+     * @param offset Storage offset.
+     *
+     * @return Coordinates, they can be out of grid range for padding cells.
+     */
+    static CoordinateType calcCoordinate(const CoordinateType& size, SizeType offset) noexcept
+    {
+        const auto blocks = calcBlocks(size);
+        const SizeType block = offset / BLOCK_CELLS;
+        const SizeType inner = offset % BLOCK_CELLS;
+        const SizeType row = block / blocks.getWidth();
+
+        return {
+            (block % blocks.getWidth()) * BlockSize + inner % BlockSize,
+            (row % blocks.getHeight()) * BlockSize + (inner / BlockSize) % BlockSize,
+            (row / blocks.getHeight()) * BlockSize + inner / (BlockSize * BlockSize)
+        };
+    }
+
+
+    /**
+     * @brief Calculate storage offset of neighbour cell.
+     *
+     * Inside a block it's a constant step, only cells on block border step
+     * into the neighbour block.
+     *
+     * @tparam DX Step in x direction: -1, 0 or 1.
+     * @tparam DY Step in y direction: -1, 0 or 1.
+     * @tparam DZ Step in z direction: -1, 0 or 1.
+     *
+     * @param size   Grid size.
+     * @param coord  Cell coordinates.
+     * @param offset Cell storage offset.
+     *
+     * @return Neighbour offset, neighbour must be in grid range.
+     */
+    template<int DX, int DY, int DZ>
+    static SizeType calcNeighbourOffset(const CoordinateType& size, const CoordinateType& coord, SizeType offset) noexcept
+    {
+        constexpr SizeType B = BlockSize;
+
+        if (DX > 0)
+            offset += (coord.getX() + 1) % B ? 1 : BLOCK_CELLS - (B - 1);
+        else if (DX < 0)
+            offset -= coord.getX() % B ? 1 : BLOCK_CELLS - (B - 1);
+
+        if (DY != 0)
+        {
+            const SizeType blocksX = (size.getWidth() + B - 1) / B;
+            const SizeType rowStep = blocksX * BLOCK_CELLS - (B - 1) * B;
+
+            if (DY > 0)
+                offset += (coord.getY() + 1) % B ? B : rowStep;
+            else
+                offset -= coord.getY() % B ? B : rowStep;
+        }
+
+        if (DZ != 0)
+        {
+            const SizeType blocksX = (size.getWidth() + B - 1) / B;
+            const SizeType blocksY = (size.getHeight() + B - 1) / B;
+            const SizeType sliceStep = blocksX * blocksY * BLOCK_CELLS - (B - 1) * B * B;
+
+            if (DZ > 0)
+                offset += (coord.getZ() + 1) % B ? B * B : sliceStep;
+            else
+                offset -= coord.getZ() % B ? B * B : sliceStep;
+        }
+
+        return offset;
+    }
+
+
+    /**
+     * @brief Call function for each cell in storage order, block by block.
+     * Padding cells are skipped.
+     *
+     * @param size Grid size.
+     * @param fn   Function called with cell coordinates and storage offset.
+     */
+    template<typename Fn>
+    static void forEach(const CoordinateType& size, Fn fn)
+    {
+        const auto blocks = calcBlocks(size);
+        SizeType offset = 0;
+
+        for (SizeType bz = 0; bz < blocks.getDepth(); ++bz)
+        {
+            for (SizeType by = 0; by < blocks.getHeight(); ++by)
+            {
+                for (SizeType bx = 0; bx < blocks.getWidth(); ++bx)
+                {
+                    const SizeType x0 = bx * BlockSize;
+                    const SizeType y0 = by * BlockSize;
+                    const SizeType z0 = bz * BlockSize;
+
+                    // Whole block
+                    if (x0 + BlockSize <= size.getWidth() && y0 + BlockSize <= size.getHeight() &&
+                        z0 + BlockSize <= size.getDepth())
+                    {
+                        for (SizeType z = z0; z < z0 + BlockSize; ++z)
+                            for (SizeType y = y0; y < y0 + BlockSize; ++y)
+                                for (SizeType x = x0; x < x0 + BlockSize; ++x)
+                                    fn(CoordinateType{x, y, z}, offset++);
+                    }
+                    else
+                    {
+                        for (SizeType z = z0; z < z0 + BlockSize; ++z)
+                        {
+                            for (SizeType y = y0; y < y0 + BlockSize; ++y)
+                            {
+                                for (SizeType x = x0; x < x0 + BlockSize; ++x, ++offset)
+                                {
+                                    if (x < size.getWidth() && y < size.getHeight() && z < size.getDepth())
+                                        fn(CoordinateType{x, y, z}, offset);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+};
+
+/* ************************************************************************ */
+
+template<unsigned int BlockSize>
+constexpr typename GridLayoutBlocked3<BlockSize>::SizeType GridLayoutBlocked3<BlockSize>::BLOCK_SIZE;
+
+/* ************************************************************************ */
+
+template<unsigned int BlockSize>
+constexpr typename GridLayoutBlocked3<BlockSize>::SizeType GridLayoutBlocked3<BlockSize>::BLOCK_CELLS;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
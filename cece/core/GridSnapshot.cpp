@@ -0,0 +1,430 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/GridSnapshot.hpp"
+
+// C++
+#include <algorithm>
+#include <cstring>
+
+// CeCe
+#include "cece/core/Exception.hpp"
+#include "cece/core/StaticArray.hpp"
+#include "cece/core/BinaryInput.hpp"
+#include "cece/core/BinaryOutput.hpp"
+#include "cece/core/Compression.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// File magic.
+constexpr StaticArray<char, 8> MAGIC{{'C', 'E', 'C', 'E', 'G', 'R', 'I', 'D'}};
+
+/// File format version.
+constexpr std::uint32_t VERSION = 1;
+
+/// Frame magic.
+constexpr std::uint32_t FRAME_MAGIC = 0x4D415246; // "FRAM"
+
+/// Tile is stored uncompressed.
+constexpr std::uint32_t TILE_RAW = 0;
+
+/// Tile is byte-shuffled and compressed.
+constexpr std::uint32_t TILE_COMPRESSED = 1;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns number of tiles in each direction.
+ *
+ * @param size     Grid size.
+ * @param tileSize Tile size.
+ *
+ * @return
+ */
+Vector<unsigned int> calcTileCount(const Vector<unsigned int>& size, const Vector<unsigned int>& tileSize) noexcept
+{
+    return Vector<unsigned int>{
+        (size.getWidth() + tileSize.getWidth() - 1) / tileSize.getWidth(),
+        (size.getHeight() + tileSize.getHeight() - 1) / tileSize.getHeight()
+    };
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns size of tile at given tile coordinates.
+ *
+ * @param tile     Tile coordinates.
+ * @param size     Grid size.
+ * @param tileSize Tile size.
+ *
+ * @return
+ */
+Vector<unsigned int> calcTileExtent(const Vector<unsigned int>& tile,
+    const Vector<unsigned int>& size, const Vector<unsigned int>& tileSize) noexcept
+{
+    return Vector<unsigned int>{
+        std::min(tileSize.getWidth(), size.getWidth() - tile.getX() * tileSize.getWidth()),
+        std::min(tileSize.getHeight(), size.getHeight() - tile.getY() * tileSize.getHeight())
+    };
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+GridSnapshotWriter::GridSnapshotWriter(FilePath path, Vector<SizeType> tileSize)
+    : m_path(std::move(path))
+    , m_tileSize(std::move(tileSize))
+{
+    if (m_tileSize.getWidth() == 0 || m_tileSize.getHeight() == 0)
+        throw InvalidArgumentException("Grid snapshot tile size cannot be zero");
+
+    m_file.open(m_path.toString(), std::ios::binary | std::ios::out | std::ios::trunc);
+
+    if (!m_file.is_open())
+        throw RuntimeException("Cannot open file: " + m_path.toString());
+}
+
+/* ************************************************************************ */
+
+GridSnapshotWriter::~GridSnapshotWriter() = default;
+
+/* ************************************************************************ */
+
+void GridSnapshotWriter::flush()
+{
+    m_file.flush();
+}
+
+/* ************************************************************************ */
+
+void GridSnapshotWriter::writeFrame(const std::uint8_t* data, const Vector<SizeType>& size,
+    GridSnapshotValueType type, SizeType valueSize, IterationType iteration, units::Time time)
+{
+    BinaryOutput out(m_file);
+
+    if (!m_headerWritten)
+    {
+        m_size = size;
+        m_valueType = type;
+        m_valueSize = valueSize;
+
+        out.write(MAGIC.data(), MAGIC.size());
+        out.write<std::uint32_t>(VERSION);
+        out.write<std::uint32_t>(static_cast<std::uint32_t>(m_valueType));
+        out.write<std::uint32_t>(m_valueSize);
+        out.write<std::uint32_t>(m_size.getWidth());
+        out.write<std::uint32_t>(m_size.getHeight());
+        out.write<std::uint32_t>(m_tileSize.getWidth());
+        out.write<std::uint32_t>(m_tileSize.getHeight());
+
+        m_headerWritten = true;
+    }
+    else if (size != m_size || type != m_valueType || valueSize != m_valueSize)
+    {
+        throw InvalidArgumentException("Grid snapshot frame doesn't match previous frames");
+    }
+
+    const auto tileCount = calcTileCount(m_size, m_tileSize);
+    const std::size_t count = tileCount.getWidth() * tileCount.getHeight();
+
+    DynamicArray<std::uint32_t> sizes(count);
+    DynamicArray<std::uint32_t> flags(count);
+    DynamicArray<std::uint8_t> payload;
+
+    DynamicArray<std::uint8_t> tile(m_tileSize.getWidth() * m_tileSize.getHeight() * m_valueSize);
+    DynamicArray<std::uint8_t> shuffled(tile.size());
+    DynamicArray<std::uint8_t> compressed;
+
+    for (SizeType ty = 0; ty < tileCount.getHeight(); ++ty)
+    for (SizeType tx = 0; tx < tileCount.getWidth(); ++tx)
+    {
+        const auto extent = calcTileExtent({tx, ty}, m_size, m_tileSize);
+        const std::size_t rowBytes = extent.getWidth() * m_valueSize;
+        const std::size_t tileBytes = rowBytes * extent.getHeight();
+
+        // Gather tile rows
+        for (SizeType y = 0; y < extent.getHeight(); ++y)
+        {
+            const std::size_t offset =
+                (ty * m_tileSize.getHeight() + y) * m_size.getWidth() +
+                tx * m_tileSize.getWidth();
+
+            std::memcpy(tile.data() + y * rowBytes, data + offset * m_valueSize, rowBytes);
+        }
+
+        compression::shuffle(tile.data(), shuffled.data(), tileBytes / m_valueSize, m_valueSize);
+        compression::compress(shuffled.data(), tileBytes, compressed);
+
+        const std::size_t index = ty * tileCount.getWidth() + tx;
+
+        // Keep tile uncompressed when compression doesn't help
+        if (compressed.size() < tileBytes)
+        {
+            sizes[index] = static_cast<std::uint32_t>(compressed.size());
+            flags[index] = TILE_COMPRESSED;
+            payload.insert(payload.end(), compressed.begin(), compressed.end());
+        }
+        else
+        {
+            sizes[index] = static_cast<std::uint32_t>(tileBytes);
+            flags[index] = TILE_RAW;
+            payload.insert(payload.end(), tile.data(), tile.data() + tileBytes);
+        }
+    }
+
+    out.write<std::uint32_t>(FRAME_MAGIC);
+    out.write<std::uint64_t>(iteration);
+    out.write<double>(time.value());
+    out.write<std::uint32_t>(static_cast<std::uint32_t>(count));
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out.write<std::uint32_t>(sizes[i]);
+        out.write<std::uint32_t>(flags[i]);
+    }
+
+    out.write(payload.data(), static_cast<unsigned>(payload.size()));
+
+    if (!m_file)
+        throw RuntimeException("Unable to write grid snapshot: " + m_path.toString());
+}
+
+/* ************************************************************************ */
+
+GridSnapshotReader::GridSnapshotReader(FilePath path)
+{
+    m_file.open(path.toString(), std::ios::binary | std::ios::in);
+
+    if (!m_file.is_open())
+        throw RuntimeException("Cannot open file: " + path.toString());
+
+    BinaryInput in(m_file);
+
+    StaticArray<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t valueType;
+    std::uint32_t valueSize;
+    std::uint32_t width, height;
+    std::uint32_t tileWidth, tileHeight;
+
+    in.read(magic.data(), magic.size());
+    in.read(version);
+    in.read(valueType);
+    in.read(valueSize);
+    in.read(width);
+    in.read(height);
+    in.read(tileWidth);
+    in.read(tileHeight);
+
+    if (!m_file || magic != MAGIC)
+        throw RuntimeException("Not a grid snapshot file: " + path.toString());
+
+    if (version != VERSION)
+        throw RuntimeException("Unsupported grid snapshot version: " + path.toString());
+
+    if (tileWidth == 0 || tileHeight == 0 || valueSize == 0)
+        throw RuntimeException("Corrupted grid snapshot file: " + path.toString());
+
+    m_valueType = static_cast<GridSnapshotValueType>(valueType);
+    m_valueSize = valueSize;
+    m_size = {width, height};
+    m_tileSize = {tileWidth, tileHeight};
+
+    const auto tileCount = calcTileCount(m_size, m_tileSize);
+    const std::size_t count = tileCount.getWidth() * tileCount.getHeight();
+
+    // Build frame index
+    while (true)
+    {
+        std::uint32_t frameMagic;
+        in.read(frameMagic);
+
+        if (m_file.eof())
+            break;
+
+        std::uint64_t iteration;
+        double time;
+        std::uint32_t frameTiles;
+
+        in.read(iteration);
+        in.read(time);
+        in.read(frameTiles);
+
+        if (!m_file || frameMagic != FRAME_MAGIC || frameTiles != count)
+            throw RuntimeException("Corrupted grid snapshot file: " + path.toString());
+
+        Frame frame{static_cast<IterationType>(iteration), units::Time(time), DynamicArray<Tile>(count)};
+
+        for (auto& tile : frame.tiles)
+        {
+            in.read(tile.size);
+            in.read(tile.flags);
+        }
+
+        if (!m_file)
+            throw RuntimeException("Corrupted grid snapshot file: " + path.toString());
+
+        std::uint64_t offset = static_cast<std::uint64_t>(m_file.tellg());
+
+        for (auto& tile : frame.tiles)
+        {
+            tile.offset = offset;
+            offset += tile.size;
+        }
+
+        m_file.seekg(static_cast<std::streamoff>(offset));
+        m_frames.push_back(std::move(frame));
+    }
+
+    m_file.clear();
+}
+
+/* ************************************************************************ */
+
+GridSnapshotReader::~GridSnapshotReader() = default;
+
+/* ************************************************************************ */
+
+Pair<std::size_t, std::size_t> GridSnapshotReader::findFrames(units::Time from, units::Time to) const noexcept
+{
+    // Frames are stored in time order
+    const auto first = std::lower_bound(m_frames.begin(), m_frames.end(), from,
+        [](const Frame& frame, units::Time time) { return frame.time < time; }
+    );
+
+    const auto last = std::upper_bound(first, m_frames.end(), to,
+        [](units::Time time, const Frame& frame) { return time < frame.time; }
+    );
+
+    return makePair(
+        static_cast<std::size_t>(first - m_frames.begin()),
+        static_cast<std::size_t>(last - m_frames.begin())
+    );
+}
+
+/* ************************************************************************ */
+
+void GridSnapshotReader::checkType(GridSnapshotValueType type, SizeType valueSize) const
+{
+    if (valueSize != m_valueSize)
+        throw InvalidArgumentException("Grid snapshot value size mismatch");
+
+    if (type != m_valueType && type != GridSnapshotValueType::Raw && m_valueType != GridSnapshotValueType::Raw)
+        throw InvalidArgumentException("Grid snapshot value type mismatch");
+}
+
+/* ************************************************************************ */
+
+void GridSnapshotReader::readRegion(std::size_t frame, const CoordinateType& origin,
+    const Vector<SizeType>& size, std::uint8_t* data)
+{
+    if (frame >= m_frames.size())
+        throw OutOfRangeException("Grid snapshot frame out of range");
+
+    if (origin.getX() + size.getWidth() > m_size.getWidth() ||
+        origin.getY() + size.getHeight() > m_size.getHeight())
+        throw OutOfRangeException("Grid snapshot region out of range");
+
+    if (size.getWidth() == 0 || size.getHeight() == 0)
+        return;
+
+    const auto& tiles = m_frames[frame].tiles;
+    const auto tileCount = calcTileCount(m_size, m_tileSize);
+
+    // Range of tiles intersecting the region
+    const auto tileFirst = origin / m_tileSize;
+    const auto tileLast = (origin + size - 1) / m_tileSize;
+
+    DynamicArray<std::uint8_t> stored;
+    DynamicArray<std::uint8_t> shuffled(m_tileSize.getWidth() * m_tileSize.getHeight() * m_valueSize);
+    DynamicArray<std::uint8_t> tile(shuffled.size());
+
+    for (SizeType ty = tileFirst.getY(); ty <= tileLast.getY(); ++ty)
+    for (SizeType tx = tileFirst.getX(); tx <= tileLast.getX(); ++tx)
+    {
+        const Tile& record = tiles[ty * tileCount.getWidth() + tx];
+        const auto extent = calcTileExtent({tx, ty}, m_size, m_tileSize);
+        const std::size_t tileBytes = extent.getWidth() * extent.getHeight() * m_valueSize;
+
+        stored.resize(record.size);
+        m_file.seekg(static_cast<std::streamoff>(record.offset));
+        m_file.read(reinterpret_cast<char*>(stored.data()), stored.size());
+
+        if (!m_file)
+            throw RuntimeException("Unable to read grid snapshot tile");
+
+        if (record.flags == TILE_COMPRESSED)
+        {
+            compression::decompress(stored.data(), stored.size(), shuffled.data(), tileBytes);
+            compression::unshuffle(shuffled.data(), tile.data(), tileBytes / m_valueSize, m_valueSize);
+        }
+        else if (record.flags == TILE_RAW && record.size == tileBytes)
+        {
+            std::memcpy(tile.data(), stored.data(), tileBytes);
+        }
+        else
+        {
+            throw RuntimeException("Corrupted grid snapshot tile");
+        }
+
+        // Intersection of tile and region in grid coordinates
+        const SizeType tileX = tx * m_tileSize.getWidth();
+        const SizeType tileY = ty * m_tileSize.getHeight();
+        const SizeType x0 = std::max(tileX, origin.getX());
+        const SizeType y0 = std::max(tileY, origin.getY());
+        const SizeType x1 = std::min(tileX + extent.getWidth(), origin.getX() + size.getWidth());
+        const SizeType y1 = std::min(tileY + extent.getHeight(), origin.getY() + size.getHeight());
+        const std::size_t rowBytes = (x1 - x0) * m_valueSize;
+
+        for (SizeType y = y0; y < y1; ++y)
+        {
+            const std::size_t src = (y - tileY) * extent.getWidth() + (x0 - tileX);
+            const std::size_t dst = (y - origin.getY()) * size.getWidth() + (x0 - origin.getX());
+
+            std::memcpy(data + dst * m_valueSize, tile.data() + src * m_valueSize, rowBytes);
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,518 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstdint>
+#include <type_traits>
+
+// CeCe
+#include "cece/core/Units.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/Grid.hpp"
+#include "cece/core/Pair.hpp"
+#include "cece/core/FilePath.hpp"
+#include "cece/core/FileStream.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/IterationType.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Type of values stored in grid snapshot.
+ */
+enum class GridSnapshotValueType : std::uint32_t
+{
+    Raw = 0,
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Float32,
+    Float64
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid snapshot value type traits.
+ *
+ * Types without specialization are stored as raw bytes and only value size
+ * is checked when they are read.
+ *
+ * @tparam T
+ */
+template<typename T>
+struct GridSnapshotType
+{
+    /// Value type code.
+    static constexpr GridSnapshotValueType CODE =
+        std::is_floating_point<T>::value
+        ? (sizeof(T) == 4 ? GridSnapshotValueType::Float32
+        : sizeof(T) == 8 ? GridSnapshotValueType::Float64
+        : GridSnapshotValueType::Raw)
+        : std::is_integral<T>::value
+        ? (sizeof(T) == 1 ? (std::is_signed<T>::value ? GridSnapshotValueType::Int8 : GridSnapshotValueType::UInt8)
+        : sizeof(T) == 2 ? (std::is_signed<T>::value ? GridSnapshotValueType::Int16 : GridSnapshotValueType::UInt16)
+        : sizeof(T) == 4 ? (std::is_signed<T>::value ? GridSnapshotValueType::Int32 : GridSnapshotValueType::UInt32)
+        : sizeof(T) == 8 ? (std::is_signed<T>::value ? GridSnapshotValueType::Int64 : GridSnapshotValueType::UInt64)
+        : GridSnapshotValueType::Raw)
+        : GridSnapshotValueType::Raw
+    ;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid snapshot file writer.
+ *
+ * Snapshot file contains a sequence of frames of a single grid field. Each
+ * frame is split into tiles that are compressed independently, so a region
+ * of the grid can be read without decompressing the whole frame.
+ *
+ * File layout:
+ * - header: magic, version, value type, value size, grid size, tile size.
+ * - frames: iteration, time, tile table (compressed size & flags), tile data.
+ */
+class GridSnapshotWriter
+{
+
+// Public Types
+public:
+
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = unsigned int;
+
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param path     Path to output file.
+     * @param tileSize Size of compressed tiles.
+     */
+    explicit GridSnapshotWriter(FilePath path, Vector<SizeType> tileSize = Vector<SizeType>{64, 64});
+
+
+    /**
+     * @brief Destructor.
+     */
+    ~GridSnapshotWriter();
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns path to output file.
+     *
+     * @return
+     */
+    const FilePath& getPath() const noexcept
+    {
+        return m_path;
+    }
+
+
+    /**
+     * @brief Returns tile size.
+     *
+     * @return
+     */
+    const Vector<SizeType>& getTileSize() const noexcept
+    {
+        return m_tileSize;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Write grid snapshot frame.
+     *
+     * All frames stored in single file must have same grid size and value
+     * type.
+     *
+     * @param grid      Stored grid.
+     * @param iteration Simulation iteration.
+     * @param time      Simulation time.
+     *
+     * @throw InvalidArgumentException If grid differs from previous frames.
+     */
+    template<typename T, typename Alloc>
+    void write(const Grid<T, Alloc>& grid, IterationType iteration, units::Time time)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Grid value must be trivially copyable");
+
+        writeFrame(
+            reinterpret_cast<const std::uint8_t*>(grid.getData()),
+            grid.getSize(), GridSnapshotType<T>::CODE, sizeof(T),
+            iteration, time
+        );
+    }
+
+
+    /**
+     * @brief Flush output.
+     */
+    void flush();
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Write grid snapshot frame.
+     *
+     * @param data      Grid data.
+     * @param size      Grid size.
+     * @param type      Value type.
+     * @param valueSize Value size in bytes.
+     * @param iteration Simulation iteration.
+     * @param time      Simulation time.
+     */
+    void writeFrame(const std::uint8_t* data, const Vector<SizeType>& size,
+        GridSnapshotValueType type, SizeType valueSize,
+        IterationType iteration, units::Time time);
+
+
+// Private Data Members
+private:
+
+    /// File path.
+    FilePath m_path;
+
+    /// File stream.
+    OutFileStream m_file;
+
+    /// Tile size.
+    Vector<SizeType> m_tileSize;
+
+    /// Grid size.
+    Vector<SizeType> m_size = Zero;
+
+    /// Value type.
+    GridSnapshotValueType m_valueType = GridSnapshotValueType::Raw;
+
+    /// Value size.
+    SizeType m_valueSize = 0;
+
+    /// If header was written.
+    bool m_headerWritten = false;
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid snapshot file reader.
+ *
+ * Frame index is built when the file is opened and tile data are read only
+ * on request, so reading a region or a time range touches only the required
+ * parts of the file.
+ */
+class GridSnapshotReader
+{
+
+// Public Types
+public:
+
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = unsigned int;
+
+
+    /**
+     * @brief Coordinates type.
+     */
+    using CoordinateType = Vector<SizeType>;
+
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param path Path to snapshot file.
+     *
+     * @throw RuntimeException If file cannot be opened or it's not valid.
+     */
+    explicit GridSnapshotReader(FilePath path);
+
+
+    /**
+     * @brief Destructor.
+     */
+    ~GridSnapshotReader();
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns grid size.
+     *
+     * @return
+     */
+    const Vector<SizeType>& getSize() const noexcept
+    {
+        return m_size;
+    }
+
+
+    /**
+     * @brief Returns tile size.
+     *
+     * @return
+     */
+    const Vector<SizeType>& getTileSize() const noexcept
+    {
+        return m_tileSize;
+    }
+
+
+    /**
+     * @brief Returns stored value type.
+     *
+     * @return
+     */
+    GridSnapshotValueType getValueType() const noexcept
+    {
+        return m_valueType;
+    }
+
+
+    /**
+     * @brief Returns stored value size.
+     *
+     * @return
+     */
+    SizeType getValueSize() const noexcept
+    {
+        return m_valueSize;
+    }
+
+
+    /**
+     * @brief Returns number of stored frames.
+     *
+     * @return
+     */
+    std::size_t getFrameCount() const noexcept
+    {
+        return m_frames.size();
+    }
+
+
+    /**
+     * @brief Returns frame iteration.
+     *
+     * @param frame Frame index.
+     *
+     * @return
+     */
+    IterationType getFrameIteration(std::size_t frame) const noexcept
+    {
+        return m_frames[frame].iteration;
+    }
+
+
+    /**
+     * @brief Returns frame time.
+     *
+     * @param frame Frame index.
+     *
+     * @return
+     */
+    units::Time getFrameTime(std::size_t frame) const noexcept
+    {
+        return m_frames[frame].time;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Find frames in time range.
+     *
+     * @param from Start time (inclusive).
+     * @param to   End time (inclusive).
+     *
+     * @return Range of frame indices [first, last).
+     */
+    Pair<std::size_t, std::size_t> findFrames(units::Time from, units::Time to) const noexcept;
+
+
+    /**
+     * @brief Read whole frame.
+     *
+     * @param frame Frame index.
+     * @param grid  Output grid, it's resized to stored grid size.
+     */
+    template<typename T, typename Alloc>
+    void read(std::size_t frame, Grid<T, Alloc>& grid)
+    {
+        readRegion(frame, Zero, m_size, grid);
+    }
+
+
+    /**
+     * @brief Read frame region.
+     *
+     * @param frame  Frame index.
+     * @param origin Region origin.
+     * @param size   Region size.
+     * @param grid   Output grid, it's resized to region size.
+     *
+     * @throw InvalidArgumentException If value type doesn't match.
+     * @throw OutOfRangeException      If region is out of grid.
+     */
+    template<typename T, typename Alloc>
+    void readRegion(std::size_t frame, const CoordinateType& origin,
+        const Vector<SizeType>& size, Grid<T, Alloc>& grid)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Grid value must be trivially copyable");
+
+        checkType(GridSnapshotType<T>::CODE, sizeof(T));
+        grid.resize(size);
+
+        readRegion(frame, origin, size,
+            reinterpret_cast<std::uint8_t*>(grid.getContainer().data()));
+    }
+
+
+// Private Structures
+private:
+
+    /// Tile record.
+    struct Tile
+    {
+        /// Offset in file.
+        std::uint64_t offset;
+
+        /// Stored size.
+        std::uint32_t size;
+
+        /// Tile flags.
+        std::uint32_t flags;
+    };
+
+    /// Frame record.
+    struct Frame
+    {
+        /// Simulation iteration.
+        IterationType iteration;
+
+        /// Simulation time.
+        units::Time time;
+
+        /// Frame tiles.
+        DynamicArray<Tile> tiles;
+    };
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Check if stored value type is compatible.
+     *
+     * @param type      Requested value type.
+     * @param valueSize Requested value size.
+     */
+    void checkType(GridSnapshotValueType type, SizeType valueSize) const;
+
+
+    /**
+     * @brief Read frame region.
+     *
+     * @param frame  Frame index.
+     * @param origin Region origin.
+     * @param size   Region size.
+     * @param data   Output data.
+     */
+    void readRegion(std::size_t frame, const CoordinateType& origin,
+        const Vector<SizeType>& size, std::uint8_t* data);
+
+
+// Private Data Members
+private:
+
+    /// File stream.
+    InFileStream m_file;
+
+    /// Grid size.
+    Vector<SizeType> m_size = Zero;
+
+    /// Tile size.
+    Vector<SizeType> m_tileSize = Zero;
+
+    /// Value type.
+    GridSnapshotValueType m_valueType = GridSnapshotValueType::Raw;
+
+    /// Value size.
+    SizeType m_valueSize = 0;
+
+    /// Frames.
+    DynamicArray<Frame> m_frames;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
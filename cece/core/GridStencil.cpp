@@ -0,0 +1,399 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/GridStencil.hpp"
+
+// C++
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+
+// CeCe
+#include "cece/core/Macro.hpp"
+#include "cece/core/CpuFeatures.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Interior kernel type.
+ *
+ * @param in      Input data.
+ * @param out     Output data.
+ * @param width   Grid width.
+ * @param rows    Processed rows range.
+ * @param cols    Processed columns range.
+ * @param offsets Point offsets in data.
+ * @param weights Point weights.
+ * @param count   Number of points.
+ */
+using KernelFn = void (*)(const StorageRealType*, StorageRealType*, std::ptrdiff_t,
+    std::ptrdiff_t, std::ptrdiff_t, std::ptrdiff_t, std::ptrdiff_t,
+    const std::ptrdiff_t*, const RealType*, std::size_t);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Number of cells processed together by interior kernel.
+ *
+ * Constant block length lets the compiler vectorize the inner loops
+ * without runtime trip count checks and keeps the partial sums in
+ * registers, so each output cell is written only once.
+ */
+constexpr std::ptrdiff_t BLOCK_SIZE = 32;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Interior kernel implementation.
+ */
+CECE_FORCE_INLINE void applyInteriorImpl(const StorageRealType* in, StorageRealType* out,
+    std::ptrdiff_t width, std::ptrdiff_t y0, std::ptrdiff_t y1,
+    std::ptrdiff_t x0, std::ptrdiff_t x1,
+    const std::ptrdiff_t* offsets, const RealType* weights, std::size_t count)
+{
+    for (std::ptrdiff_t y = y0; y < y1; ++y)
+    {
+        const StorageRealType* row = in + y * width;
+        StorageRealType* dst = out + y * width;
+        std::ptrdiff_t x = x0;
+
+        for (; x + BLOCK_SIZE <= x1; x += BLOCK_SIZE)
+        {
+            RealType sum[BLOCK_SIZE];
+
+            {
+                const StorageRealType* src = row + x + offsets[0];
+                const RealType weight = weights[0];
+
+                for (std::ptrdiff_t i = 0; i < BLOCK_SIZE; ++i)
+                    sum[i] = weight * src[i];
+            }
+
+            for (std::size_t j = 1; j < count; ++j)
+            {
+                const StorageRealType* src = row + x + offsets[j];
+                const RealType weight = weights[j];
+
+                for (std::ptrdiff_t i = 0; i < BLOCK_SIZE; ++i)
+                    sum[i] += weight * src[i];
+            }
+
+            for (std::ptrdiff_t i = 0; i < BLOCK_SIZE; ++i)
+                dst[x + i] = static_cast<StorageRealType>(sum[i]);
+        }
+
+        // Remaining cells
+        for (; x < x1; ++x)
+        {
+            RealType sum = 0;
+
+            for (std::size_t j = 0; j < count; ++j)
+                sum += weights[j] * row[x + offsets[j]];
+
+            dst[x] = static_cast<StorageRealType>(sum);
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+void applyInteriorDefault(const StorageRealType* in, StorageRealType* out,
+    std::ptrdiff_t width, std::ptrdiff_t y0, std::ptrdiff_t y1,
+    std::ptrdiff_t x0, std::ptrdiff_t x1,
+    const std::ptrdiff_t* offsets, const RealType* weights, std::size_t count)
+{
+    applyInteriorImpl(in, out, width, y0, y1, x0, x1, offsets, weights, count);
+}
+
+/* ************************************************************************ */
+
+#ifdef CECE_CPU_DISPATCH
+
+CECE_TARGET("avx2,fma")
+void applyInteriorAvx2(const StorageRealType* in, StorageRealType* out,
+    std::ptrdiff_t width, std::ptrdiff_t y0, std::ptrdiff_t y1,
+    std::ptrdiff_t x0, std::ptrdiff_t x1,
+    const std::ptrdiff_t* offsets, const RealType* weights, std::size_t count)
+{
+    applyInteriorImpl(in, out, width, y0, y1, x0, x1, offsets, weights, count);
+}
+
+/* ************************************************************************ */
+
+CECE_TARGET("avx512f")
+void applyInteriorAvx512(const StorageRealType* in, StorageRealType* out,
+    std::ptrdiff_t width, std::ptrdiff_t y0, std::ptrdiff_t y1,
+    std::ptrdiff_t x0, std::ptrdiff_t x1,
+    const std::ptrdiff_t* offsets, const RealType* weights, std::size_t count)
+{
+    applyInteriorImpl(in, out, width, y0, y1, x0, x1, offsets, weights, count);
+}
+
+#endif
+
+/* ************************************************************************ */
+
+/**
+ * @brief Selected kernel.
+ */
+struct Kernel
+{
+    /// Kernel function.
+    KernelFn fn;
+
+    /// Instruction set name.
+    const char* isa;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Select kernel for current CPU.
+ *
+ * @return
+ */
+Kernel selectKernel() noexcept
+{
+#ifdef CECE_CPU_DISPATCH
+    if (hasCpuFeature(CpuFeature::Avx512f))
+        return {applyInteriorAvx512, "avx512f"};
+
+    if (hasCpuFeature(CpuFeature::Avx2) && hasCpuFeature(CpuFeature::Fma))
+        return {applyInteriorAvx2, "avx2"};
+#endif
+
+    return {applyInteriorDefault, "default"};
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns kernel for current CPU.
+ *
+ * @return
+ */
+const Kernel& getKernel() noexcept
+{
+    static const Kernel kernel = selectKernel();
+    return kernel;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compute single cell with boundary handling.
+ */
+RealType applyCell(const StorageRealType* in, std::ptrdiff_t width, std::ptrdiff_t height,
+    std::ptrdiff_t x, std::ptrdiff_t y, const Stencil& stencil,
+    StencilBoundary boundary, RealType value) noexcept
+{
+    RealType sum = 0;
+
+    for (const auto& point : stencil.getPoints())
+    {
+        std::ptrdiff_t sx = x + point.dx;
+        std::ptrdiff_t sy = y + point.dy;
+        RealType cell;
+
+        if (sx >= 0 && sx < width && sy >= 0 && sy < height)
+        {
+            cell = in[sy * width + sx];
+        }
+        else
+        {
+            switch (boundary)
+            {
+            case StencilBoundary::Clamp:
+                sx = std::min(std::max<std::ptrdiff_t>(sx, 0), width - 1);
+                sy = std::min(std::max<std::ptrdiff_t>(sy, 0), height - 1);
+                cell = in[sy * width + sx];
+                break;
+
+            case StencilBoundary::Periodic:
+                sx = ((sx % width) + width) % width;
+                sy = ((sy % height) + height) % height;
+                cell = in[sy * width + sx];
+                break;
+
+            default:
+                cell = value;
+                break;
+            }
+        }
+
+        sum += point.weight * cell;
+    }
+
+    return sum;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+Stencil::Stencil(DynamicArray<Point> points)
+{
+    for (const auto& point : points)
+    {
+        auto it = std::find_if(m_points.begin(), m_points.end(), [&point] (const Point& p) {
+            return p.dx == point.dx && p.dy == point.dy;
+        });
+
+        if (it != m_points.end())
+            it->weight += point.weight;
+        else
+            m_points.push_back(point);
+    }
+
+    m_points.erase(std::remove_if(m_points.begin(), m_points.end(), [] (const Point& p) {
+        return p.weight == 0;
+    }), m_points.end());
+
+    for (const auto& point : m_points)
+    {
+        m_radius = std::max(m_radius, static_cast<unsigned int>(std::abs(point.dx)));
+        m_radius = std::max(m_radius, static_cast<unsigned int>(std::abs(point.dy)));
+    }
+}
+
+/* ************************************************************************ */
+
+Stencil Stencil::makeFivePoint(RealType center, RealType neighbour)
+{
+    return Stencil({
+        {0, -1, neighbour},
+        {-1, 0, neighbour}, {0, 0, center}, {1, 0, neighbour},
+        {0, 1, neighbour}
+    });
+}
+
+/* ************************************************************************ */
+
+Stencil Stencil::makeNinePoint(RealType center, RealType edge, RealType corner)
+{
+    return Stencil({
+        {-1, -1, corner}, {0, -1, edge}, {1, -1, corner},
+        {-1, 0, edge}, {0, 0, center}, {1, 0, edge},
+        {-1, 1, corner}, {0, 1, edge}, {1, 1, corner}
+    });
+}
+
+/* ************************************************************************ */
+
+Stencil Stencil::makeLaplacian5(RealType scale)
+{
+    return makeFivePoint(-4 * scale, scale);
+}
+
+/* ************************************************************************ */
+
+Stencil Stencil::makeLaplacian9(RealType scale)
+{
+    return makeNinePoint(-20 * scale / 6, 4 * scale / 6, scale / 6);
+}
+
+/* ************************************************************************ */
+
+const char* getStencilIsa() noexcept
+{
+    return getKernel().isa;
+}
+
+/* ************************************************************************ */
+
+void applyStencil(const StorageRealType* in, StorageRealType* out, const Vector<unsigned int>& size,
+    const Stencil& stencil, StencilBoundary boundary, RealType value) noexcept
+{
+    CECE_ASSERT(in != out);
+
+    const std::ptrdiff_t width = size.getWidth();
+    const std::ptrdiff_t height = size.getHeight();
+    const std::ptrdiff_t radius = stencil.getRadius();
+    const auto& points = stencil.getPoints();
+
+    if (points.empty())
+    {
+        std::fill(out, out + width * height, StorageRealType(0));
+        return;
+    }
+
+    // Interior region where no boundary handling is required
+    const bool hasInterior = width > 2 * radius && height > 2 * radius;
+
+    if (hasInterior)
+    {
+        DynamicArray<std::ptrdiff_t> offsets;
+        DynamicArray<RealType> weights;
+        offsets.reserve(points.size());
+        weights.reserve(points.size());
+
+        for (const auto& point : points)
+        {
+            offsets.push_back(point.dy * width + point.dx);
+            weights.push_back(point.weight);
+        }
+
+        getKernel().fn(in, out, width, radius, height - radius, radius, width - radius,
+            offsets.data(), weights.data(), points.size());
+    }
+
+    // Halo cells
+    auto applyRow = [&] (std::ptrdiff_t y, std::ptrdiff_t x0, std::ptrdiff_t x1) {
+        for (std::ptrdiff_t x = x0; x < x1; ++x)
+            out[y * width + x] = static_cast<StorageRealType>(applyCell(in, width, height, x, y, stencil, boundary, value));
+    };
+
+    for (std::ptrdiff_t y = 0; y < height; ++y)
+    {
+        if (hasInterior && y >= radius && y < height - radius)
+        {
+            applyRow(y, 0, radius);
+            applyRow(y, width - radius, width);
+        }
+        else
+        {
+            applyRow(y, 0, width);
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
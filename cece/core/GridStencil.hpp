@@ -0,0 +1,252 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Assert.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Grid.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief How stencil reads cells outside the grid.
+ */
+enum class StencilBoundary
+{
+    /// Nearest border cell is used (zero-flux for diffusion).
+    Clamp,
+
+    /// Grid wraps around.
+    Periodic,
+
+    /// Constant value outside the grid.
+    Dirichlet
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Stencil given by weighted cell offsets.
+ *
+ * Result of the stencil is sum of weighted cells around the processed cell,
+ * e.g. explicit diffusion step is five-point stencil with center weight
+ * `1 - 4 * k` and neighbour weights `k` where `k = D * dt / dx^2`.
+ */
+class Stencil
+{
+
+// Public Structures
+public:
+
+
+    /**
+     * @brief Stencil point.
+     */
+    struct Point
+    {
+        /// Offset in x.
+        int dx;
+
+        /// Offset in y.
+        int dy;
+
+        /// Cell weight.
+        RealType weight;
+    };
+
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Default constructor.
+     */
+    Stencil() = default;
+
+
+    /**
+     * @brief Constructor.
+     *
+     * Points with same offset are merged and zero weights are removed.
+     *
+     * @param points Stencil points.
+     */
+    explicit Stencil(DynamicArray<Point> points);
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns stencil points.
+     *
+     * @return
+     */
+    const DynamicArray<Point>& getPoints() const noexcept
+    {
+        return m_points;
+    }
+
+
+    /**
+     * @brief Returns maximum offset of stencil points (halo width).
+     *
+     * @return
+     */
+    unsigned int getRadius() const noexcept
+    {
+        return m_radius;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Create five-point stencil.
+     *
+     * @param center    Center weight.
+     * @param neighbour Weight of left, right, top and bottom cell.
+     *
+     * @return
+     */
+    static Stencil makeFivePoint(RealType center, RealType neighbour);
+
+
+    /**
+     * @brief Create nine-point stencil.
+     *
+     * @param center Center weight.
+     * @param edge   Weight of left, right, top and bottom cell.
+     * @param corner Weight of diagonal cells.
+     *
+     * @return
+     */
+    static Stencil makeNinePoint(RealType center, RealType edge, RealType corner);
+
+
+    /**
+     * @brief Create five-point Laplacian.
+     *
+     * @param scale Result scale, e.g. 1 / dx^2.
+     *
+     * @return
+     */
+    static Stencil makeLaplacian5(RealType scale = 1);
+
+
+    /**
+     * @brief Create isotropic nine-point Laplacian.
+     *
+     * @param scale Result scale, e.g. 1 / dx^2.
+     *
+     * @return
+     */
+    static Stencil makeLaplacian9(RealType scale = 1);
+
+
+// Private Data Members
+private:
+
+    /// Stencil points.
+    DynamicArray<Point> m_points;
+
+    /// Stencil radius.
+    unsigned int m_radius = 0;
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns instruction set used by stencil kernels on this CPU.
+ *
+ * @return "avx512f", "avx2" or "default".
+ */
+const char* getStencilIsa() noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Apply stencil to row-major data.
+ *
+ * Interior cells are processed by vectorized kernel selected for the CPU at
+ * runtime, only halo cells (stencil radius from border) use boundary
+ * handling. Values are stored as StorageRealType and weighted sums are
+ * computed in RealType.
+ *
+ * @param in       Input data.
+ * @param out      Output data, must not overlap input.
+ * @param size     Grid size.
+ * @param stencil  Stencil.
+ * @param boundary Boundary policy.
+ * @param value    Value outside grid for Dirichlet boundary.
+ */
+void applyStencil(const StorageRealType* in, StorageRealType* out, const Vector<unsigned int>& size,
+    const Stencil& stencil, StencilBoundary boundary, RealType value = 0) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Apply stencil to grid.
+ *
+ * @param in       Input grid.
+ * @param out      Output grid, resized to input size.
+ * @param stencil  Stencil.
+ * @param boundary Boundary policy.
+ * @param value    Value outside grid for Dirichlet boundary.
+ */
+template<typename Alloc>
+void applyStencil(const Grid<StorageRealType, Alloc>& in, Grid<StorageRealType, Alloc>& out,
+    const Stencil& stencil, StencilBoundary boundary, RealType value = 0)
+{
+    CECE_ASSERT(&in != &out);
+
+    if (out.getSize() != in.getSize())
+        out.resize(in.getSize());
+
+    applyStencil(in.getData(), out.getContainer().data(), in.getSize(), stencil, boundary, value);
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -27,7 +27,16 @@
 #include "cece/core/Log.hpp"
 
 // C++
+#include <chrono>
+#include <thread>
+#include <utility>
 #include <iostream>
+#include <condition_variable>
+
+// CeCe
+#include "cece/core/Map.hpp"
+#include "cece/core/Mutex.hpp"
+#include "cece/core/DynamicArray.hpp"
 
 /* ************************************************************************ */
 
@@ -74,6 +83,347 @@ void Log::StreamOutput::write(Type type, const String& section, const String& ms
 
 /* ************************************************************************ */
 
+struct Log::AsyncOutput::Impl
+{
+    /// Clock type.
+    using Clock = std::chrono::steady_clock;
+
+    /// Queued message.
+    struct Message
+    {
+        Type type;
+        String section;
+        String msg;
+    };
+
+    /// Queue slot.
+    struct Slot
+    {
+        /// Slot sequence number, tells if slot is free or filled.
+        Atomic<std::size_t> sequence;
+
+        /// Message.
+        Message message;
+    };
+
+    /// Output used by writer thread.
+    Output* output;
+
+    /// Maximum number of same messages per second.
+    unsigned int rateLimit;
+
+    /// Queue slots.
+    DynamicArray<Slot> slots;
+
+    /// Index mask.
+    std::size_t mask;
+
+    /// Enqueue position, shared by producers.
+    Atomic<std::size_t> enqueuePos{0};
+
+    /// Dequeue position, writer thread only.
+    std::size_t dequeuePos = 0;
+
+    /// Number of processed messages.
+    Atomic<std::size_t> processed{0};
+
+    /// Number of dropped messages.
+    Atomic<std::uint64_t> dropped{0};
+
+    /// If writer thread waits for messages.
+    Atomic<bool> sleeping{false};
+
+    /// If writer thread should stop.
+    Atomic<bool> stop{false};
+
+    /// If repeated and suppressed messages should be reported.
+    Atomic<bool> report{false};
+
+    /// Guards waiting.
+    Mutex mutex;
+
+    /// Wakes up writer thread.
+    std::condition_variable wakeUp;
+
+    /// Wakes up flushing threads.
+    std::condition_variable flushed;
+
+    /// Last written message.
+    Message last{Type::Default, String{}, String{}};
+
+    /// If last message is valid.
+    bool hasLast = false;
+
+    /// Number of times the last message was repeated.
+    unsigned long repeated = 0;
+
+    /// Start of rate limiting window.
+    Clock::time_point windowStart = Clock::now();
+
+    /// Number of messages in rate limiting window.
+    Map<String, unsigned int> window;
+
+    /// Number of suppressed messages in rate limiting window.
+    unsigned long suppressed = 0;
+
+    /// Writer thread.
+    std::thread thread;
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param out
+     * @param capacity
+     * @param limit
+     */
+    Impl(Output* out, std::size_t capacity, unsigned int limit)
+        : output(out)
+        , rateLimit(limit)
+    {
+        std::size_t size = 2;
+
+        while (size < capacity)
+            size <<= 1;
+
+        slots = DynamicArray<Slot>(size);
+        mask = size - 1;
+
+        for (std::size_t i = 0; i < size; ++i)
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+
+        thread = std::thread(&Impl::run, this);
+    }
+
+
+    /**
+     * @brief Store message into queue.
+     *
+     * @param message
+     *
+     * @return If message was stored.
+     */
+    bool push(Message message) noexcept
+    {
+        auto pos = enqueuePos.load(std::memory_order_relaxed);
+        Slot* slot;
+
+        for (;;)
+        {
+            slot = &slots[pos & mask];
+            const auto sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+
+            if (diff == 0)
+            {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                // Queue is full
+                return false;
+            }
+            else
+            {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->message = std::move(message);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+
+        return true;
+    }
+
+
+    /**
+     * @brief Take message from queue.
+     *
+     * @param message
+     *
+     * @return If there was a message.
+     */
+    bool pop(Message& message) noexcept
+    {
+        Slot& slot = slots[dequeuePos & mask];
+
+        if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1)
+            return false;
+
+        message = std::move(slot.message);
+        slot.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+        ++dequeuePos;
+
+        return true;
+    }
+
+
+    /**
+     * @brief Wake up writer thread if it waits.
+     */
+    void notify()
+    {
+        if (sleeping.load(std::memory_order_acquire))
+        {
+            MutexGuard _(mutex);
+            wakeUp.notify_one();
+        }
+    }
+
+
+    /**
+     * @brief Write message with deduplication and rate limiting.
+     *
+     * @param message
+     */
+    void process(Message& message)
+    {
+        if (hasLast && message.type == last.type && message.section == last.section && message.msg == last.msg)
+        {
+            ++repeated;
+            return;
+        }
+
+        reportRepeated();
+
+        if (rateLimit && ++window[message.msg] > rateLimit)
+        {
+            ++suppressed;
+            hasLast = false;
+            return;
+        }
+
+        output->write(message.type, message.section, message.msg);
+        last = std::move(message);
+        hasLast = true;
+    }
+
+
+    /**
+     * @brief Report repeated last message.
+     */
+    void reportRepeated()
+    {
+        if (!repeated)
+            return;
+
+        output->write(last.type, last.section, "Last message repeated " + toString(repeated) + " times");
+        repeated = 0;
+    }
+
+
+    /**
+     * @brief Report suppressed messages and start new rate limiting window.
+     */
+    void reportSuppressed()
+    {
+        if (suppressed)
+            output->write(Type::Warning, String{}, toString(suppressed) + " messages suppressed by rate limit");
+
+        suppressed = 0;
+        window.clear();
+        windowStart = Clock::now();
+    }
+
+
+    /**
+     * @brief Writer thread function.
+     */
+    void run()
+    {
+        Message message;
+
+        for (;;)
+        {
+            while (pop(message))
+            {
+                process(message);
+                processed.fetch_add(1, std::memory_order_release);
+            }
+
+            const bool stopping = stop.load(std::memory_order_acquire);
+
+            if (stopping || report.exchange(false) || Clock::now() - windowStart >= std::chrono::seconds(1))
+            {
+                reportRepeated();
+                reportSuppressed();
+            }
+
+            {
+                std::unique_lock<Mutex> lock(mutex);
+                flushed.notify_all();
+
+                if (stopping)
+                    break;
+
+                sleeping.store(true, std::memory_order_release);
+
+                // Messages stored before the flag was set are picked up after
+                // timeout at the latest
+                wakeUp.wait_for(lock, std::chrono::milliseconds(100));
+                sleeping.store(false, std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+/* ************************************************************************ */
+
+Log::AsyncOutput::AsyncOutput(Output* output, std::size_t capacity, unsigned int rateLimit)
+    : m_impl(new Impl{output, capacity, rateLimit})
+{
+    // Nothing to do
+}
+
+/* ************************************************************************ */
+
+Log::AsyncOutput::~AsyncOutput()
+{
+    {
+        MutexGuard _(m_impl->mutex);
+        m_impl->stop.store(true, std::memory_order_release);
+        m_impl->wakeUp.notify_one();
+    }
+
+    m_impl->thread.join();
+}
+
+/* ************************************************************************ */
+
+std::uint64_t Log::AsyncOutput::getDroppedCount() const noexcept
+{
+    return m_impl->dropped.load(std::memory_order_relaxed);
+}
+
+/* ************************************************************************ */
+
+void Log::AsyncOutput::write(Type type, const String& section, const String& msg)
+{
+    if (m_impl->push(Impl::Message{type, section, msg}))
+        m_impl->notify();
+    else
+        m_impl->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+/* ************************************************************************ */
+
+void Log::AsyncOutput::flush()
+{
+    const auto target = m_impl->enqueuePos.load(std::memory_order_acquire);
+
+    std::unique_lock<Mutex> lock(m_impl->mutex);
+    m_impl->report.store(true);
+    m_impl->wakeUp.notify_one();
+
+    m_impl->flushed.wait(lock, [this, target] {
+        return m_impl->processed.load(std::memory_order_acquire) >= target &&
+            !m_impl->report.load();
+    });
+}
+
+/* ************************************************************************ */
+
 Log::Output* Log::s_output = &g_output;
 
 /* ************************************************************************ */
@@ -82,6 +432,10 @@ Log::Output* Log::s_error = &g_error;
 
 /* ************************************************************************ */
 
+Atomic<Log::Type> Log::s_level{Log::Type::Debug};
+
+/* ************************************************************************ */
+
 }
 }
 
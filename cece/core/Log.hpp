@@ -27,9 +27,15 @@
 
 /* ************************************************************************ */
 
+// C++
+#include <cstddef>
+#include <cstdint>
+
 // CeCe
 #include "cece/export.hpp"
+#include "cece/core/Atomic.hpp"
 #include "cece/core/String.hpp"
+#include "cece/core/UniquePtr.hpp"
 #include "cece/core/OutStream.hpp"
 #include "cece/core/StringStream.hpp"
 #include "cece/core/CliColor.hpp"
@@ -136,6 +142,102 @@ public:
     };
 
 
+    /**
+     * @brief Output that passes messages to another output from a background
+     * thread.
+     *
+     * Messages are stored into a bounded lock-free queue so logging threads
+     * never wait for the output. Messages that don't fit into the queue are
+     * dropped. Repeated messages are collapsed into a single "repeated" note
+     * and each distinct message is limited to given number of writes per
+     * second.
+     */
+    class AsyncOutput : public Output
+    {
+    // Public Ctors & Dtors
+    public:
+
+        /**
+         * @brief Constructor.
+         *
+         * @param output    Output used by background thread.
+         * @param capacity  Queue capacity, rounded up to power of two.
+         * @param rateLimit Maximum number of same messages per second, zero
+         *                  means unlimited.
+         */
+        explicit AsyncOutput(Output* output, std::size_t capacity = 4096, unsigned int rateLimit = 10);
+
+
+        /**
+         * @brief Destructor. Writes all queued messages.
+         */
+        ~AsyncOutput();
+
+    // Public Accessors
+    public:
+
+        /**
+         * @brief Returns number of messages dropped because of full queue.
+         *
+         * @return
+         */
+        std::uint64_t getDroppedCount() const noexcept;
+
+    // Public Operations
+    public:
+
+        /**
+         * @brief Queue a message.
+         *
+         * @param type    Message type.
+         * @param section Message section.
+         * @param msg     Message to log.
+         */
+        void write(Type type, const String& section, const String& msg) override;
+
+
+        /**
+         * @brief Wait until all queued messages are written.
+         */
+        void flush();
+
+    // Private Data Members
+    private:
+
+        /// Implementation
+        struct Impl;
+        UniquePtr<Impl> m_impl;
+    };
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns the least severe logged message type.
+     *
+     * @return
+     */
+    static Type getLevel() noexcept
+    {
+        return s_level.load(std::memory_order_relaxed);
+    }
+
+
+    /**
+     * @brief Returns if messages of given type are logged.
+     *
+     * @param type Message type.
+     *
+     * @return
+     */
+    static bool isEnabled(Type type) noexcept
+    {
+        return getSeverity(type) >= getSeverity(getLevel());
+    }
+
+
 // Public Mutators
 public:
 
@@ -162,6 +264,20 @@ public:
     }
 
 
+    /**
+     * @brief Set the least severe logged message type. Less severe messages
+     * are discarded before they are formatted.
+     *
+     * Severity increases in order: Debug, Info (Default), Warning, Error.
+     *
+     * @param level
+     */
+    static void setLevel(Type level) noexcept
+    {
+        s_level.store(level, std::memory_order_relaxed);
+    }
+
+
 // Public Operators
 public:
 
@@ -174,7 +290,7 @@ public:
     template<typename... Args>
     static void info(Args&&... args)
     {
-        if (s_output)
+        if (s_output && isEnabled(Type::Info))
         {
             OutStringStream oss;
             message(oss, std::forward<Args>(args)...);
@@ -192,7 +308,7 @@ public:
     static void debug(Args&&... args)
     {
 #ifndef NDEBUG
-        if (s_output)
+        if (s_output && isEnabled(Type::Debug))
         {
             OutStringStream oss;
             message(oss, std::forward<Args>(args)...);
@@ -210,7 +326,7 @@ public:
     template<typename... Args>
     static void warning(Args&&... args)
     {
-        if (s_output)
+        if (s_output && isEnabled(Type::Warning))
         {
             OutStringStream oss;
             message(oss, std::forward<Args>(args)...);
@@ -227,7 +343,7 @@ public:
     template<typename... Args>
     static void error(Args&&... args)
     {
-        if (s_error)
+        if (s_error && isEnabled(Type::Error))
         {
             OutStringStream oss;
             message(oss, std::forward<Args>(args)...);
@@ -240,6 +356,24 @@ public:
 private:
 
 
+    /**
+     * @brief Returns message type severity.
+     *
+     * @param type
+     *
+     * @return
+     */
+    static constexpr int getSeverity(Type type) noexcept
+    {
+        return
+            type == Type::Debug ? 0 :
+            type == Type::Warning ? 2 :
+            type == Type::Error ? 3 :
+            1
+        ;
+    }
+
+
     /**
      * @brief Log message.
      */
@@ -271,6 +405,9 @@ private:
     /// Error output.
     static CECE_EXPORT Output* s_error;
 
+    /// The least severe logged message type.
+    static CECE_EXPORT Atomic<Type> s_level;
+
 };
 
 /* ************************************************************************ */
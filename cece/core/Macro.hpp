@@ -48,3 +48,55 @@
 #define XSTR(s) STR(s)
 
 /* ************************************************************************ */
+
+/**
+ * @brief Concatenate arguments.
+ *
+ * @param a First argument.
+ * @param b Second argument.
+ *
+ * @return ab.
+ */
+#define CONCAT(a, b) a ## b
+
+/* ************************************************************************ */
+
+/**
+ * @brief Concatenate values of arguments.
+ *
+ * @param a First macro name.
+ * @param b Second macro name.
+ *
+ * @return Concatenated macro values.
+ */
+#define XCONCAT(a, b) CONCAT(a, b)
+
+/* ************************************************************************ */
+
+/**
+ * @brief Restricted pointer qualifier, the pointed memory is not accessed
+ * by other pointers in the same scope.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CECE_RESTRICT __restrict__
+#elif defined(_MSC_VER)
+#define CECE_RESTRICT __restrict
+#else
+#define CECE_RESTRICT
+#endif
+
+/* ************************************************************************ */
+
+/**
+ * @brief Force inlining of function, e.g. kernel body shared by functions
+ * compiled for different instruction sets.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CECE_FORCE_INLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define CECE_FORCE_INLINE __forceinline
+#else
+#define CECE_FORCE_INLINE inline
+#endif
+
+/* ************************************************************************ */
@@ -0,0 +1,300 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+#include <new>
+#include <memory>
+#include <type_traits>
+
+// CeCe
+#include "cece/core/SharedPtr.hpp"
+#include "cece/core/MappedFile.hpp"
+#include "cece/core/Grid.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Allocator which places container data into memory mapped file.
+ *
+ * Default-inserted elements are default-initialized (not zeroed), so
+ * resizing a container over an existing file keeps its content. Container
+ * reallocation maps the file again and copies elements onto themselves,
+ * which is harmless for shared mappings; read-only containers must be
+ * sized only once.
+ *
+ * Only trivially copyable types are supported, they are stored as raw bytes.
+ *
+ * Copy of a container doesn't share the file: the copy gets a default
+ * constructed allocator which allocates on heap, so the copy is an
+ * independent snapshot. Copy assignment keeps the target allocator.
+ *
+ * @tparam T Element type.
+ */
+template<typename T>
+class MappedAllocator
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Mapped types must be trivially copyable");
+
+    template<typename U>
+    friend class MappedAllocator;
+
+// Public Types
+public:
+
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template <class U>
+    struct rebind { typedef MappedAllocator<U> other; };
+
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Default constructor, allocates on heap.
+     */
+    MappedAllocator() = default;
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param path File path.
+     * @param mode Open mode.
+     */
+    explicit MappedAllocator(FilePath path, MappedMode mode = MappedMode::ReadWrite)
+        : m_file(makeShared<MappedFile>(std::move(path), mode))
+    {
+        // Nothing to do
+    }
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param src
+     */
+    template <class U>
+    MappedAllocator(const MappedAllocator<U>& src) noexcept
+        : m_file(src.m_file)
+    {
+        // Nothing to do
+    }
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns mapped file.
+     *
+     * @return Mapped file or nullptr for heap allocator.
+     */
+    const SharedPtr<MappedFile>& getFile() const noexcept
+    {
+        return m_file;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Map memory for elements.
+     *
+     * @param n Number of required elements.
+     *
+     * @return
+     */
+    pointer allocate(size_type n)
+    {
+        if (!m_file)
+            return static_cast<pointer>(::operator new(n * sizeof(T)));
+
+        return reinterpret_cast<pointer>(m_file->map(n * sizeof(T)));
+    }
+
+
+    /**
+     * @brief Unmap memory.
+     *
+     * @param p
+     * @param n
+     */
+    void deallocate(pointer p, size_type n) noexcept
+    {
+        if (!m_file)
+            ::operator delete(p);
+        else
+            m_file->unmap(p, n * sizeof(T));
+    }
+
+
+    /**
+     * @brief Default-insert element, keeps mapped content.
+     *
+     * @param p
+     */
+    template <class U>
+    void construct(U* p) noexcept
+    {
+        ::new(reinterpret_cast<void*>(p)) U;
+    }
+
+
+    /**
+     * @brief Construct object in place.
+     *
+     * @param p
+     * @param args
+     */
+    template <class U, class ...Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new(reinterpret_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+
+    /**
+     * @brief Returns allocator for container copy.
+     *
+     * Copy would map the same file and write into the source data, so the
+     * copy is allocated on heap.
+     *
+     * @return
+     */
+    MappedAllocator select_on_container_copy_construction() const noexcept
+    {
+        return MappedAllocator();
+    }
+
+
+    /**
+     * @brief Write changes into the file (checkpoint).
+     */
+    void sync() const
+    {
+        if (m_file)
+            m_file->sync();
+    }
+
+
+    /**
+     * @brief Give hint about access pattern.
+     *
+     * @param access Access pattern.
+     */
+    void advise(MappedAccess access) const noexcept
+    {
+        if (m_file)
+            m_file->advise(access);
+    }
+
+
+// Private Data Members
+private:
+
+    /// Mapped file.
+    SharedPtr<MappedFile> m_file;
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compare allocators.
+ *
+ * @param t The first allocator.
+ * @param u The second allocator.
+ *
+ * @return
+ */
+template <typename T, typename U>
+inline bool operator==(const MappedAllocator<T>& t, const MappedAllocator<U>& u) noexcept
+{
+    return t.getFile() == u.getFile();
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compare allocators.
+ *
+ * @param t The first allocator.
+ * @param u The second allocator.
+ *
+ * @return
+ */
+template <typename T, typename U>
+inline bool operator!=(const MappedAllocator<T>& t, const MappedAllocator<U>& u) noexcept
+{
+    return !operator==(t, u);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid stored in memory mapped file.
+ *
+ * Example:
+ * @code
+ * MappedGrid<float> grid({4096, 4096}, MappedAllocator<float>("field.bin"));
+ * grid.getAllocator().advise(MappedAccess::Sequential);
+ * // ...
+ * grid.getAllocator().sync();
+ * @endcode
+ */
+template<typename T, typename Layout = GridLayoutRowMajor>
+using MappedGrid = Grid<T, MappedAllocator<T>, Layout>;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,246 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/MappedFile.hpp"
+
+// C++
+#include <cerrno>
+#include <cstring>
+
+// CeCe
+#include "cece/core/Exception.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CECE_MAPPED_FILE 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+#ifdef CECE_MAPPED_FILE
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Throw exception with errno description.
+ *
+ * @param what Failed operation.
+ * @param path File path.
+ */
+[[noreturn]] void throwError(const char* what, const FilePath& path)
+{
+    throw RuntimeException(String(what) + " '" + path.toString() + "': " + std::strerror(errno));
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+MappedFile::MappedFile(FilePath path, MappedMode mode)
+    : m_path(std::move(path))
+    , m_mode(mode)
+{
+    if (m_mode == MappedMode::ReadOnly)
+        m_fd = ::open(m_path.c_str(), O_RDONLY);
+    else
+        m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT, 0644);
+
+    if (m_fd < 0)
+        throwError("Unable to open file", m_path);
+}
+
+/* ************************************************************************ */
+
+MappedFile::~MappedFile()
+{
+    ::close(m_fd);
+}
+
+/* ************************************************************************ */
+
+std::size_t MappedFile::getFileSize() const
+{
+    struct stat info;
+
+    if (::fstat(m_fd, &info) != 0)
+        throwError("Unable to get size of file", m_path);
+
+    return static_cast<std::size_t>(info.st_size);
+}
+
+/* ************************************************************************ */
+
+void* MappedFile::map(std::size_t size)
+{
+    if (size == 0)
+        return nullptr;
+
+    if (getFileSize() < size)
+    {
+        if (m_mode == MappedMode::ReadOnly)
+            throw RuntimeException("File '" + m_path.toString() + "' is smaller than requested mapping");
+
+        if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+            throwError("Unable to extend file", m_path);
+    }
+
+    const int protection = m_mode == MappedMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    void* data = ::mmap(nullptr, size, protection, MAP_SHARED, m_fd, 0);
+
+    if (data == MAP_FAILED)
+        throwError("Unable to map file", m_path);
+
+    m_data = data;
+    m_size = size;
+
+    return data;
+}
+
+/* ************************************************************************ */
+
+void MappedFile::unmap(void* data, std::size_t size) noexcept
+{
+    if (data == nullptr)
+        return;
+
+    ::munmap(data, size);
+
+    if (data == m_data)
+    {
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
+/* ************************************************************************ */
+
+void MappedFile::sync()
+{
+    if (m_data == nullptr || m_mode == MappedMode::ReadOnly)
+        return;
+
+    if (::msync(m_data, m_size, MS_SYNC) != 0)
+        throwError("Unable to synchronize file", m_path);
+}
+
+/* ************************************************************************ */
+
+void MappedFile::advise(MappedAccess access) noexcept
+{
+    if (m_data == nullptr)
+        return;
+
+    int advice = MADV_NORMAL;
+
+    switch (access)
+    {
+    case MappedAccess::Normal:      advice = MADV_NORMAL; break;
+    case MappedAccess::Sequential:  advice = MADV_SEQUENTIAL; break;
+    case MappedAccess::Random:      advice = MADV_RANDOM; break;
+    case MappedAccess::WillNeed:    advice = MADV_WILLNEED; break;
+    case MappedAccess::DontNeed:    advice = MADV_DONTNEED; break;
+    }
+
+    // Only a hint
+    ::madvise(m_data, m_size, advice);
+}
+
+/* ************************************************************************ */
+
+#else
+
+/* ************************************************************************ */
+
+MappedFile::MappedFile(FilePath path, MappedMode mode)
+    : m_path(std::move(path))
+    , m_mode(mode)
+{
+    throw RuntimeException("Memory mapped files are not supported on this platform");
+}
+
+/* ************************************************************************ */
+
+MappedFile::~MappedFile() = default;
+
+/* ************************************************************************ */
+
+std::size_t MappedFile::getFileSize() const
+{
+    return 0;
+}
+
+/* ************************************************************************ */
+
+void* MappedFile::map(std::size_t size)
+{
+    return nullptr;
+}
+
+/* ************************************************************************ */
+
+void MappedFile::unmap(void* data, std::size_t size) noexcept
+{
+    // Nothing to do
+}
+
+/* ************************************************************************ */
+
+void MappedFile::sync()
+{
+    // Nothing to do
+}
+
+/* ************************************************************************ */
+
+void MappedFile::advise(MappedAccess access) noexcept
+{
+    // Nothing to do
+}
+
+/* ************************************************************************ */
+
+#endif
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
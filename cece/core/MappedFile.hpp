@@ -0,0 +1,238 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+
+// CeCe
+#include "cece/core/FilePath.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Memory mapped file open mode.
+ */
+enum class MappedMode
+{
+    /// Read and write, file is created and extended as required.
+    ReadWrite,
+
+    /// Read only, file must exist and be large enough.
+    ReadOnly
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Expected access pattern of mapped memory.
+ */
+enum class MappedAccess
+{
+    /// No special treatment.
+    Normal,
+
+    /// Sequential sweeps, aggressive read-ahead.
+    Sequential,
+
+    /// Random access, no read-ahead.
+    Random,
+
+    /// Data will be needed soon.
+    WillNeed,
+
+    /// Data will not be needed soon.
+    DontNeed
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief File mapped into memory (MAP_SHARED).
+ *
+ * Changes in mapped memory are written into the file by the OS, so data can
+ * be larger than RAM, persisted directly or shared with other processes.
+ */
+class MappedFile
+{
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param path File path.
+     * @param mode Open mode.
+     *
+     * @throw RuntimeException If file cannot be opened.
+     */
+    MappedFile(FilePath path, MappedMode mode = MappedMode::ReadWrite);
+
+
+    /**
+     * @brief Destructor.
+     */
+    ~MappedFile();
+
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns file path.
+     *
+     * @return
+     */
+    const FilePath& getPath() const noexcept
+    {
+        return m_path;
+    }
+
+
+    /**
+     * @brief Returns open mode.
+     *
+     * @return
+     */
+    MappedMode getMode() const noexcept
+    {
+        return m_mode;
+    }
+
+
+    /**
+     * @brief Returns current file size in bytes.
+     *
+     * @return
+     */
+    std::size_t getFileSize() const;
+
+
+    /**
+     * @brief Returns address of the last mapping.
+     *
+     * @return
+     */
+    void* getData() const noexcept
+    {
+        return m_data;
+    }
+
+
+    /**
+     * @brief Returns size of the last mapping in bytes.
+     *
+     * @return
+     */
+    std::size_t getSize() const noexcept
+    {
+        return m_size;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Map first bytes of the file.
+     *
+     * In read-write mode the file is extended when it's smaller.
+     *
+     * @param size Number of bytes.
+     *
+     * @return Mapped memory.
+     *
+     * @throw RuntimeException
+     */
+    void* map(std::size_t size);
+
+
+    /**
+     * @brief Unmap memory returned by map().
+     *
+     * @param data Mapped memory.
+     * @param size Number of bytes.
+     */
+    void unmap(void* data, std::size_t size) noexcept;
+
+
+    /**
+     * @brief Write changes of the last mapping into the file and wait.
+     *
+     * @throw RuntimeException
+     */
+    void sync();
+
+
+    /**
+     * @brief Give hint about access pattern of the last mapping.
+     *
+     * @param access Access pattern.
+     */
+    void advise(MappedAccess access) noexcept;
+
+
+// Private Data Members
+private:
+
+    /// File path.
+    FilePath m_path;
+
+    /// Open mode.
+    MappedMode m_mode;
+
+    /// File descriptor.
+    int m_fd = -1;
+
+    /// Last mapping.
+    void* m_data = nullptr;
+
+    /// Last mapping size.
+    std::size_t m_size = 0;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
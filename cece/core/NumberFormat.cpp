@@ -0,0 +1,734 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/NumberFormat.hpp"
+
+// C++
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Pairs of decimal digits "00" - "99".
+const char DIGITS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899"
+;
+
+/* ************************************************************************ */
+
+/// Powers of ten.
+const std::uint32_t POW10[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+/* ************************************************************************ */
+
+/// Cached powers of ten 10^-348, 10^-340, ..., 10^340 - significands.
+const std::uint64_t CACHED_POWERS_F[] = {
+    0xfa8fd5a0081c0288ull, 0xbaaee17fa23ebf76ull, 0x8b16fb203055ac76ull, 0xcf42894a5dce35eaull,
+    0x9a6bb0aa55653b2dull, 0xe61acf033d1a45dfull, 0xab70fe17c79ac6caull, 0xff77b1fcbebcdc4full,
+    0xbe5691ef416bd60cull, 0x8dd01fad907ffc3cull, 0xd3515c2831559a83ull, 0x9d71ac8fada6c9b5ull,
+    0xea9c227723ee8bcbull, 0xaecc49914078536dull, 0x823c12795db6ce57ull, 0xc21094364dfb5637ull,
+    0x9096ea6f3848984full, 0xd77485cb25823ac7ull, 0xa086cfcd97bf97f4ull, 0xef340a98172aace5ull,
+    0xb23867fb2a35b28eull, 0x84c8d4dfd2c63f3bull, 0xc5dd44271ad3cdbaull, 0x936b9fcebb25c996ull,
+    0xdbac6c247d62a584ull, 0xa3ab66580d5fdaf6ull, 0xf3e2f893dec3f126ull, 0xb5b5ada8aaff80b8ull,
+    0x87625f056c7c4a8bull, 0xc9bcff6034c13053ull, 0x964e858c91ba2655ull, 0xdff9772470297ebdull,
+    0xa6dfbd9fb8e5b88full, 0xf8a95fcf88747d94ull, 0xb94470938fa89bcfull, 0x8a08f0f8bf0f156bull,
+    0xcdb02555653131b6ull, 0x993fe2c6d07b7facull, 0xe45c10c42a2b3b06ull, 0xaa242499697392d3ull,
+    0xfd87b5f28300ca0eull, 0xbce5086492111aebull, 0x8cbccc096f5088ccull, 0xd1b71758e219652cull,
+    0x9c40000000000000ull, 0xe8d4a51000000000ull, 0xad78ebc5ac620000ull, 0x813f3978f8940984ull,
+    0xc097ce7bc90715b3ull, 0x8f7e32ce7bea5c70ull, 0xd5d238a4abe98068ull, 0x9f4f2726179a2245ull,
+    0xed63a231d4c4fb27ull, 0xb0de65388cc8ada8ull, 0x83c7088e1aab65dbull, 0xc45d1df942711d9aull,
+    0x924d692ca61be758ull, 0xda01ee641a708deaull, 0xa26da3999aef774aull, 0xf209787bb47d6b85ull,
+    0xb454e4a179dd1877ull, 0x865b86925b9bc5c2ull, 0xc83553c5c8965d3dull, 0x952ab45cfa97a0b3ull,
+    0xde469fbd99a05fe3ull, 0xa59bc234db398c25ull, 0xf6c69a72a3989f5cull, 0xb7dcbf5354e9beceull,
+    0x88fcf317f22241e2ull, 0xcc20ce9bd35c78a5ull, 0x98165af37b2153dfull, 0xe2a0b5dc971f303aull,
+    0xa8d9d1535ce3b396ull, 0xfb9b7cd9a4a7443cull, 0xbb764c4ca7a44410ull, 0x8bab8eefb6409c1aull,
+    0xd01fef10a657842cull, 0x9b10a4e5e9913129ull, 0xe7109bfba19c0c9dull, 0xac2820d9623bf429ull,
+    0x80444b5e7aa7cf85ull, 0xbf21e44003acdd2dull, 0x8e679c2f5e44ff8full, 0xd433179d9c8cb841ull,
+    0x9e19db92b4e31ba9ull, 0xeb96bf6ebadf77d9ull, 0xaf87023b9bf0ee6bull,
+};
+
+/* ************************************************************************ */
+
+/// Cached powers of ten - binary exponents.
+const std::int16_t CACHED_POWERS_E[] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066,
+};
+
+/* ************************************************************************ */
+
+/// Double significand bits.
+constexpr int DP_SIGNIFICAND_SIZE = 52;
+
+/// Double exponent bias (including significand).
+constexpr int DP_EXPONENT_BIAS = 0x3FF + DP_SIGNIFICAND_SIZE;
+
+/// Double hidden bit.
+constexpr std::uint64_t DP_HIDDEN_BIT = 0x0010000000000000ull;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Floating point number with 64-bit significand - f * 2^e.
+ */
+struct DiyFp
+{
+    /// Significand.
+    std::uint64_t f;
+
+    /// Binary exponent.
+    int e;
+
+
+    /**
+     * @brief Subtract numbers with same exponent.
+     */
+    DiyFp operator-(const DiyFp& rhs) const noexcept
+    {
+        return DiyFp{f - rhs.f, e};
+    }
+
+
+    /**
+     * @brief Multiply numbers (upper 64 bits, rounded).
+     */
+    DiyFp operator*(const DiyFp& rhs) const noexcept
+    {
+        const std::uint64_t M32 = 0xFFFFFFFFu;
+        const std::uint64_t a = f >> 32;
+        const std::uint64_t b = f & M32;
+        const std::uint64_t c = rhs.f >> 32;
+        const std::uint64_t d = rhs.f & M32;
+        const std::uint64_t ac = a * c;
+        const std::uint64_t bc = b * c;
+        const std::uint64_t ad = a * d;
+        const std::uint64_t bd = b * d;
+        std::uint64_t tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+        tmp += 1u << 31;
+
+        return DiyFp{ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + rhs.e + 64};
+    }
+
+
+    /**
+     * @brief Shift significand to have the highest bit set.
+     */
+    DiyFp normalize() const noexcept
+    {
+        DiyFp res = *this;
+
+        while (!(res.f & (std::uint64_t(1) << 63)))
+        {
+            res.f <<= 1;
+            res.e--;
+        }
+
+        return res;
+    }
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Decompose double value.
+ *
+ * @param value Finite positive value.
+ *
+ * @return
+ */
+DiyFp decompose(double value) noexcept
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const int biasedExponent = static_cast<int>((bits >> DP_SIGNIFICAND_SIZE) & 0x7FF);
+    const std::uint64_t significand = bits & (DP_HIDDEN_BIT - 1);
+
+    if (biasedExponent != 0)
+        return DiyFp{significand + DP_HIDDEN_BIT, biasedExponent - DP_EXPONENT_BIAS};
+    else
+        return DiyFp{significand, 1 - DP_EXPONENT_BIAS};
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate normalized boundaries m- and m+ of a value.
+ *
+ * @param v     Value.
+ * @param minus Lower boundary.
+ * @param plus  Upper boundary.
+ */
+void normalizedBoundaries(const DiyFp& v, DiyFp& minus, DiyFp& plus) noexcept
+{
+    plus = DiyFp{(v.f << 1) + 1, v.e - 1};
+
+    while (!(plus.f & (DP_HIDDEN_BIT << 1)))
+    {
+        plus.f <<= 1;
+        plus.e--;
+    }
+
+    plus.f <<= 64 - DP_SIGNIFICAND_SIZE - 2;
+    plus.e -= 64 - DP_SIGNIFICAND_SIZE - 2;
+
+    minus = (v.f == DP_HIDDEN_BIT)
+        ? DiyFp{(v.f << 2) - 1, v.e - 2}
+        : DiyFp{(v.f << 1) - 1, v.e - 1}
+    ;
+
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns cached power of ten c = 10^-K that brings binary exponent
+ * of value multiplied by c into range [-60, -32].
+ *
+ * @param e Binary exponent.
+ * @param K Decimal exponent.
+ *
+ * @return
+ */
+DiyFp getCachedPower(int e, int& K) noexcept
+{
+    const double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int k = static_cast<int>(dk);
+
+    if (dk - k > 0.0)
+        k++;
+
+    const unsigned index = static_cast<unsigned>((k >> 3) + 1);
+    K = -(-348 + static_cast<int>(index << 3));
+
+    return DiyFp{CACHED_POWERS_F[index], CACHED_POWERS_E[index]};
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns number of decimal digits.
+ *
+ * @param n
+ *
+ * @return
+ */
+int countDigits(std::uint32_t n) noexcept
+{
+    int count = 1;
+
+    while (count < 10 && n >= POW10[count])
+        ++count;
+
+    return count;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Move last generated digit closer to the exact value.
+ */
+void grisuRound(char* buffer, int len, std::uint64_t delta, std::uint64_t rest,
+    std::uint64_t tenKappa, std::uint64_t wpw) noexcept
+{
+    while (rest < wpw && delta - rest >= tenKappa &&
+        (rest + tenKappa < wpw || wpw - rest > rest + tenKappa - wpw))
+    {
+        buffer[len - 1]--;
+        rest += tenKappa;
+    }
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Generate shortest digits of value in range (Mp - delta, Mp).
+ */
+void digitGen(const DiyFp& W, const DiyFp& Mp, std::uint64_t delta, char* buffer, int& len, int& K) noexcept
+{
+    const DiyFp one{std::uint64_t(1) << -Mp.e, Mp.e};
+    const DiyFp wpw = Mp - W;
+    std::uint32_t p1 = static_cast<std::uint32_t>(Mp.f >> -one.e);
+    std::uint64_t p2 = Mp.f & (one.f - 1);
+    int kappa = countDigits(p1);
+    len = 0;
+
+    // Integral part
+    while (kappa > 0)
+    {
+        const std::uint32_t d = p1 / POW10[kappa - 1];
+        p1 %= POW10[kappa - 1];
+
+        if (d || len)
+            buffer[len++] = static_cast<char>('0' + d);
+
+        kappa--;
+        const std::uint64_t tmp = (static_cast<std::uint64_t>(p1) << -one.e) + p2;
+
+        if (tmp <= delta)
+        {
+            K += kappa;
+            grisuRound(buffer, len, delta, tmp, static_cast<std::uint64_t>(POW10[kappa]) << -one.e, wpw.f);
+            return;
+        }
+    }
+
+    // Fractional part
+    while (true)
+    {
+        p2 *= 10;
+        delta *= 10;
+        const char d = static_cast<char>(p2 >> -one.e);
+
+        if (d || len)
+            buffer[len++] = static_cast<char>('0' + d);
+
+        p2 &= one.f - 1;
+        kappa--;
+
+        if (p2 < delta)
+        {
+            K += kappa;
+            const int index = -kappa;
+            grisuRound(buffer, len, delta, p2, one.f, wpw.f * (index < 10 ? POW10[index] : 0));
+            return;
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Generate digits of positive finite value: value = digits * 10^K.
+ */
+void grisu2(double value, char* buffer, int& len, int& K) noexcept
+{
+    const DiyFp v = decompose(value);
+    DiyFp minus, plus;
+    normalizedBoundaries(v, minus, plus);
+
+    const DiyFp cached = getCachedPower(plus.e, K);
+    const DiyFp W = v.normalize() * cached;
+    DiyFp Wp = plus * cached;
+    DiyFp Wm = minus * cached;
+    Wm.f++;
+    Wp.f--;
+
+    digitGen(W, Wp, Wp.f - Wm.f, buffer, len, K);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Round generated digits by the rest of value.
+ *
+ * @param buffer   Digits.
+ * @param len      Number of digits.
+ * @param rest     Rest of value after the last digit.
+ * @param tenKappa Weight of the last digit.
+ * @param unit     Error of rest.
+ * @param kappa    Exponent of the last digit, it's increased when rounding
+ *                 up carries out of the first digit.
+ *
+ * @return If rounding direction is certain within the error.
+ */
+bool roundCounted(char* buffer, int len, std::uint64_t rest, std::uint64_t tenKappa,
+    std::uint64_t unit, int& kappa) noexcept
+{
+    if (unit >= tenKappa || tenKappa - unit <= unit)
+        return false;
+
+    // Rest with error is below half
+    if (tenKappa - rest > rest && tenKappa - 2 * rest >= 2 * unit)
+        return true;
+
+    // Rest with error is above half
+    if (rest > unit && tenKappa - (rest - unit) <= (rest - unit))
+    {
+        buffer[len - 1]++;
+
+        for (int i = len - 1; i > 0 && buffer[i] == '0' + 10; --i)
+        {
+            buffer[i] = '0';
+            buffer[i - 1]++;
+        }
+
+        if (buffer[0] == '0' + 10)
+        {
+            buffer[0] = '1';
+            kappa++;
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Generate given number of rounded digits of positive finite value:
+ * value = digits * 10^K.
+ *
+ * Digits are the same as correctly rounded digits of printf. Cases that
+ * can't be decided within the precision of the cached powers (mostly
+ * values close to a half of the last digit) are reported.
+ *
+ * @param value Value.
+ * @param count Number of digits, at most 9.
+ * @param buffer Output digits.
+ * @param K     Decimal exponent.
+ *
+ * @return If digits are generated.
+ */
+bool grisuCounted(double value, int count, char* buffer, int& K) noexcept
+{
+    const DiyFp v = decompose(value).normalize();
+    const DiyFp w = v * getCachedPower(v.e, K);
+
+    const DiyFp one{std::uint64_t(1) << -w.e, w.e};
+    std::uint32_t integrals = static_cast<std::uint32_t>(w.f >> -one.e);
+    std::uint64_t fractionals = w.f & (one.f - 1);
+    std::uint64_t error = 1;
+    int kappa = countDigits(integrals);
+    int len = 0;
+
+    // Integral part
+    while (kappa > 0 && len < count)
+    {
+        const std::uint32_t divisor = POW10[kappa - 1];
+        buffer[len++] = static_cast<char>('0' + integrals / divisor);
+        integrals %= divisor;
+        kappa--;
+    }
+
+    if (len == count)
+    {
+        const std::uint64_t rest = (static_cast<std::uint64_t>(integrals) << -one.e) + fractionals;
+
+        if (!roundCounted(buffer, len, rest, static_cast<std::uint64_t>(POW10[kappa]) << -one.e, error, kappa))
+            return false;
+
+        K += kappa;
+        return true;
+    }
+
+    // Fractional part
+    while (len < count)
+    {
+        if (fractionals <= error)
+            return false;
+
+        fractionals *= 10;
+        error *= 10;
+        buffer[len++] = static_cast<char>('0' + (fractionals >> -one.e));
+        fractionals &= one.f - 1;
+        kappa--;
+    }
+
+    if (!roundCounted(buffer, len, fractionals, one.f, error, kappa))
+        return false;
+
+    K += kappa;
+    return true;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Write exponent part of scientific notation with at least two
+ * digits, e.g. `e+05`.
+ */
+char* formatExponent(char* buffer, int exponent) noexcept
+{
+    *buffer++ = 'e';
+
+    unsigned absExponent;
+
+    if (exponent < 0)
+    {
+        *buffer++ = '-';
+        absExponent = static_cast<unsigned>(-exponent);
+    }
+    else
+    {
+        *buffer++ = '+';
+        absExponent = static_cast<unsigned>(exponent);
+    }
+
+    if (absExponent < 10)
+        *buffer++ = '0';
+
+    return formatUnsigned(buffer, absExponent);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Format value by printf, used for values without generated digits.
+ */
+char* formatPrintf(char* buffer, const char* format, double value) noexcept
+{
+    const int length = std::snprintf(buffer, NUMBER_FORMAT_BUFFER_SIZE, format, value);
+    return buffer + (length > 0 ? length : 0);
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+char* formatUnsigned(char* buffer, unsigned long long value) noexcept
+{
+    // Generate digits backward
+    char tmp[NUMBER_FORMAT_BUFFER_SIZE];
+    char* ptr = tmp + sizeof(tmp);
+
+    while (value >= 100)
+    {
+        const unsigned index = static_cast<unsigned>(value % 100) * 2;
+        value /= 100;
+        *--ptr = DIGITS[index + 1];
+        *--ptr = DIGITS[index];
+    }
+
+    if (value >= 10)
+    {
+        const unsigned index = static_cast<unsigned>(value) * 2;
+        *--ptr = DIGITS[index + 1];
+        *--ptr = DIGITS[index];
+    }
+    else
+    {
+        *--ptr = static_cast<char>('0' + value);
+    }
+
+    const std::size_t length = tmp + sizeof(tmp) - ptr;
+    std::memcpy(buffer, ptr, length);
+
+    return buffer + length;
+}
+
+/* ************************************************************************ */
+
+char* formatInteger(char* buffer, long long value) noexcept
+{
+    unsigned long long absolute = static_cast<unsigned long long>(value);
+
+    if (value < 0)
+    {
+        *buffer++ = '-';
+        absolute = 0 - absolute;
+    }
+
+    return formatUnsigned(buffer, absolute);
+}
+
+/* ************************************************************************ */
+
+char* formatRealGeneral(char* buffer, double value) noexcept
+{
+    constexpr int PRECISION = 6;
+
+    char digits[PRECISION];
+    int K;
+
+    if (!std::isfinite(value) || (value != 0.0 && !grisuCounted(std::abs(value), PRECISION, digits, K)))
+        return formatPrintf(buffer, "%g", value);
+
+    if (std::signbit(value))
+        *buffer++ = '-';
+
+    if (value == 0.0)
+    {
+        *buffer++ = '0';
+        return buffer;
+    }
+
+    const int exponent = K + PRECISION - 1;
+
+    // Trailing zeros are not written
+    int length = PRECISION;
+
+    while (length > 1 && digits[length - 1] == '0')
+        --length;
+
+    if (exponent < -4 || exponent >= PRECISION)
+    {
+        *buffer++ = digits[0];
+
+        if (length > 1)
+        {
+            *buffer++ = '.';
+            std::memcpy(buffer, digits + 1, length - 1);
+            buffer += length - 1;
+        }
+
+        return formatExponent(buffer, exponent);
+    }
+
+    if (exponent < 0)
+    {
+        *buffer++ = '0';
+        *buffer++ = '.';
+        std::memset(buffer, '0', -exponent - 1);
+        buffer += -exponent - 1;
+        std::memcpy(buffer, digits, length);
+        return buffer + length;
+    }
+
+    // Integral digits can be trailing zeros
+    std::memcpy(buffer, digits, exponent + 1);
+    buffer += exponent + 1;
+
+    if (length > exponent + 1)
+    {
+        *buffer++ = '.';
+        std::memcpy(buffer, digits + exponent + 1, length - exponent - 1);
+        buffer += length - exponent - 1;
+    }
+
+    return buffer;
+}
+
+/* ************************************************************************ */
+
+char* formatRealScientific(char* buffer, double value) noexcept
+{
+    constexpr int PRECISION = 7;
+
+    char digits[PRECISION];
+    int K;
+
+    if (!std::isfinite(value) || (value != 0.0 && !grisuCounted(std::abs(value), PRECISION, digits, K)))
+        return formatPrintf(buffer, "%e", value);
+
+    if (std::signbit(value))
+        *buffer++ = '-';
+
+    if (value == 0.0)
+    {
+        std::memcpy(buffer, "0.000000e+00", 12);
+        return buffer + 12;
+    }
+
+    *buffer++ = digits[0];
+    *buffer++ = '.';
+    std::memcpy(buffer, digits + 1, PRECISION - 1);
+    buffer += PRECISION - 1;
+
+    return formatExponent(buffer, K + PRECISION - 1);
+}
+
+/* ************************************************************************ */
+
+char* formatReal(char* buffer, double value) noexcept
+{
+    if (std::isnan(value))
+    {
+        std::memcpy(buffer, "nan", 3);
+        return buffer + 3;
+    }
+
+    if (std::signbit(value))
+    {
+        *buffer++ = '-';
+        value = -value;
+    }
+
+    if (std::isinf(value))
+    {
+        std::memcpy(buffer, "inf", 3);
+        return buffer + 3;
+    }
+
+    if (value == 0.0)
+    {
+        std::memcpy(buffer, "0e+00", 5);
+        return buffer + 5;
+    }
+
+    // Digits are written after the first digit to make space for dot
+    int length;
+    int K;
+    grisu2(value, buffer + 1, length, K);
+
+    const int exponent = length + K - 1;
+
+    buffer[0] = buffer[1];
+
+    if (length > 1)
+    {
+        buffer[1] = '.';
+        buffer += length + 1;
+    }
+    else
+    {
+        buffer += 1;
+    }
+
+    return formatExponent(buffer, exponent);
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
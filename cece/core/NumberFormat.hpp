@@ -0,0 +1,120 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Minimum size of buffer passed to number formatting functions.
+ */
+constexpr std::size_t NUMBER_FORMAT_BUFFER_SIZE = 32;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Format signed integer value.
+ *
+ * @param buffer Output buffer, at least NUMBER_FORMAT_BUFFER_SIZE long.
+ * @param value  Formatted value.
+ *
+ * @return Pointer past the last written character.
+ */
+char* formatInteger(char* buffer, long long value) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Format unsigned integer value.
+ *
+ * @param buffer Output buffer, at least NUMBER_FORMAT_BUFFER_SIZE long.
+ * @param value  Formatted value.
+ *
+ * @return Pointer past the last written character.
+ */
+char* formatUnsigned(char* buffer, unsigned long long value) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Format real value with six significant digits.
+ *
+ * Output is the same as default stream output (`%g`), e.g. `1.5`, `1e+06`.
+ *
+ * @param buffer Output buffer, at least NUMBER_FORMAT_BUFFER_SIZE long.
+ * @param value  Formatted value.
+ *
+ * @return Pointer past the last written character.
+ */
+char* formatRealGeneral(char* buffer, double value) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Format real value in scientific notation with six decimal digits.
+ *
+ * Output is the same as stream output with `std::scientific` (`%e`),
+ * e.g. `1.500000e+00`.
+ *
+ * @param buffer Output buffer, at least NUMBER_FORMAT_BUFFER_SIZE long.
+ * @param value  Formatted value.
+ *
+ * @return Pointer past the last written character.
+ */
+char* formatRealScientific(char* buffer, double value) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Format real value in scientific notation.
+ *
+ * Value is written with the shortest (in almost all cases) number of digits
+ * that parse back to the same double (Grisu2 algorithm) and the exponent
+ * has at least two digits, e.g. `1.5e+00`, `-2.2250738585072014e-308`.
+ * Infinity and NaN are written as `inf`, `-inf` and `nan`.
+ *
+ * @param buffer Output buffer, at least NUMBER_FORMAT_BUFFER_SIZE long.
+ * @param value  Formatted value.
+ *
+ * @return Pointer past the last written character.
+ */
+char* formatReal(char* buffer, double value) noexcept;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
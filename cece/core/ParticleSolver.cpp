@@ -0,0 +1,496 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/ParticleSolver.hpp"
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// CeCe
+#include "cece/core/Macro.hpp"
+#include "cece/core/Assert.hpp"
+#include "cece/core/constants.hpp"
+#include "cece/core/FastMath.hpp"
+#include "cece/core/CpuFeatures.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Maximum number of substeps of single step.
+constexpr std::size_t MAX_SUBSTEPS = 64;
+
+/* ************************************************************************ */
+
+/// Number of contacting neighbours used for stable time step.
+constexpr RealType MAX_NEIGHBOURS = 6;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Pair kernel type.
+ *
+ * @param dx        X components of distance vectors.
+ * @param dy        Y components of distance vectors.
+ * @param r         Sums of radii.
+ * @param count     Number of pairs.
+ * @param stiffness Contact stiffness.
+ * @param fx        X components of output forces.
+ * @param fy        Y components of output forces.
+ */
+using PairKernelFn = void (*)(const RealType* dx, const RealType* dy, const RealType* r,
+    std::size_t count, RealType stiffness, RealType* fx, RealType* fy);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compute forces between pairs of particles.
+ *
+ * The force points along the distance vector. Pairs at the same position
+ * have no direction and get zero force.
+ */
+CECE_FORCE_INLINE
+void pairForcesImpl(const RealType* CECE_RESTRICT dx, const RealType* CECE_RESTRICT dy,
+    const RealType* CECE_RESTRICT r, std::size_t count, RealType stiffness,
+    RealType* CECE_RESTRICT fx, RealType* CECE_RESTRICT fy) noexcept
+{
+    for (std::size_t p = 0; p < count; ++p)
+    {
+        // Library sqrt may set errno and the loop wouldn't vectorize
+        const double distanceSq = static_cast<double>(dx[p]) * dx[p] + static_cast<double>(dy[p]) * dy[p];
+        const double invDistance = distanceSq > 0 ? math::rsqrtApprox<true>(distanceSq) : 0.0;
+        const RealType overlap = static_cast<RealType>(r[p] - distanceSq * invDistance);
+        const RealType scale = overlap > 0 ? static_cast<RealType>(stiffness * overlap * invDistance) : RealType(0);
+
+        fx[p] = scale * dx[p];
+        fy[p] = scale * dy[p];
+    }
+}
+
+/* ************************************************************************ */
+
+CECE_KERNEL
+void pairForcesDefault(const RealType* dx, const RealType* dy, const RealType* r,
+    std::size_t count, RealType stiffness, RealType* fx, RealType* fy) noexcept
+{
+    pairForcesImpl(dx, dy, r, count, stiffness, fx, fy);
+}
+
+/* ************************************************************************ */
+
+#ifdef CECE_CPU_DISPATCH
+
+CECE_TARGET("avx2,fma") CECE_KERNEL
+void pairForcesAvx2(const RealType* dx, const RealType* dy, const RealType* r,
+    std::size_t count, RealType stiffness, RealType* fx, RealType* fy) noexcept
+{
+    pairForcesImpl(dx, dy, r, count, stiffness, fx, fy);
+}
+
+/* ************************************************************************ */
+
+CECE_TARGET("avx512f") CECE_KERNEL
+void pairForcesAvx512(const RealType* dx, const RealType* dy, const RealType* r,
+    std::size_t count, RealType stiffness, RealType* fx, RealType* fy) noexcept
+{
+    pairForcesImpl(dx, dy, r, count, stiffness, fx, fy);
+}
+
+#endif
+
+/* ************************************************************************ */
+
+/**
+ * @brief Select pair kernel for current CPU.
+ *
+ * @return
+ */
+PairKernelFn selectPairKernel() noexcept
+{
+#ifdef CECE_CPU_DISPATCH
+    if (hasCpuFeature(CpuFeature::Avx512f))
+        return pairForcesAvx512;
+
+    if (hasCpuFeature(CpuFeature::Avx2) && hasCpuFeature(CpuFeature::Fma))
+        return pairForcesAvx2;
+#endif
+
+    return pairForcesDefault;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns pair kernel for current CPU.
+ *
+ * @return
+ */
+PairKernelFn getPairKernel() noexcept
+{
+    static const PairKernelFn kernel = selectPairKernel();
+    return kernel;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+RealType ParticleSolver::getStableTimeStep() const noexcept
+{
+    const RealType stiffness = MAX_NEIGHBOURS * m_stiffness;
+
+    if (stiffness <= 0)
+        return 0;
+
+    const RealType drag = 6 * constants::PI * m_viscosity;
+    RealType result = 0;
+
+    // Semi-implicit Euler with implicit drag is stable for
+    // dt^2 * k < 4 * m + 2 * dt * gamma
+    for (std::size_t i = 0; i < getCount(); ++i)
+    {
+        if (m_inverseMass[i] <= 0)
+            continue;
+
+        const RealType mass = 1 / m_inverseMass[i];
+        const RealType gamma = drag * m_radius[i];
+        const RealType dt = (gamma + std::sqrt(gamma * gamma + 4 * stiffness * mass)) / stiffness;
+
+        if (result == 0 || dt < result)
+            result = dt;
+    }
+
+    return result;
+}
+
+/* ************************************************************************ */
+
+void ParticleSolver::resize(std::size_t count)
+{
+    CECE_ASSERT(count <= std::numeric_limits<std::uint32_t>::max());
+
+    m_position.resize(count, Zero);
+    m_velocity.resize(count, Zero);
+    m_force.resize(count, Zero);
+    m_radius.resize(count, 0);
+    m_inverseMass.resize(count, 0);
+}
+
+/* ************************************************************************ */
+
+void ParticleSolver::computeContactForces()
+{
+    addContactForces(m_force);
+}
+
+/* ************************************************************************ */
+
+void ParticleSolver::step(RealType dt)
+{
+    if (getCount() == 0 || dt <= 0)
+    {
+        m_force.fill(Zero);
+        return;
+    }
+
+    const RealType stable = getStableTimeStep();
+    std::size_t substeps = 1;
+
+    if (stable > 0 && dt > stable)
+        substeps = std::min(MAX_SUBSTEPS, static_cast<std::size_t>(std::ceil(dt / stable)));
+
+    const RealType h = dt / substeps;
+
+    for (std::size_t s = 0; s < substeps; ++s)
+    {
+        m_stepForce = m_force;
+        addContactForces(m_stepForce);
+        integrate(h, m_stepForce);
+    }
+
+    m_force.fill(Zero);
+}
+
+/* ************************************************************************ */
+
+void ParticleSolver::findPairs()
+{
+    m_pairFirst.clear();
+    m_pairSecond.clear();
+
+    const std::size_t count = getCount();
+
+    if (count < 2)
+        return;
+
+    const RealType* x = m_position.getComponent(0);
+    const RealType* y = m_position.getComponent(1);
+
+    RealType minX = x[0], maxX = x[0];
+    RealType minY = y[0], maxY = y[0];
+    RealType maxRadius = 0;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        minX = std::min(minX, x[i]);
+        maxX = std::max(maxX, x[i]);
+        minY = std::min(minY, y[i]);
+        maxY = std::max(maxY, y[i]);
+        maxRadius = std::max(maxRadius, m_radius[i]);
+    }
+
+    // Particles without size never overlap
+    if (maxRadius <= 0)
+        return;
+
+    // Any overlapping pair is in the same or neighbouring cells. Cells are
+    // enlarged when particles are sparse to keep the grid small.
+    const RealType maxCells = static_cast<RealType>(2 * count + 16);
+    RealType cellSize = 2 * maxRadius;
+    RealType width, height;
+
+    while (true)
+    {
+        width = std::floor((maxX - minX) / cellSize) + 1;
+        height = std::floor((maxY - minY) / cellSize) + 1;
+
+        if (width * height <= maxCells)
+            break;
+
+        cellSize *= 2;
+    }
+
+    const std::size_t nx = static_cast<std::size_t>(width);
+    const std::size_t ny = static_cast<std::size_t>(height);
+    const std::size_t cells = nx * ny;
+    const RealType invCellSize = 1 / cellSize;
+
+    // Counting sort by cell
+    m_cell.resize(count);
+    m_cellStart.assign(cells + 1, 0);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto cx = std::min(static_cast<std::size_t>((x[i] - minX) * invCellSize), nx - 1);
+        const auto cy = std::min(static_cast<std::size_t>((y[i] - minY) * invCellSize), ny - 1);
+        const auto cell = static_cast<std::uint32_t>(cy * nx + cx);
+
+        m_cell[i] = cell;
+        ++m_cellStart[cell];
+    }
+
+    for (std::size_t c = 1; c < cells; ++c)
+        m_cellStart[c] += m_cellStart[c - 1];
+
+    m_cellStart[cells] = static_cast<std::uint32_t>(count);
+    m_order.resize(count);
+
+    for (std::size_t i = count; i-- > 0; )
+        m_order[--m_cellStart[m_cell[i]]] = static_cast<std::uint32_t>(i);
+
+    m_sortedPosition.gather(m_position, m_order.data(), count);
+    m_sortedRadius.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        m_sortedRadius[i] = m_radius[m_order[i]];
+
+    // Half stencil, each pair is visited once. Sorted particles of the cell
+    // and its right neighbour are contiguous, so are the three cells of
+    // the next row. The first range starts after the particle itself.
+    struct Ranges
+    {
+        std::size_t end;
+        std::size_t rowBegin;
+        std::size_t rowEnd;
+    };
+
+    auto getRanges = [this, nx, ny] (std::size_t cx, std::size_t cy) -> Ranges {
+        const std::size_t cell = cy * nx + cx;
+        const std::size_t end = m_cellStart[cx + 1 < nx ? cell + 2 : cell + 1];
+
+        if (cy + 1 >= ny)
+            return {end, 0, 0};
+
+        const std::size_t row = (cy + 1) * nx;
+
+        return {
+            end,
+            m_cellStart[row + (cx > 0 ? cx - 1 : 0)],
+            m_cellStart[row + std::min(cx + 1, nx - 1) + 1]
+        };
+    };
+
+    // Count pairs first, arrays are filled without reallocation
+    std::size_t pairs = 0;
+
+    for (std::size_t cy = 0; cy < ny; ++cy)
+    {
+        for (std::size_t cx = 0; cx < nx; ++cx)
+        {
+            const std::size_t cell = cy * nx + cx;
+            const auto ranges = getRanges(cx, cy);
+
+            for (std::size_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i)
+                pairs += (ranges.end - i - 1) + (ranges.rowEnd - ranges.rowBegin);
+        }
+    }
+
+    m_pairFirst.resize(pairs);
+    m_pairSecond.resize(pairs);
+    m_pairDelta.resize(pairs);
+    m_pairRadius.resize(pairs);
+
+    const RealType* sx = m_sortedPosition.getComponent(0);
+    const RealType* sy = m_sortedPosition.getComponent(1);
+    const RealType* sr = m_sortedRadius.data();
+    std::uint32_t* first = m_pairFirst.data();
+    std::uint32_t* second = m_pairSecond.data();
+    RealType* dx = m_pairDelta.getComponent(0);
+    RealType* dy = m_pairDelta.getComponent(1);
+    RealType* rr = m_pairRadius.data();
+    std::size_t p = 0;
+
+    auto addPairs = [&] (std::size_t i, std::size_t begin, std::size_t end) {
+        for (std::size_t j = begin; j < end; ++j, ++p)
+        {
+            first[p] = static_cast<std::uint32_t>(i);
+            second[p] = static_cast<std::uint32_t>(j);
+            dx[p] = sx[j] - sx[i];
+            dy[p] = sy[j] - sy[i];
+            rr[p] = sr[i] + sr[j];
+        }
+    };
+
+    for (std::size_t cy = 0; cy < ny; ++cy)
+    {
+        for (std::size_t cx = 0; cx < nx; ++cx)
+        {
+            const std::size_t cell = cy * nx + cx;
+            const auto ranges = getRanges(cx, cy);
+
+            for (std::size_t i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i)
+            {
+                addPairs(i, i + 1, ranges.end);
+                addPairs(i, ranges.rowBegin, ranges.rowEnd);
+            }
+        }
+    }
+
+    CECE_ASSERT(p == pairs);
+}
+
+/* ************************************************************************ */
+
+void ParticleSolver::addContactForces(VectorArray<RealType>& forces)
+{
+    CECE_ASSERT(forces.getSize() == getCount());
+
+    if (m_stiffness <= 0)
+        return;
+
+    findPairs();
+
+    const std::size_t pairs = m_pairFirst.size();
+
+    if (pairs == 0)
+        return;
+
+    m_pairForce.resize(pairs);
+
+    getPairKernel()(
+        m_pairDelta.getComponent(0), m_pairDelta.getComponent(1), m_pairRadius.data(),
+        pairs, m_stiffness, m_pairForce.getComponent(0), m_pairForce.getComponent(1)
+    );
+
+    // Sum in sorted order where pair particles are close in memory and
+    // store each sum once
+    const std::size_t count = getCount();
+
+    for (unsigned d = 0; d < 2; ++d)
+    {
+        m_sortedForce.assign(count, 0);
+
+        RealType* sum = m_sortedForce.data();
+        const RealType* in = m_pairForce.getComponent(d);
+
+        for (std::size_t p = 0; p < pairs; ++p)
+        {
+            sum[m_pairFirst[p]] -= in[p];
+            sum[m_pairSecond[p]] += in[p];
+        }
+
+        RealType* out = forces.getComponent(d);
+
+        for (std::size_t i = 0; i < count; ++i)
+            out[m_order[i]] += sum[i];
+    }
+}
+
+/* ************************************************************************ */
+
+void ParticleSolver::integrate(RealType dt, const VectorArray<RealType>& forces) noexcept
+{
+    CECE_ASSERT(forces.getSize() == getCount());
+
+    const RealType drag = 6 * constants::PI * m_viscosity;
+    const RealType* CECE_RESTRICT radius = m_radius.data();
+    const RealType* CECE_RESTRICT inverseMass = m_inverseMass.data();
+
+    for (unsigned d = 0; d < 2; ++d)
+    {
+        RealType* CECE_RESTRICT position = m_position.getComponent(d);
+        RealType* CECE_RESTRICT velocity = m_velocity.getComponent(d);
+        const RealType* CECE_RESTRICT force = forces.getComponent(d);
+
+        // Drag is integrated implicitly, it's stable for any viscosity
+        for (std::size_t i = 0; i < getCount(); ++i)
+        {
+            const RealType movable = inverseMass[i] > 0 ? RealType(1) : RealType(0);
+            const RealType damping = 1 / (1 + dt * drag * radius[i] * inverseMass[i]);
+
+            velocity[i] = (velocity[i] + dt * force[i] * inverseMass[i]) * damping * movable;
+            position[i] += dt * velocity[i];
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
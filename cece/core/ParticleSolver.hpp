@@ -0,0 +1,386 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+#include <cstdint>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/VectorArray.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Solver for circular particles with overlap repulsion and drag.
+ *
+ * Particles are stored as structure of arrays. Overlapping particles are
+ * pushed apart by linear spring force proportional to overlap and moving
+ * particles are slowed by Stokes drag. Candidate pairs are found by uniform
+ * grid with cell size of the largest particle diameter and pair forces are
+ * computed by a vectorized kernel selected for current CPU.
+ *
+ * Values are unitless, they only have to be consistent (e.g. SI values of
+ * the simulation units). Particles with zero inverse mass don't move.
+ */
+class ParticleSolver
+{
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns number of particles.
+     *
+     * @return
+     */
+    std::size_t getCount() const noexcept
+    {
+        return m_radius.size();
+    }
+
+
+    /**
+     * @brief Returns contact stiffness.
+     *
+     * @return
+     */
+    RealType getStiffness() const noexcept
+    {
+        return m_stiffness;
+    }
+
+
+    /**
+     * @brief Returns dynamic viscosity of fluid used for drag.
+     *
+     * @return
+     */
+    RealType getViscosity() const noexcept
+    {
+        return m_viscosity;
+    }
+
+
+    /**
+     * @brief Returns particle positions.
+     *
+     * @return
+     */
+    VectorArray<RealType>& getPositions() noexcept
+    {
+        return m_position;
+    }
+
+
+    /**
+     * @brief Returns particle positions.
+     *
+     * @return
+     */
+    const VectorArray<RealType>& getPositions() const noexcept
+    {
+        return m_position;
+    }
+
+
+    /**
+     * @brief Returns particle velocities.
+     *
+     * @return
+     */
+    VectorArray<RealType>& getVelocities() noexcept
+    {
+        return m_velocity;
+    }
+
+
+    /**
+     * @brief Returns particle velocities.
+     *
+     * @return
+     */
+    const VectorArray<RealType>& getVelocities() const noexcept
+    {
+        return m_velocity;
+    }
+
+
+    /**
+     * @brief Returns forces applied in the next step.
+     *
+     * Forces are cleared by step.
+     *
+     * @return
+     */
+    VectorArray<RealType>& getForces() noexcept
+    {
+        return m_force;
+    }
+
+
+    /**
+     * @brief Returns forces applied in the next step.
+     *
+     * @return
+     */
+    const VectorArray<RealType>& getForces() const noexcept
+    {
+        return m_force;
+    }
+
+
+    /**
+     * @brief Returns particle radii.
+     *
+     * @return
+     */
+    DynamicArray<RealType>& getRadii() noexcept
+    {
+        return m_radius;
+    }
+
+
+    /**
+     * @brief Returns particle radii.
+     *
+     * @return
+     */
+    const DynamicArray<RealType>& getRadii() const noexcept
+    {
+        return m_radius;
+    }
+
+
+    /**
+     * @brief Returns inverse particle masses.
+     *
+     * @return
+     */
+    DynamicArray<RealType>& getInverseMasses() noexcept
+    {
+        return m_inverseMass;
+    }
+
+
+    /**
+     * @brief Returns inverse particle masses.
+     *
+     * @return
+     */
+    const DynamicArray<RealType>& getInverseMasses() const noexcept
+    {
+        return m_inverseMass;
+    }
+
+
+    /**
+     * @brief Returns number of candidate pairs found in the last contact
+     * force computation.
+     *
+     * @return
+     */
+    std::size_t getPairCount() const noexcept
+    {
+        return m_pairFirst.size();
+    }
+
+
+    /**
+     * @brief Returns the longest time step which keeps integration stable.
+     *
+     * It's computed for particle with six neighbours in contact, which is
+     * the densest packing of equal circles.
+     *
+     * @return Time step or zero when there is no limit.
+     */
+    RealType getStableTimeStep() const noexcept;
+
+
+// Public Mutators
+public:
+
+
+    /**
+     * @brief Change contact stiffness.
+     *
+     * @param stiffness Force per unit of overlap.
+     */
+    void setStiffness(RealType stiffness) noexcept
+    {
+        m_stiffness = stiffness;
+    }
+
+
+    /**
+     * @brief Change dynamic viscosity of fluid used for drag.
+     *
+     * @param viscosity
+     */
+    void setViscosity(RealType viscosity) noexcept
+    {
+        m_viscosity = viscosity;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Change number of particles.
+     *
+     * New particles are placed at origin with zero radius and velocity and
+     * they are immovable.
+     *
+     * @param count
+     */
+    void resize(std::size_t count);
+
+
+    /**
+     * @brief Add contact forces of overlapping particles to forces.
+     */
+    void computeContactForces();
+
+
+    /**
+     * @brief Advance particles by given time.
+     *
+     * The step is split into substeps not longer than stable time step.
+     * Contact and drag forces are computed for each substep, given forces
+     * are applied during whole step and cleared afterwards.
+     *
+     * @param dt Time step.
+     */
+    void step(RealType dt);
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Sort particles into grid cells and find candidate pairs.
+     */
+    void findPairs();
+
+
+    /**
+     * @brief Add contact forces of overlapping particles.
+     *
+     * @param forces Forces of particles.
+     */
+    void addContactForces(VectorArray<RealType>& forces);
+
+
+    /**
+     * @brief Integrate velocities and positions.
+     *
+     * @param dt     Time step.
+     * @param forces Forces applied to particles.
+     */
+    void integrate(RealType dt, const VectorArray<RealType>& forces) noexcept;
+
+
+// Private Data Members
+private:
+
+    /// Contact stiffness.
+    RealType m_stiffness = 0;
+
+    /// Dynamic viscosity.
+    RealType m_viscosity = 0;
+
+    /// Positions.
+    VectorArray<RealType> m_position;
+
+    /// Velocities.
+    VectorArray<RealType> m_velocity;
+
+    /// Applied forces.
+    VectorArray<RealType> m_force;
+
+    /// Radii.
+    DynamicArray<RealType> m_radius;
+
+    /// Inverse masses.
+    DynamicArray<RealType> m_inverseMass;
+
+    /// Particle indices sorted by grid cell.
+    DynamicArray<std::uint32_t> m_order;
+
+    /// Grid cell of each particle.
+    DynamicArray<std::uint32_t> m_cell;
+
+    /// Index of the first sorted particle in each cell, one extra at the end.
+    DynamicArray<std::uint32_t> m_cellStart;
+
+    /// Positions in sorted order.
+    VectorArray<RealType> m_sortedPosition;
+
+    /// Radii in sorted order.
+    DynamicArray<RealType> m_sortedRadius;
+
+    /// The first particle of candidate pairs, sorted index.
+    DynamicArray<std::uint32_t> m_pairFirst;
+
+    /// The second particle of candidate pairs, sorted index.
+    DynamicArray<std::uint32_t> m_pairSecond;
+
+    /// Distance vectors of candidate pairs, from the first to the second.
+    VectorArray<RealType> m_pairDelta;
+
+    /// Sums of radii of candidate pairs.
+    DynamicArray<RealType> m_pairRadius;
+
+    /// Forces between candidate pairs, applied to the second particle.
+    VectorArray<RealType> m_pairForce;
+
+    /// Sum of pair forces of single component in sorted order.
+    DynamicArray<RealType> m_sortedForce;
+
+    /// Forces used by substeps.
+    VectorArray<RealType> m_stepForce;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,306 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/PerfCounters.hpp"
+
+#if __linux__
+// C++
+#include <cstring>
+
+// Linux
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+#if __linux__
+
+/**
+ * @brief Open perf event counting current thread in user space.
+ *
+ * @param type   Event type.
+ * @param config Event config.
+ * @param group  Group leader descriptor or -1.
+ *
+ * @return File descriptor or -1.
+ */
+int openEvent(std::uint32_t type, std::uint64_t config, int group) noexcept
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = group == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group, 0));
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Counter group of single thread.
+ */
+class CounterGroup
+{
+public:
+
+    /**
+     * @brief Constructor. Opens counters, the first one (cycles) is the group
+     * leader and without it no counters are available.
+     */
+    CounterGroup() noexcept
+    {
+        static const std::uint64_t L1_MISSES =
+            PERF_COUNT_HW_CACHE_L1D |
+            (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+        static const struct { std::uint32_t type; std::uint64_t config; } EVENTS[PERF_COUNTER_COUNT] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, L1_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+        };
+
+        for (std::size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+        {
+            const int fd = openEvent(EVENTS[i].type, EVENTS[i].config, m_leader);
+
+            if (fd == -1)
+            {
+                if (i == 0)
+                    return;
+
+                continue;
+            }
+
+            if (i == 0)
+                m_leader = fd;
+            else
+                m_fds[m_count] = fd;
+
+            // Position of counter value in group read
+            m_index[m_count++] = i;
+        }
+
+        ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+
+    /**
+     * @brief Destructor.
+     */
+    ~CounterGroup()
+    {
+        for (std::size_t i = 1; i < m_count; ++i)
+            close(m_fds[i]);
+
+        if (m_leader != -1)
+            close(m_leader);
+    }
+
+
+    CounterGroup(const CounterGroup&) = delete;
+    CounterGroup& operator=(const CounterGroup&) = delete;
+
+
+    /**
+     * @brief Returns if counters are available.
+     *
+     * @return
+     */
+    bool isAvailable() const noexcept
+    {
+        return m_leader != -1;
+    }
+
+
+    /**
+     * @brief Returns if counter is opened.
+     *
+     * @param counter
+     *
+     * @return
+     */
+    bool isOpened(std::size_t counter) const noexcept
+    {
+        for (std::size_t i = 0; i < m_count; ++i)
+        {
+            if (m_index[i] == counter)
+                return true;
+        }
+
+        return false;
+    }
+
+
+    /**
+     * @brief Read counter values.
+     *
+     * @param values
+     *
+     * @return
+     */
+    bool read(PerfCounterValues& values) const noexcept
+    {
+        values.fill(0);
+
+        if (m_leader == -1)
+            return false;
+
+        // nr, time enabled, time running, values
+        std::uint64_t data[3 + PERF_COUNTER_COUNT];
+        const auto size = static_cast<ssize_t>((3 + m_count) * sizeof(std::uint64_t));
+
+        if (::read(m_leader, data, sizeof(data)) != size)
+            return false;
+
+        const auto enabled = data[1];
+        const auto running = data[2];
+
+        for (std::size_t i = 0; i < m_count; ++i)
+        {
+            auto value = data[3 + i];
+
+            // Counters were multiplexed, estimate
+            if (running && running < enabled)
+                value = static_cast<std::uint64_t>(static_cast<double>(value) * enabled / running);
+
+            values[m_index[i]] = value;
+        }
+
+        return true;
+    }
+
+
+private:
+
+    /// Group leader.
+    int m_leader = -1;
+
+    /// Group members, the first one is unused (leader).
+    int m_fds[PERF_COUNTER_COUNT] = {};
+
+    /// Counter of each opened event.
+    std::size_t m_index[PERF_COUNTER_COUNT] = {};
+
+    /// Number of opened events.
+    std::size_t m_count = 0;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns current thread counter group.
+ *
+ * @return
+ */
+const CounterGroup& getGroup() noexcept
+{
+    static thread_local CounterGroup group;
+    return group;
+}
+
+#endif
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+const char* getPerfCounterName(PerfCounter counter) noexcept
+{
+    switch (counter)
+    {
+    case PerfCounter::Cycles:       return "cycles";
+    case PerfCounter::Instructions: return "instructions";
+    case PerfCounter::L1Misses:     return "L1 misses";
+    case PerfCounter::LlcMisses:    return "LLC misses";
+    case PerfCounter::BranchMisses: return "branch misses";
+    }
+
+    return "";
+}
+
+/* ************************************************************************ */
+
+bool isPerfCountersAvailable() noexcept
+{
+#if __linux__
+    return getGroup().isAvailable();
+#else
+    return false;
+#endif
+}
+
+/* ************************************************************************ */
+
+bool isPerfCounterSupported(PerfCounter counter) noexcept
+{
+#if __linux__
+    return getGroup().isOpened(static_cast<std::size_t>(counter));
+#else
+    return false;
+#endif
+}
+
+/* ************************************************************************ */
+
+bool readPerfCounters(PerfCounterValues& values) noexcept
+{
+#if __linux__
+    return getGroup().read(values);
+#else
+    values.fill(0);
+    return false;
+#endif
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
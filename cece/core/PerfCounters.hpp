@@ -0,0 +1,125 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstdint>
+#include <cstddef>
+
+// CeCe
+#include "cece/core/StaticArray.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Hardware performance counters.
+ */
+enum class PerfCounter
+{
+    Cycles,
+    Instructions,
+    L1Misses,
+    LlcMisses,
+    BranchMisses
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Number of hardware performance counters.
+ */
+constexpr std::size_t PERF_COUNTER_COUNT = 5;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Values of hardware performance counters indexed by PerfCounter.
+ */
+using PerfCounterValues = StaticArray<std::uint64_t, PERF_COUNTER_COUNT>;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns short counter name.
+ *
+ * @param counter
+ *
+ * @return
+ */
+const char* getPerfCounterName(PerfCounter counter) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns if hardware counters can be read by current thread.
+ *
+ * Counters are opened by Linux perf_event_open on the first call in each
+ * thread. They are unavailable on other platforms and in environments where
+ * perf events are not permitted (containers, perf_event_paranoid).
+ *
+ * @return
+ */
+bool isPerfCountersAvailable() noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns if given counter is supported by hardware.
+ *
+ * @param counter
+ *
+ * @return
+ */
+bool isPerfCounterSupported(PerfCounter counter) noexcept;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Read current thread counters.
+ *
+ * Counters are counted in user space only. When the kernel multiplexes
+ * counters the values are scaled estimates. Values of unsupported counters
+ * are zero.
+ *
+ * @param values Output values.
+ *
+ * @return If counters are available, otherwise values are zeroed.
+ */
+bool readPerfCounters(PerfCounterValues& values) noexcept;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,843 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/Profiler.hpp"
+
+// C++
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+
+// CeCe
+#include "cece/core/Map.hpp"
+#include "cece/core/Mutex.hpp"
+#include "cece/core/SharedPtr.hpp"
+#include "cece/core/NumberFormat.hpp"
+#include "cece/core/AllocationCounter.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Number of zone calls stored in thread buffer, full buffer is collected
+/// by its owner thread.
+constexpr std::size_t BUFFER_CAPACITY = 1u << 14;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Finished zone call.
+ */
+struct Event
+{
+    /// Zone ID.
+    ProfilerZoneId zone;
+
+    /// Nesting depth.
+    unsigned int depth;
+
+    /// Zone start.
+    Clock::time_point start;
+
+    /// Zone duration.
+    Clock::duration duration;
+
+    /// Zone duration without nested zones.
+    Clock::duration self;
+
+    /// Number of allocations.
+    std::uint64_t allocations;
+
+    /// Hardware counters.
+    PerfCounterValues counters;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Recorded zone call for trace export.
+ */
+struct TraceEvent
+{
+    /// Zone ID.
+    ProfilerZoneId zone;
+
+    /// Thread ID.
+    unsigned int thread;
+
+    /// Zone start.
+    Clock::time_point start;
+
+    /// Zone duration.
+    Clock::duration duration;
+
+    /// Iteration number.
+    IterationType iteration;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Single producer (owner thread), single consumer (collector) ring
+ * buffer of zone calls.
+ */
+struct ThreadBuffer
+{
+    /// Thread ID.
+    unsigned int thread;
+
+    /// Stored events.
+    DynamicArray<Event> events = DynamicArray<Event>(BUFFER_CAPACITY);
+
+    /// Write position.
+    Atomic<std::size_t> head{0};
+
+    /// Read position.
+    Atomic<std::size_t> tail{0};
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param id Thread ID.
+     */
+    explicit ThreadBuffer(unsigned int id) noexcept
+        : thread(id)
+    {
+        // Nothing to do
+    }
+
+
+    /**
+     * @brief Store event.
+     *
+     * @param event
+     *
+     * @return If event was stored, false when buffer is full.
+     */
+    bool push(const Event& event) noexcept
+    {
+        const auto h = head.load(std::memory_order_relaxed);
+
+        if (h - tail.load(std::memory_order_acquire) >= BUFFER_CAPACITY)
+            return false;
+
+        events[h % BUFFER_CAPACITY] = event;
+        head.store(h + 1, std::memory_order_release);
+
+        return true;
+    }
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Profiler shared state.
+ */
+struct State
+{
+    /// Guards everything below.
+    Mutex mutex;
+
+    /// Registered zone names.
+    Map<String, ProfilerZoneId> names;
+
+    /// Zone statistics.
+    DynamicArray<ProfilerZoneStats> stats;
+
+    /// Zone time in current iteration.
+    DynamicArray<Clock::duration> iterationTime;
+
+    /// If zone was entered in current iteration.
+    DynamicArray<bool> iterationEntered;
+
+    /// Thread buffers.
+    DynamicArray<SharedPtr<ThreadBuffer>> buffers;
+
+    /// Next thread ID.
+    unsigned int nextThread = 0;
+
+    /// Number of finished iterations.
+    IterationType iterations = 0;
+
+    /// Current iteration number.
+    IterationType iteration = 0;
+
+    /// Number of dropped events.
+    std::uint64_t dropped = 0;
+
+    /// If trace is recorded.
+    bool traceEnabled = false;
+
+    /// Maximum number of trace events.
+    std::size_t traceCapacity = 0;
+
+    /// Trace events.
+    DynamicArray<TraceEvent> trace;
+
+    /// Trace time origin.
+    Clock::time_point epoch = Clock::now();
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns profiler state.
+ *
+ * @return
+ */
+State& getState()
+{
+    static State state;
+    return state;
+}
+
+/* ************************************************************************ */
+
+/// Current thread buffer.
+thread_local SharedPtr<ThreadBuffer> t_buffer;
+
+/// Current thread innermost active scope.
+thread_local ProfilerScope* t_current = nullptr;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Cached zone with composed name.
+ */
+struct CachedZone
+{
+    /// Zone name prefix.
+    String prefix;
+
+    /// Zone name.
+    String name;
+
+    /// Zone ID.
+    ProfilerZoneId zone;
+};
+
+/// Current thread cache of zones with composed names.
+thread_local DynamicArray<CachedZone> t_zones;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns current thread buffer.
+ *
+ * @return
+ */
+ThreadBuffer& getThreadBuffer()
+{
+    if (!t_buffer)
+    {
+        auto& state = getState();
+        MutexGuard _(state.mutex);
+
+        t_buffer = makeShared<ThreadBuffer>(state.nextThread++);
+        state.buffers.push_back(t_buffer);
+    }
+
+    return *t_buffer;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Initialize zone statistics.
+ *
+ * @param stats
+ */
+void clearStats(ProfilerZoneStats& stats) noexcept
+{
+    stats.depth = std::numeric_limits<unsigned int>::max();
+    stats.calls = 0;
+    stats.total = Clock::duration::zero();
+    stats.self = Clock::duration::zero();
+    stats.min = Clock::duration::max();
+    stats.max = Clock::duration::zero();
+    stats.allocations = 0;
+    stats.counters.fill(0);
+    stats.iterations = 0;
+    stats.lastIteration = Clock::duration::zero();
+    stats.maxIteration = Clock::duration::zero();
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Move events from thread buffer into statistics.
+ *
+ * @param state  Locked state.
+ * @param buffer Thread buffer.
+ * @param record If events should be accumulated, otherwise discarded.
+ */
+void drainBuffer(State& state, ThreadBuffer& buffer, bool record)
+{
+    const auto tail = buffer.tail.load(std::memory_order_relaxed);
+    const auto head = buffer.head.load(std::memory_order_acquire);
+
+    for (auto i = tail; record && i != head; ++i)
+    {
+        const Event& event = buffer.events[i % BUFFER_CAPACITY];
+        auto& stats = state.stats[event.zone];
+
+        stats.depth = std::min(stats.depth, event.depth);
+        stats.calls++;
+        stats.total += event.duration;
+        stats.self += event.self;
+        stats.min = std::min(stats.min, event.duration);
+        stats.max = std::max(stats.max, event.duration);
+        stats.allocations += event.allocations;
+
+        for (std::size_t c = 0; c < PERF_COUNTER_COUNT; ++c)
+            stats.counters[c] += event.counters[c];
+
+        state.iterationTime[event.zone] += event.duration;
+        state.iterationEntered[event.zone] = true;
+
+        if (!state.traceEnabled)
+            continue;
+
+        if (state.trace.size() < state.traceCapacity)
+        {
+            state.trace.push_back(TraceEvent{
+                event.zone, buffer.thread, event.start, event.duration, state.iteration
+            });
+        }
+        else
+        {
+            state.dropped++;
+        }
+    }
+
+    buffer.tail.store(head, std::memory_order_release);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Move events from all thread buffers into statistics.
+ *
+ * @param state  Locked state.
+ * @param record If events should be accumulated, otherwise discarded.
+ */
+void drainBuffers(State& state, bool record)
+{
+    for (auto& buffer : state.buffers)
+        drainBuffer(state, *buffer, record);
+
+    // Remove buffers of finished threads
+    state.buffers.erase(std::remove_if(state.buffers.begin(), state.buffers.end(),
+        [](const SharedPtr<ThreadBuffer>& buffer) { return buffer.use_count() == 1; }
+    ), state.buffers.end());
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Write duration in microseconds with nanosecond precision.
+ *
+ * @param os
+ * @param duration
+ */
+void writeMicroseconds(OutStream& os, Clock::duration duration)
+{
+    const auto ns = static_cast<unsigned long long>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()
+    );
+
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE + 4];
+    char* ptr = formatUnsigned(buffer, ns / 1000);
+    *ptr++ = '.';
+    *ptr++ = static_cast<char>('0' + ns / 100 % 10);
+    *ptr++ = static_cast<char>('0' + ns / 10 % 10);
+    *ptr++ = static_cast<char>('0' + ns % 10);
+
+    os.write(buffer, ptr - buffer);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Write JSON string.
+ *
+ * @param os
+ * @param value
+ */
+void writeJsonString(OutStream& os, const String& value)
+{
+    os << '"';
+
+    for (char c : value)
+    {
+        if (c == '"' || c == '\\')
+            os << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20)
+            os << ' ';
+        else
+            os << c;
+    }
+
+    os << '"';
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert duration to milliseconds.
+ *
+ * @param duration
+ *
+ * @return
+ */
+double toMilliseconds(Clock::duration duration) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns if profiling is enabled by CECE_PROFILE environment
+ * variable (any value except empty and `0`).
+ *
+ * @return
+ */
+bool isEnabledByEnvironment() noexcept
+{
+    const char* value = std::getenv("CECE_PROFILE");
+    return value && *value && std::strcmp(value, "0") != 0;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+Atomic<bool> Profiler::s_enabled{isEnabledByEnvironment()};
+
+/* ************************************************************************ */
+
+Atomic<bool> Profiler::s_counters{false};
+
+/* ************************************************************************ */
+
+bool Profiler::setCountersEnabled(bool flag) noexcept
+{
+    flag = flag && isPerfCountersAvailable();
+    s_counters.store(flag, std::memory_order_relaxed);
+
+    return flag;
+}
+
+/* ************************************************************************ */
+
+bool Profiler::isTraceEnabled() noexcept
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    return state.traceEnabled;
+}
+
+/* ************************************************************************ */
+
+void Profiler::setTraceEnabled(bool flag, std::size_t capacity)
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    state.traceEnabled = flag;
+    state.traceCapacity = capacity;
+}
+
+/* ************************************************************************ */
+
+IterationType Profiler::getIterationCount() noexcept
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    return state.iterations;
+}
+
+/* ************************************************************************ */
+
+std::uint64_t Profiler::getDroppedCount() noexcept
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    return state.dropped;
+}
+
+/* ************************************************************************ */
+
+String Profiler::getZoneName(ProfilerZoneId zone)
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    return state.stats.at(zone).name;
+}
+
+/* ************************************************************************ */
+
+DynamicArray<ProfilerZoneStats> Profiler::getStats()
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    auto stats = state.stats;
+
+    for (auto& zone : stats)
+    {
+        if (zone.calls == 0)
+        {
+            zone.depth = 0;
+            zone.min = Clock::duration::zero();
+        }
+    }
+
+    return stats;
+}
+
+/* ************************************************************************ */
+
+DynamicArray<ProfilerZoneStats> Profiler::getStats(StringView prefix)
+{
+    auto stats = getStats();
+
+    stats.erase(std::remove_if(stats.begin(), stats.end(), [&prefix](const ProfilerZoneStats& zone) {
+        return zone.calls == 0 || zone.name.compare(0, prefix.getLength(), prefix.getData(), prefix.getLength()) != 0;
+    }), stats.end());
+
+    return stats;
+}
+
+/* ************************************************************************ */
+
+ProfilerZoneId Profiler::registerZone(StringView name)
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    String key(name.getData(), name.getLength());
+    auto it = state.names.find(key);
+
+    if (it != state.names.end())
+        return it->second;
+
+    const auto id = static_cast<ProfilerZoneId>(state.stats.size());
+
+    ProfilerZoneStats stats;
+    stats.name = key;
+    clearStats(stats);
+
+    state.stats.push_back(std::move(stats));
+    state.iterationTime.push_back(Clock::duration::zero());
+    state.iterationEntered.push_back(false);
+    state.names.emplace(std::move(key), id);
+
+    return id;
+}
+
+/* ************************************************************************ */
+
+ProfilerZoneId Profiler::registerZone(StringView prefix, StringView name)
+{
+    for (const auto& cached : t_zones)
+    {
+        if (StringView(cached.prefix) == prefix && StringView(cached.name) == name)
+            return cached.zone;
+    }
+
+    String prefixStr(prefix.getData(), prefix.getLength());
+    String nameStr(name.getData(), name.getLength());
+    const auto zone = registerZone(prefixStr + nameStr);
+
+    t_zones.push_back(CachedZone{std::move(prefixStr), std::move(nameStr), zone});
+
+    return zone;
+}
+
+/* ************************************************************************ */
+
+void Profiler::collect()
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    drainBuffers(state, true);
+}
+
+/* ************************************************************************ */
+
+void Profiler::endIteration(IterationType iteration)
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    drainBuffers(state, true);
+
+    for (std::size_t i = 0; i < state.stats.size(); ++i)
+    {
+        auto& stats = state.stats[i];
+
+        if (state.iterationEntered[i])
+        {
+            stats.iterations++;
+            stats.lastIteration = state.iterationTime[i];
+            stats.maxIteration = std::max(stats.maxIteration, state.iterationTime[i]);
+        }
+        else
+        {
+            stats.lastIteration = Clock::duration::zero();
+        }
+
+        state.iterationTime[i] = Clock::duration::zero();
+        state.iterationEntered[i] = false;
+    }
+
+    state.iterations++;
+    state.iteration = iteration + 1;
+}
+
+/* ************************************************************************ */
+
+void Profiler::reset()
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    drainBuffers(state, false);
+
+    for (std::size_t i = 0; i < state.stats.size(); ++i)
+    {
+        clearStats(state.stats[i]);
+        state.iterationTime[i] = Clock::duration::zero();
+        state.iterationEntered[i] = false;
+    }
+
+    state.iterations = 0;
+    state.iteration = 0;
+    state.dropped = 0;
+    state.trace.clear();
+    state.epoch = Clock::now();
+}
+
+/* ************************************************************************ */
+
+void Profiler::writeChromeTrace(OutStream& os)
+{
+    auto& state = getState();
+    MutexGuard _(state.mutex);
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+    bool first = true;
+
+    for (const auto& event : state.trace)
+    {
+        if (!first)
+            os << ',';
+
+        first = false;
+
+        os << "\n{\"name\":";
+        writeJsonString(os, state.stats[event.zone].name);
+        os << ",\"cat\":\"cece\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread << ",\"ts\":";
+        writeMicroseconds(os, event.start - state.epoch);
+        os << ",\"dur\":";
+        writeMicroseconds(os, event.duration);
+        os << ",\"args\":{\"iteration\":" << event.iteration << "}}";
+    }
+
+    os << "\n]}\n";
+}
+
+/* ************************************************************************ */
+
+void Profiler::writeSummary(OutStream& os)
+{
+    auto stats = getStats();
+
+    stats.erase(std::remove_if(stats.begin(), stats.end(),
+        [](const ProfilerZoneStats& zone) { return zone.calls == 0; }
+    ), stats.end());
+
+    std::sort(stats.begin(), stats.end(), [](const ProfilerZoneStats& lhs, const ProfilerZoneStats& rhs) {
+        return lhs.total > rhs.total;
+    });
+
+    std::size_t nameWidth = 4;
+    bool counters = false;
+
+    for (const auto& zone : stats)
+    {
+        nameWidth = std::max(nameWidth, zone.name.size());
+        counters = counters || zone.counters[static_cast<std::size_t>(PerfCounter::Cycles)] != 0;
+    }
+
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+
+    os << std::left << std::setw(nameWidth) << "zone" << std::right
+        << std::setw(12) << "calls"
+        << std::setw(14) << "total [ms]"
+        << std::setw(14) << "self [ms]"
+        << std::setw(14) << "mean [ms]"
+        << std::setw(14) << "max [ms]"
+        << std::setw(14) << "iter [ms]"
+        << std::setw(14) << "max iter [ms]"
+        << std::setw(12) << "allocs";
+
+    if (counters)
+    {
+        os
+            << std::setw(16) << "cycles"
+            << std::setw(16) << "instructions"
+            << std::setw(8) << "IPC"
+            << std::setw(14) << "L1 misses"
+            << std::setw(14) << "LLC misses"
+            << std::setw(14) << "br misses";
+    }
+
+    os << "\n";
+
+    os << std::fixed << std::setprecision(3);
+
+    for (const auto& zone : stats)
+    {
+        os << std::left << std::setw(nameWidth) << zone.name << std::right
+            << std::setw(12) << zone.calls
+            << std::setw(14) << toMilliseconds(zone.total)
+            << std::setw(14) << toMilliseconds(zone.self)
+            << std::setw(14) << toMilliseconds(zone.total) / zone.calls
+            << std::setw(14) << toMilliseconds(zone.max)
+            << std::setw(14) << (zone.iterations ? toMilliseconds(zone.total) / zone.iterations : 0.0)
+            << std::setw(14) << toMilliseconds(zone.maxIteration)
+            << std::setw(12) << zone.allocations;
+
+        if (counters)
+        {
+            const auto cycles = zone.counters[static_cast<std::size_t>(PerfCounter::Cycles)];
+            const auto instructions = zone.counters[static_cast<std::size_t>(PerfCounter::Instructions)];
+
+            os
+                << std::setw(16) << cycles
+                << std::setw(16) << instructions
+                << std::setw(8) << std::setprecision(2) << (cycles ? static_cast<double>(instructions) / cycles : 0.0)
+                << std::setprecision(3)
+                << std::setw(14) << zone.counters[static_cast<std::size_t>(PerfCounter::L1Misses)]
+                << std::setw(14) << zone.counters[static_cast<std::size_t>(PerfCounter::LlcMisses)]
+                << std::setw(14) << zone.counters[static_cast<std::size_t>(PerfCounter::BranchMisses)];
+        }
+
+        os << "\n";
+    }
+
+    os.flags(flags);
+    os.precision(precision);
+}
+
+/* ************************************************************************ */
+
+void ProfilerScope::begin(ProfilerZoneId zone) noexcept
+{
+    m_active = true;
+    m_zone = zone;
+    m_parent = t_current;
+    m_depth = m_parent ? m_parent->m_depth + 1 : 0;
+    m_children = Clock::duration::zero();
+    m_allocations = getAllocationCount();
+
+    t_current = this;
+    m_start = Clock::now();
+
+    // Read last to exclude profiler overhead
+    if (Profiler::isCountersEnabled())
+        m_counted = readPerfCounters(m_counters);
+}
+
+/* ************************************************************************ */
+
+void ProfilerScope::end()
+{
+    PerfCounterValues counters;
+
+    // Read first to exclude profiler overhead
+    if (m_counted && readPerfCounters(counters))
+    {
+        for (std::size_t i = 0; i < PERF_COUNTER_COUNT; ++i)
+            counters[i] -= m_counters[i];
+    }
+    else
+    {
+        counters.fill(0);
+    }
+
+    const auto duration = Clock::now() - m_start;
+    const auto allocations = getAllocationCount() - m_allocations;
+
+    t_current = m_parent;
+
+    if (m_parent)
+        m_parent->m_children += duration;
+
+    const Event event{m_zone, m_depth, m_start, duration, duration - m_children, allocations, counters};
+    auto& buffer = getThreadBuffer();
+
+    if (buffer.push(event))
+        return;
+
+    // Buffer is full before the end of iteration, collect it now
+    {
+        auto& state = getState();
+        MutexGuard _(state.mutex);
+        drainBuffer(state, buffer, true);
+    }
+
+    buffer.push(event);
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
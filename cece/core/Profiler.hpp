@@ -0,0 +1,444 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstdint>
+
+// CeCe
+#include "cece/export.hpp"
+#include "cece/core/Macro.hpp"
+#include "cece/core/Atomic.hpp"
+#include "cece/core/String.hpp"
+#include "cece/core/StringView.hpp"
+#include "cece/core/OutStream.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/IterationType.hpp"
+#include "cece/core/PerfCounters.hpp"
+#include "cece/core/TimeMeasurement.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Profiler zone identifier.
+ */
+using ProfilerZoneId = unsigned int;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Accumulated statistics of single profiler zone.
+ */
+struct ProfilerZoneStats
+{
+    /// Zone name.
+    String name;
+
+    /// The lowest nesting depth the zone was entered at.
+    unsigned int depth;
+
+    /// Number of zone calls.
+    std::uint64_t calls;
+
+    /// Total time spent in zone.
+    Clock::duration total;
+
+    /// Time spent in zone excluding nested zones.
+    Clock::duration self;
+
+    /// The shortest call.
+    Clock::duration min;
+
+    /// The longest call.
+    Clock::duration max;
+
+    /// Number of memory allocations made in zone (see AllocationCounter.hpp).
+    std::uint64_t allocations;
+
+    /// Hardware counters summed over measured zone calls (see
+    /// Profiler::setCountersEnabled).
+    PerfCounterValues counters;
+
+    /// Number of iterations the zone was entered in.
+    IterationType iterations;
+
+    /// Time spent in zone during the last finished iteration.
+    Clock::duration lastIteration;
+
+    /// The longest time spent in zone during single iteration.
+    Clock::duration maxIteration;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Hierarchical profiler.
+ *
+ * Measured zones are identified by names interned into zone IDs once per
+ * call site (see CECE_PROFILE_ZONE). Finished zone calls are stored into
+ * thread-local ring buffers which are collected and aggregated at the end
+ * of each simulation iteration or by the owner thread when its buffer
+ * becomes full. Profiling is switched at runtime and when
+ * disabled the zone costs a single relaxed atomic load. It's enabled at
+ * startup when CECE_PROFILE environment variable is set (to anything except
+ * `0`) and by `profile` simulation parameter.
+ */
+class Profiler
+{
+
+// Public Accessors & Mutators
+public:
+
+
+    /**
+     * @brief Returns if profiling is enabled.
+     *
+     * @return
+     */
+    static bool isEnabled() noexcept
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+
+    /**
+     * @brief Enable or disable profiling.
+     *
+     * @param flag
+     */
+    static void setEnabled(bool flag) noexcept
+    {
+        s_enabled.store(flag, std::memory_order_relaxed);
+    }
+
+
+    /**
+     * @brief Returns if hardware performance counters are sampled.
+     *
+     * @return
+     */
+    static bool isCountersEnabled() noexcept
+    {
+        return s_counters.load(std::memory_order_relaxed);
+    }
+
+
+    /**
+     * @brief Enable or disable sampling of hardware performance counters
+     * at zone boundaries.
+     *
+     * Sampling costs a system call per zone boundary so it should be used for
+     * coarse zones (simulation phases) rather than per-object zones.
+     *
+     * @param flag
+     *
+     * @return If counters are sampled, false when counters are not available
+     * (see isPerfCountersAvailable).
+     */
+    static bool setCountersEnabled(bool flag) noexcept;
+
+
+    /**
+     * @brief Returns if zone calls are recorded for trace export.
+     *
+     * @return
+     */
+    static bool isTraceEnabled() noexcept;
+
+
+    /**
+     * @brief Enable or disable recording of zone calls for trace export.
+     *
+     * @param flag
+     * @param capacity Maximum number of recorded zone calls.
+     */
+    static void setTraceEnabled(bool flag, std::size_t capacity = 1024 * 1024);
+
+
+    /**
+     * @brief Returns number of finished iterations.
+     *
+     * @return
+     */
+    static IterationType getIterationCount() noexcept;
+
+
+    /**
+     * @brief Returns number of zone calls that were not recorded in trace
+     * because of its capacity.
+     *
+     * @return
+     */
+    static std::uint64_t getDroppedCount() noexcept;
+
+
+    /**
+     * @brief Returns zone name.
+     *
+     * @param zone Zone ID.
+     *
+     * @return
+     */
+    static String getZoneName(ProfilerZoneId zone);
+
+
+    /**
+     * @brief Returns accumulated zone statistics.
+     *
+     * @return Statistics indexed by zone ID.
+     */
+    static DynamicArray<ProfilerZoneStats> getStats();
+
+
+    /**
+     * @brief Returns accumulated statistics of entered zones with given name
+     * prefix, e.g. "module:".
+     *
+     * @param prefix Zone name prefix.
+     *
+     * @return
+     */
+    static DynamicArray<ProfilerZoneStats> getStats(StringView prefix);
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Register zone name.
+     *
+     * @param name Zone name.
+     *
+     * @return Zone ID. Same name always returns same ID.
+     */
+    static ProfilerZoneId registerZone(StringView name);
+
+
+    /**
+     * @brief Register zone with name composed from prefix and name.
+     *
+     * Registered zones are cached per thread so it's cheap to call it
+     * repeatedly for names known only at runtime (module names, object
+     * types).
+     *
+     * @param prefix Zone name prefix.
+     * @param name   Zone name.
+     *
+     * @return Zone ID.
+     */
+    static ProfilerZoneId registerZone(StringView prefix, StringView name);
+
+
+    /**
+     * @brief Collect finished zone calls from all threads.
+     */
+    static void collect();
+
+
+    /**
+     * @brief Collect zone calls and finish iteration statistics.
+     *
+     * @param iteration Finished iteration number.
+     */
+    static void endIteration(IterationType iteration);
+
+
+    /**
+     * @brief Clear all collected data. Registered zones are kept.
+     */
+    static void reset();
+
+
+    /**
+     * @brief Write recorded zone calls in Chrome trace event format
+     * (chrome://tracing, Perfetto).
+     *
+     * @param os Output stream.
+     */
+    static void writeChromeTrace(OutStream& os);
+
+
+    /**
+     * @brief Write table of zone statistics.
+     *
+     * @param os Output stream.
+     */
+    static void writeSummary(OutStream& os);
+
+
+// Private Data Members
+private:
+
+    /// If profiling is enabled.
+    static CECE_EXPORT Atomic<bool> s_enabled;
+
+    /// If hardware counters are sampled.
+    static CECE_EXPORT Atomic<bool> s_counters;
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Measures profiler zone for current statement block.
+ */
+class ProfilerScope
+{
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param zone Zone ID.
+     */
+    explicit ProfilerScope(ProfilerZoneId zone) noexcept
+    {
+        if (Profiler::isEnabled())
+            begin(zone);
+    }
+
+
+    /**
+     * @brief Constructor.
+     *
+     * Zone is registered only when profiling is enabled.
+     *
+     * @param prefix Zone name prefix.
+     * @param name   Zone name.
+     */
+    ProfilerScope(StringView prefix, StringView name)
+    {
+        if (Profiler::isEnabled())
+            begin(Profiler::registerZone(prefix, name));
+    }
+
+
+    /**
+     * @brief Destructor.
+     */
+    ~ProfilerScope()
+    {
+        if (!m_active)
+            return;
+
+        try
+        {
+            end();
+        }
+        catch (...)
+        {
+            // Zone measurement is lost
+        }
+    }
+
+
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Begin zone.
+     *
+     * @param zone Zone ID.
+     */
+    void begin(ProfilerZoneId zone) noexcept;
+
+
+    /**
+     * @brief End zone.
+     *
+     * Thread buffer is allocated on first use.
+     */
+    void end();
+
+
+// Private Data Members
+private:
+
+    /// If zone is measured.
+    bool m_active = false;
+
+    /// Zone ID.
+    ProfilerZoneId m_zone;
+
+    /// Nesting depth.
+    unsigned int m_depth;
+
+    /// Enclosing scope.
+    ProfilerScope* m_parent;
+
+    /// Zone start.
+    Clock::time_point m_start;
+
+    /// Time spent in nested zones.
+    Clock::duration m_children;
+
+    /// Allocation count at zone start.
+    std::uint64_t m_allocations;
+
+    /// If hardware counters were read at zone start.
+    bool m_counted = false;
+
+    /// Hardware counters at zone start.
+    PerfCounterValues m_counters;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Measure profiler zone for current statement block.
+ *
+ * Zone name is registered only once per call site.
+ *
+ * @param name Zone name.
+ */
+#define CECE_PROFILE_ZONE(name) \
+    static const ::cece::ProfilerZoneId XCONCAT(cece_profiler_zone_, __LINE__) = \
+        ::cece::Profiler::registerZone(name); \
+    ::cece::ProfilerScope XCONCAT(cece_profiler_scope_, __LINE__)(XCONCAT(cece_profiler_zone_, __LINE__))
+
+/* ************************************************************************ */
@@ -27,6 +27,9 @@
 
 /* ************************************************************************ */
 
+// C++
+#include <type_traits>
+
 // CeCe
 #include "cece/config.hpp"
 
@@ -46,6 +49,61 @@ using RealType = cece::config::RealType;
 
 /* ************************************************************************ */
 
+/**
+ * @brief Real type used for computation, units and physics conversions.
+ */
+using ComputeRealType = cece::config::RealType;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Real type used for stored values.
+ *
+ * Bandwidth-bound data like grid cells can be stored with lower precision
+ * than computation type. Values are loaded into ComputeRealType.
+ */
+using StorageRealType = cece::config::StorageRealType;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Real type used for sums and reductions.
+ */
+using AccumulatorRealType = cece::config::AccumulatorRealType;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Type used to accumulate values of given type.
+ *
+ * Floating point values are accumulated in AccumulatorRealType unless
+ * the value type is wider. Other types are accumulated in itself.
+ *
+ * @tparam T Value type.
+ */
+template<typename T, typename = void>
+struct AccumulatorType
+{
+    /// Accumulator type.
+    using type = T;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Type used to accumulate floating point values.
+ *
+ * @tparam T Value type.
+ */
+template<typename T>
+struct AccumulatorType<T, typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    /// Accumulator type.
+    using type = typename std::common_type<T, AccumulatorRealType>::type;
+};
+
+/* ************************************************************************ */
+
 }
 }
 
@@ -101,6 +101,37 @@ struct ShapeEdges
 
 /* ************************************************************************ */
 
+/**
+ * @brief Structure for sphere shape.
+ *
+ * 3D shapes are not stored in Shape, they're used for rasterization into
+ * 3D grids.
+ */
+struct ShapeSphere
+{
+    /// Shape center.
+    BasicVector<units::Length, 3> center;
+
+    /// Sphere radius.
+    units::Length radius;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Structure for axis-aligned box shape.
+ */
+struct ShapeBox
+{
+    /// Shape center.
+    BasicVector<units::Length, 3> center;
+
+    /// Box size.
+    BasicVector<units::Length, 3> size;
+};
+
+/* ************************************************************************ */
+
 /**
  * @brief Structure for storing shape.
  */
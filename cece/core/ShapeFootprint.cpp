@@ -0,0 +1,221 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/ShapeFootprint.hpp"
+
+// C++
+#include <algorithm>
+
+// CeCe
+#include "cece/core/ShapeToGrid.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+void ShapeFootprint::update(const DynamicArray<Shape>& shapes, unsigned long revision,
+    const units::SizeVector& steps, const CoordinateType& center,
+    units::Angle rotation, const CoordinateType& size)
+{
+    using std::swap;
+    swap(m_previous, m_spans);
+
+    const bool reuse =
+        m_valid &&
+        !m_clipped &&
+        revision == m_revision &&
+        steps == m_steps &&
+        size == m_size &&
+        units::abs(rotation - m_rotation) <= m_rotationTolerance
+    ;
+
+    m_rasterized = false;
+
+    if (reuse && center == m_center)
+    {
+        // Sub-cell movement
+        swap(m_previous, m_spans);
+        m_entered.clear();
+        m_left.clear();
+        return;
+    }
+
+    bool translated = false;
+
+    if (reuse)
+    {
+        const auto dx = static_cast<long long>(center.getX()) - m_center.getX();
+        const auto dy = static_cast<long long>(center.getY()) - m_center.getY();
+
+        // Translated footprint must not touch grid border
+        const bool inside =
+            m_min.getX() + dx > 0 &&
+            m_min.getY() + dy > 0 &&
+            m_max.getX() + dx < size.getWidth() &&
+            m_max.getY() + dy < size.getHeight()
+        ;
+
+        if (inside)
+        {
+            m_spans.clear();
+            m_spans.reserve(m_previous.size());
+
+            for (const auto& span : m_previous)
+            {
+                m_spans.push_back(GridSpan{
+                    static_cast<unsigned int>(span.y + dy),
+                    static_cast<unsigned int>(span.begin + dx),
+                    static_cast<unsigned int>(span.end + dx)
+                });
+            }
+
+            m_min = CoordinateType(m_min.getX() + dx, m_min.getY() + dy);
+            m_max = CoordinateType(m_max.getX() + dx, m_max.getY() + dy);
+            m_center = center;
+            translated = true;
+        }
+    }
+
+    if (!translated)
+    {
+        rasterize(shapes, steps, center, rotation, size);
+        m_rotation = rotation;
+    }
+
+    m_valid = true;
+    m_revision = revision;
+    m_steps = steps;
+    m_size = size;
+
+    subtractSpans(m_spans, m_previous, m_entered);
+    subtractSpans(m_previous, m_spans, m_left);
+}
+
+/* ************************************************************************ */
+
+void ShapeFootprint::clear() noexcept
+{
+    m_valid = false;
+    m_rasterized = false;
+    m_spans.clear();
+    m_previous.clear();
+    m_entered.clear();
+    m_left.clear();
+}
+
+/* ************************************************************************ */
+
+void ShapeFootprint::rasterize(const DynamicArray<Shape>& shapes, const units::SizeVector& steps,
+    const CoordinateType& center, units::Angle rotation, const CoordinateType& size)
+{
+    m_rasterized = true;
+    m_center = center;
+    m_spans.clear();
+
+    for (const auto& shape : shapes)
+    {
+        mapShapeSpansToGrid([this] (unsigned int y, unsigned int begin, unsigned int end) {
+            m_spans.push_back(GridSpan{y, begin, end});
+        }, shape, steps, center, rotation, size);
+    }
+
+    // Sort and merge overlapping spans of different shapes
+    std::sort(m_spans.begin(), m_spans.end(), [] (const GridSpan& lhs, const GridSpan& rhs) {
+        return lhs.y < rhs.y || (lhs.y == rhs.y && lhs.begin < rhs.begin);
+    });
+
+    std::size_t count = 0;
+
+    for (std::size_t i = 0; i < m_spans.size(); ++i)
+    {
+        if (count > 0 && m_spans[count - 1].y == m_spans[i].y && m_spans[i].begin <= m_spans[count - 1].end)
+            m_spans[count - 1].end = std::max(m_spans[count - 1].end, m_spans[i].end);
+        else
+            m_spans[count++] = m_spans[i];
+    }
+
+    m_spans.resize(count);
+
+    // Bounding box, touching the border means the footprint may be clipped
+    m_min = size;
+    m_max = Zero;
+
+    for (const auto& span : m_spans)
+    {
+        m_min = CoordinateType(std::min(m_min.getX(), span.begin), std::min(m_min.getY(), span.y));
+        m_max = CoordinateType(std::max(m_max.getX(), span.end), std::max(m_max.getY(), span.y + 1));
+    }
+
+    m_clipped =
+        m_spans.empty() ||
+        m_min.getX() == 0 ||
+        m_min.getY() == 0 ||
+        m_max.getX() >= size.getWidth() ||
+        m_max.getY() >= size.getHeight()
+    ;
+}
+
+/* ************************************************************************ */
+
+void subtractSpans(const DynamicArray<GridSpan>& lhs, const DynamicArray<GridSpan>& rhs,
+    DynamicArray<GridSpan>& result)
+{
+    result.clear();
+    std::size_t first = 0;
+
+    for (const auto& span : lhs)
+    {
+        // Skip spans before the current one
+        while (first < rhs.size() && (rhs[first].y < span.y ||
+            (rhs[first].y == span.y && rhs[first].end <= span.begin)))
+        {
+            ++first;
+        }
+
+        auto begin = span.begin;
+
+        for (auto i = first; i < rhs.size() && rhs[i].y == span.y && rhs[i].begin < span.end; ++i)
+        {
+            if (rhs[i].begin > begin)
+                result.push_back(GridSpan{span.y, begin, rhs[i].begin});
+
+            begin = std::max(begin, rhs[i].end);
+        }
+
+        if (begin < span.end)
+            result.push_back(GridSpan{span.y, begin, span.end});
+    }
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,302 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstdint>
+
+// CeCe
+#include "cece/core/Units.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Shape.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Horizontal run of grid cells [begin, end) in row y.
+ */
+struct GridSpan
+{
+    /// Row.
+    unsigned int y;
+
+    /// First column.
+    unsigned int begin;
+
+    /// End column (exclusive).
+    unsigned int end;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compare spans.
+ *
+ * @param lhs
+ * @param rhs
+ *
+ * @return
+ */
+inline bool operator==(const GridSpan& lhs, const GridSpan& rhs) noexcept
+{
+    return lhs.y == rhs.y && lhs.begin == rhs.begin && lhs.end == rhs.end;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compare spans.
+ *
+ * @param lhs
+ * @param rhs
+ *
+ * @return
+ */
+inline bool operator!=(const GridSpan& lhs, const GridSpan& rhs) noexcept
+{
+    return !operator==(lhs, rhs);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Grid cells covered by a set of shapes, updated incrementally.
+ *
+ * Footprint remembers rasterized spans with the transform they were created
+ * for. Shapes are rasterized again only when the shapes revision or the
+ * rotation changes, or when the previous footprint was clipped by the grid.
+ * Otherwise the stored spans are translated by the change of center, which
+ * for sub-cell movement means no work at all.
+ *
+ * After each update the cells which entered and left the footprint are
+ * available as spans, so consumers can update only the difference.
+ */
+class ShapeFootprint
+{
+
+// Public Types
+public:
+
+
+    /// Grid coordinates type.
+    using CoordinateType = Vector<unsigned int>;
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns current spans sorted by row and column.
+     *
+     * @return
+     */
+    const DynamicArray<GridSpan>& getSpans() const noexcept
+    {
+        return m_spans;
+    }
+
+
+    /**
+     * @brief Returns spans of cells which entered the footprint by last update.
+     *
+     * @return
+     */
+    const DynamicArray<GridSpan>& getEntered() const noexcept
+    {
+        return m_entered;
+    }
+
+
+    /**
+     * @brief Returns spans of cells which left the footprint by last update.
+     *
+     * @return
+     */
+    const DynamicArray<GridSpan>& getLeft() const noexcept
+    {
+        return m_left;
+    }
+
+
+    /**
+     * @brief Returns if last update rasterized shapes.
+     *
+     * @return
+     */
+    bool isRasterized() const noexcept
+    {
+        return m_rasterized;
+    }
+
+
+    /**
+     * @brief Returns maximum rotation change which doesn't require
+     * rasterization.
+     *
+     * @return
+     */
+    units::Angle getRotationTolerance() const noexcept
+    {
+        return m_rotationTolerance;
+    }
+
+
+// Public Mutators
+public:
+
+
+    /**
+     * @brief Set maximum rotation change which doesn't require rasterization.
+     *
+     * @param tolerance
+     */
+    void setRotationTolerance(units::Angle tolerance) noexcept
+    {
+        m_rotationTolerance = tolerance;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Update footprint.
+     *
+     * @param shapes   Shapes.
+     * @param revision Shapes revision, change forces rasterization.
+     * @param steps    Grid cell size.
+     * @param center   Shapes center in grid coordinates.
+     * @param rotation Shapes rotation.
+     * @param size     Grid size.
+     */
+    void update(const DynamicArray<Shape>& shapes, unsigned long revision,
+        const units::SizeVector& steps, const CoordinateType& center,
+        units::Angle rotation, const CoordinateType& size);
+
+
+    /**
+     * @brief Invalidate footprint, next update rasterizes shapes.
+     */
+    void invalidate() noexcept
+    {
+        m_valid = false;
+    }
+
+
+    /**
+     * @brief Clear footprint.
+     */
+    void clear() noexcept;
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Rasterize shapes into m_spans.
+     */
+    void rasterize(const DynamicArray<Shape>& shapes, const units::SizeVector& steps,
+        const CoordinateType& center, units::Angle rotation, const CoordinateType& size);
+
+
+// Private Data Members
+private:
+
+    /// If footprint is valid.
+    bool m_valid = false;
+
+    /// If last update rasterized shapes.
+    bool m_rasterized = false;
+
+    /// If spans are clipped by the grid.
+    bool m_clipped = false;
+
+    /// Shapes revision.
+    unsigned long m_revision = 0;
+
+    /// Grid cell size.
+    units::SizeVector m_steps = Zero;
+
+    /// Center.
+    CoordinateType m_center = Zero;
+
+    /// Rotation.
+    units::Angle m_rotation = Zero;
+
+    /// Grid size.
+    CoordinateType m_size = Zero;
+
+    /// Maximum rotation change which doesn't require rasterization.
+    units::Angle m_rotationTolerance = Zero;
+
+    /// Bounding box of spans.
+    CoordinateType m_min = Zero;
+    CoordinateType m_max = Zero;
+
+    /// Current spans.
+    DynamicArray<GridSpan> m_spans;
+
+    /// Previous spans.
+    DynamicArray<GridSpan> m_previous;
+
+    /// Entered spans.
+    DynamicArray<GridSpan> m_entered;
+
+    /// Left spans.
+    DynamicArray<GridSpan> m_left;
+
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Subtract cells of one sorted span list from another.
+ *
+ * @param lhs    Spans sorted by row and column, non-overlapping.
+ * @param rhs    Spans sorted by row and column, non-overlapping.
+ * @param result Spans covering cells of lhs which are not in rhs.
+ */
+void subtractSpans(const DynamicArray<GridSpan>& lhs, const DynamicArray<GridSpan>& rhs,
+    DynamicArray<GridSpan>& result);
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
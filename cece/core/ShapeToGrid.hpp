@@ -28,6 +28,7 @@
 /* ************************************************************************ */
 
 // C++
+#include <cmath>
 #include <type_traits>
 #include <algorithm>
 
@@ -216,6 +217,24 @@ void mapShapeToGrid(FnIn fnIn, FnOut fnOut, const ShapeRectangle& shape, const V
     const Vector<T>& center, units::Angle rotation, const Vector<T>& max,
     const Vector<T>& min = {})
 {
+    // Rotated rectangle is rasterized as polygon
+    if (rotation != Zero)
+    {
+        const auto half = shape.size / 2.f;
+
+        ShapeEdges edges;
+        edges.center = shape.center;
+        edges.edges = {
+            shape.center + units::PositionVector{-half.getWidth(), -half.getHeight()},
+            shape.center + units::PositionVector{ half.getWidth(), -half.getHeight()},
+            shape.center + units::PositionVector{ half.getWidth(),  half.getHeight()},
+            shape.center + units::PositionVector{-half.getWidth(),  half.getHeight()}
+        };
+
+        mapShapeToGrid(fnIn, fnOut, edges, steps, center, rotation, max, min);
+        return;
+    }
+
     // Get signed type
     using Ts = typename std::make_signed<T>::type;
 
@@ -244,6 +263,118 @@ void mapShapeToGrid(FnIn fnIn, FnOut fnOut, const ShapeRectangle& shape, const V
 
 /* ************************************************************************ */
 
+/**
+ * @brief Scan polygon rows.
+ *
+ * Only rows of polygon bounding box inside of [min, max) are visited. Edge
+ * table sorted by the first crossed row is scanned with list of active
+ * edges, so the cost is given by the polygon size and not by grid height.
+ *
+ * @tparam Fn Function called with row and sorted edge crossings.
+ * @tparam Ts Signed coordinate value type.
+ *
+ * @param fn       Row callback.
+ * @param vertices Polygon vertices in grid coordinates.
+ * @param max      Maximum coordinates.
+ * @param min      Minimum coordinates.
+ *
+ * @link http://alienryderflex.com/polygon_fill/
+ */
+template<typename Fn, typename Ts>
+void scanPolygonRows(Fn fn, const DynamicArray<Vector<RealType>>& vertices,
+    const Vector<Ts>& max, const Vector<Ts>& min)
+{
+    // Polygon edge
+    struct Edge
+    {
+        /// First row crossed by the edge.
+        Ts first;
+
+        /// Last row crossed by the edge.
+        Ts last;
+
+        /// Edge vertices.
+        Vector<RealType> v1;
+        Vector<RealType> v2;
+    };
+
+    // Edge table sorted by first row, horizontal edges are skipped
+    DynamicArray<Edge> table;
+    table.reserve(vertices.size());
+
+    auto j = vertices.size() - 1;
+    for (std::size_t i = 0u; i < vertices.size(); ++i)
+    {
+        const auto yiI = static_cast<Ts>(vertices[i].getY());
+        const auto yjI = static_cast<Ts>(vertices[j].getY());
+
+        // Edge crosses rows in range (min, max]
+        if (yiI != yjI)
+            table.push_back(Edge{std::min(yiI, yjI) + 1, std::max(yiI, yjI), vertices[i], vertices[j]});
+
+        j = i;
+    }
+
+    if (table.empty())
+        return;
+
+    std::sort(table.begin(), table.end(), [] (const Edge& lhs, const Edge& rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    Ts last = table.front().last;
+
+    for (const auto& edge : table)
+        last = std::max(last, edge.last);
+
+    // Rows of polygon bounding box inside the grid
+    const Ts yBegin = std::max(table.front().first, min.getY());
+    const Ts yEnd = std::min<Ts>(last + 1, max.getY());
+
+    DynamicArray<const Edge*> active;
+    active.reserve(table.size());
+
+    DynamicArray<Ts> nodes;
+    nodes.reserve(table.size());
+
+    auto next = table.begin();
+
+    for (Ts y = yBegin; y < yEnd; ++y)
+    {
+        // Update active edge table
+        for (; next != table.end() && next->first <= y; ++next)
+            active.push_back(&*next);
+
+        active.erase(std::remove_if(active.begin(), active.end(), [y] (const Edge* edge) {
+            return edge->last < y;
+        }), active.end());
+
+        // Build a list of nodes
+        nodes.clear();
+
+        for (const auto edge : active)
+        {
+            const auto yi = edge->v1.getY();
+            const auto yj = edge->v2.getY();
+
+            nodes.push_back(static_cast<Ts>(
+                edge->v1.getX() + (y - yi)
+                / (yj - yi)
+                * (edge->v2.getX() - edge->v1.getX())
+            ));
+        }
+
+        CECE_ASSERT(nodes.size() % 2 == 0);
+
+        // Sort the nodes
+        std::sort(nodes.begin(), nodes.end());
+
+        fn(y, nodes);
+    }
+}
+
+/* ************************************************************************ */
+
 /**
  * @brief Map edges shape to grid.
  *
@@ -290,7 +421,7 @@ OutIt mapShapeToGrid(OutIt out, const ShapeEdges& shape, const Vector<StepT>& st
  * @param max    Maximum coordinates.
  * @param mim    Minimum coordinates (default is {0, 0}).
  *
- * @link http://alienryderflex.com/polygon_fill/
+ * @see scanPolygonRows
  */
 template<typename FnIn, typename FnOut, typename T, typename StepT>
 void mapShapeToGrid(FnIn fnIn, FnOut fnOut, const ShapeEdges& shape, const Vector<StepT>& steps,
@@ -303,15 +434,12 @@ void mapShapeToGrid(FnIn fnIn, FnOut fnOut, const ShapeEdges& shape, const Vecto
     const auto maxS = Vector<Ts>(max);
     const auto minS = Vector<Ts>(min);
 
-    DynamicArray<Ts> nodes;
-    nodes.reserve(10);
-
-    // Alias to edges
+    // Transformed vertices in grid coordinates
     DynamicArray<Vector<RealType>> edges;
     edges.reserve(shape.edges.size());
 
     for (const auto& edge : shape.edges)
-        edges.push_back(center + edge / steps);
+        edges.push_back(center + edge.rotated(rotation) / steps);
 
     // Single line
     if (edges.size() == 2)
@@ -369,39 +497,7 @@ void mapShapeToGrid(FnIn fnIn, FnOut fnOut, const ShapeEdges& shape, const Vecto
     }
     else
     {
-        //  Loop through the rows of the image.
-        for (auto y = Ts(min.getY()); y < Ts(max.getY()); ++y)
-        {
-            nodes.clear();
-
-            // Build a list of nodes
-            auto j = edges.size() - 1;
-            for (std::size_t i = 0u; i < edges.size(); ++i)
-            {
-                const auto yi = edges[i].getY();
-                const auto yj = edges[j].getY();
-                const auto yiI = static_cast<Ts>(yi);
-                const auto yjI = static_cast<Ts>(yj);
-
-                // Horizontal line
-                if ((yiI < y && yjI >= y) ||
-                    (yjI < y && yiI >= y))
-                {
-                    nodes.push_back(
-                        edges[i].getX() + (y - yi)
-                        / (yj - yi)
-                        * (edges[j].getX() - edges[i].getX())
-                    );
-                }
-
-                j = i;
-            }
-
-            CECE_ASSERT(nodes.size() % 2 == 0);
-
-            // Sort the nodes
-            std::sort(nodes.begin(), nodes.end());
-
+        scanPolygonRows([&] (Ts y, DynamicArray<Ts>& nodes) {
             //  Fill the pixels between node pairs.
             for (std::size_t i = 0u; i < nodes.size(); i += 2)
             {
@@ -425,7 +521,7 @@ void mapShapeToGrid(FnIn fnIn, FnOut fnOut, const ShapeEdges& shape, const Vecto
                     fnOut(Vector<T>(nodes[i], y));
                 }
             }
-        }
+        }, edges, maxS, minS);
     }
 }
 
@@ -664,6 +760,426 @@ OutIt mapShapeBorderToGrid(OutIt out, const ShapeCircle& shape, const Vector<Ste
 
 /* ************************************************************************ */
 
+/**
+ * @brief Map shape to grid as horizontal spans.
+ *
+ * Spans cover the same cells which mapShapeToGrid reports as inner, but
+ * clipped to [min, max) and reported by rows, so consumers can process
+ * whole row segments instead of single cells.
+ *
+ * @tparam Fn    Function called with row, first column and end column.
+ * @tparam T     Coordinate value type.
+ * @tparam StepT Step type.
+ *
+ * @param fn       Span callback.
+ * @param shape    Shape.
+ * @param steps    Grid cell size.
+ * @param center   Center in grid coordinates.
+ * @param rotation Shape rotation.
+ * @param max      Maximum coordinates.
+ * @param min      Minimum coordinates (default is {0, 0}).
+ */
+template<typename Fn, typename T, typename StepT>
+void mapShapeSpansToGrid(Fn fn, const Shape& shape, const Vector<StepT>& steps,
+    const Vector<T>& center, units::Angle rotation, const Vector<T>& max,
+    const Vector<T>& min = {})
+{
+    switch (shape.getType())
+    {
+    default:
+        break;
+
+    case ShapeType::Circle:
+        mapShapeSpansToGrid(fn, shape.getCircle(), steps, center, rotation, max, min);
+        break;
+
+    case ShapeType::Rectangle:
+        mapShapeSpansToGrid(fn, shape.getRectangle(), steps, center, rotation, max, min);
+        break;
+
+    case ShapeType::Edges:
+        mapShapeSpansToGrid(fn, shape.getEdges(), steps, center, rotation, max, min);
+        break;
+    }
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map circle shape to grid as horizontal spans.
+ *
+ * @tparam Fn    Function called with row, first column and end column.
+ * @tparam T     Coordinate value type.
+ * @tparam StepT Step type.
+ *
+ * @param fn       Span callback.
+ * @param shape    Circle shape.
+ * @param steps    Grid cell size.
+ * @param center   Circle center in grid coordinates.
+ * @param rotation Shape rotation.
+ * @param max      Maximum coordinates.
+ * @param min      Minimum coordinates (default is {0, 0}).
+ */
+template<typename Fn, typename T, typename StepT>
+void mapShapeSpansToGrid(Fn fn, const ShapeCircle& shape, const Vector<StepT>& steps,
+    const Vector<T>& center, units::Angle rotation, const Vector<T>& max,
+    const Vector<T>& min = {})
+{
+    // Get signed type
+    using Ts = typename std::make_signed<T>::type;
+
+    // Radius steps in grid
+    const auto radiusSteps = Vector<RealType>(shape.radius / steps);
+    const auto shapeCenter = Vector<Ts>(center + shape.center.rotated(rotation) / steps);
+    const auto maxS = Vector<Ts>(max);
+    const auto minS = Vector<Ts>(min);
+    const Ts radiusX = Ts(radiusSteps.getX());
+    const Ts radiusY = Ts(radiusSteps.getY());
+
+    // Same test as per-cell mapping
+    auto inside = [&radiusSteps] (Ts x, Ts y) {
+        const Vector<RealType> xyVec{ static_cast<RealType>(x), static_cast<RealType>(y) };
+        return operator/(xyVec, radiusSteps).getLengthSquared() <= RealType(1.0);
+    };
+
+    for (Ts y = -radiusY; y < radiusY; ++y)
+    {
+        const Ts row = shapeCenter.getY() + y;
+
+        if (row < minS.getY() || row >= maxS.getY())
+            continue;
+
+        // Estimate half width and correct it by exact test
+        const RealType ny = y / radiusSteps.getY();
+        Ts half = Ts(radiusSteps.getX() * std::sqrt(std::max(RealType(0), 1 - ny * ny)));
+
+        while (half >= 0 && !inside(half, y))
+            --half;
+
+        while (half < radiusX && inside(half + 1, y))
+            ++half;
+
+        if (half < 0)
+            continue;
+
+        const Ts begin = std::max(shapeCenter.getX() - half, minS.getX());
+        const Ts end = std::min(shapeCenter.getX() + std::min<Ts>(half + 1, radiusX), maxS.getX());
+
+        if (begin < end)
+            fn(T(row), T(begin), T(end));
+    }
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map rectangle shape to grid as horizontal spans.
+ *
+ * @tparam Fn    Function called with row, first column and end column.
+ * @tparam T     Coordinate value type.
+ * @tparam StepT Step type.
+ *
+ * @param fn       Span callback.
+ * @param shape    Rectangle shape.
+ * @param steps    Grid cell size.
+ * @param center   Rectangle center in grid coordinates.
+ * @param rotation Shape rotation.
+ * @param max      Maximum coordinates.
+ * @param min      Minimum coordinates (default is {0, 0}).
+ */
+template<typename Fn, typename T, typename StepT>
+void mapShapeSpansToGrid(Fn fn, const ShapeRectangle& shape, const Vector<StepT>& steps,
+    const Vector<T>& center, units::Angle rotation, const Vector<T>& max,
+    const Vector<T>& min = {})
+{
+    // Rotated rectangle is rasterized as polygon
+    if (rotation != Zero)
+    {
+        const auto half = shape.size / 2.f;
+
+        ShapeEdges edges;
+        edges.center = shape.center;
+        edges.edges = {
+            shape.center + units::PositionVector{-half.getWidth(), -half.getHeight()},
+            shape.center + units::PositionVector{ half.getWidth(), -half.getHeight()},
+            shape.center + units::PositionVector{ half.getWidth(),  half.getHeight()},
+            shape.center + units::PositionVector{-half.getWidth(),  half.getHeight()}
+        };
+
+        mapShapeSpansToGrid(fn, edges, steps, center, rotation, max, min);
+        return;
+    }
+
+    // Get signed type
+    using Ts = typename std::make_signed<T>::type;
+
+    const auto sizeSteps = Vector<RealType>(shape.size / steps / 2.f);
+    const auto shapeCenter = Vector<Ts>(center + shape.center / steps);
+    const auto maxS = Vector<Ts>(max);
+    const auto minS = Vector<Ts>(min);
+
+    const Ts begin = std::max<Ts>(shapeCenter.getX() + Ts(-sizeSteps.getX()), minS.getX());
+    const Ts end = std::min<Ts>(shapeCenter.getX() + Ts(sizeSteps.getX()), maxS.getX());
+
+    if (begin >= end)
+        return;
+
+    const Ts rowBegin = std::max<Ts>(shapeCenter.getY() + Ts(-sizeSteps.getY()), minS.getY());
+    const Ts rowEnd = std::min<Ts>(shapeCenter.getY() + Ts(sizeSteps.getY()), maxS.getY());
+
+    for (Ts row = rowBegin; row < rowEnd; ++row)
+        fn(T(row), T(begin), T(end));
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map edges shape to grid as horizontal spans.
+ *
+ * @tparam Fn    Function called with row, first column and end column.
+ * @tparam T     Coordinate value type.
+ * @tparam StepT Step type.
+ *
+ * @param fn       Span callback.
+ * @param shape    Edges shape.
+ * @param steps    Grid cell size.
+ * @param center   Edges center in grid coordinates.
+ * @param rotation Shape rotation.
+ * @param max      Maximum coordinates.
+ * @param min      Minimum coordinates (default is {0, 0}).
+ */
+template<typename Fn, typename T, typename StepT>
+void mapShapeSpansToGrid(Fn fn, const ShapeEdges& shape, const Vector<StepT>& steps,
+    const Vector<T>& center, units::Angle rotation, const Vector<T>& max,
+    const Vector<T>& min = Zero)
+{
+    // Get signed type
+    using Ts = typename std::make_signed<T>::type;
+
+    // Single line is mapped by cells
+    if (shape.edges.size() == 2)
+    {
+        mapShapeToGrid(
+            [&fn, &min, &max] (Vector<T>&& coord) {
+                if (coord.inRange(min, max))
+                    fn(coord.getY(), coord.getX(), coord.getX() + 1);
+            },
+            [] (Vector<T>&&) {},
+            shape, steps, center, rotation, max, min
+        );
+
+        return;
+    }
+
+    const auto maxS = Vector<Ts>(max);
+    const auto minS = Vector<Ts>(min);
+
+    // Transformed vertices in grid coordinates
+    DynamicArray<Vector<RealType>> edges;
+    edges.reserve(shape.edges.size());
+
+    for (const auto& edge : shape.edges)
+        edges.push_back(center + edge.rotated(rotation) / steps);
+
+    scanPolygonRows([&] (Ts y, const DynamicArray<Ts>& nodes) {
+        for (std::size_t i = 0u; i < nodes.size(); i += 2)
+        {
+            const Ts begin = std::max(nodes[i], minS.getX());
+            const Ts end = std::min(nodes[i + 1], maxS.getX());
+
+            if (begin < end)
+                fn(T(y), T(begin), T(end));
+        }
+    }, edges, maxS, minS);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map sphere shape to 3D grid.
+ *
+ * Cells are visited row by row, each row only within the sphere extent.
+ *
+ * @tparam FnIn
+ * @tparam FnOut
+ * @tparam T     Coordinate value type.
+ * @tparam StepT Step type.
+ *
+ * @param fnIn
+ * @param fnOut
+ * @param shape  Sphere shape
+ * @param steps
+ * @param center Sphere center in grid coordinates.
+ * @param max    Maximum coordinates.
+ * @param min    Minimum coordinates (default is {0, 0, 0}).
+ */
+template<typename FnIn, typename FnOut, typename T, typename StepT>
+void mapShapeToGrid(FnIn fnIn, FnOut fnOut, const ShapeSphere& shape, const BasicVector<StepT, 3>& steps,
+    const BasicVector<T, 3>& center, const BasicVector<T, 3>& max,
+    const BasicVector<T, 3>& min = {})
+{
+    // Get signed type
+    using Ts = typename std::make_signed<T>::type;
+
+    // Radius steps in grid
+    const auto radiusSteps = BasicVector<RealType, 3>(shape.radius / steps);
+    const auto shapeCenter = BasicVector<Ts, 3>(center + shape.center / steps);
+    const auto maxS = BasicVector<Ts, 3>(max);
+    const auto minS = BasicVector<Ts, 3>(min);
+
+    const Ts radiusX = Ts(radiusSteps.getX());
+
+    for (Ts z = Ts(-radiusSteps.getZ()); z < Ts(radiusSteps.getZ()); ++z)
+    {
+        const RealType lenZ = static_cast<RealType>(z) / radiusSteps.getZ();
+
+        for (Ts y = Ts(-radiusSteps.getY()); y < Ts(radiusSteps.getY()); ++y)
+        {
+            // Calculate normalized length for ellipsoid
+            const RealType lenY = static_cast<RealType>(y) / radiusSteps.getY();
+            const RealType lenYZ = lenY * lenY + lenZ * lenZ;
+
+            if (lenYZ > RealType(1.0))
+                continue;
+
+            // Row extent, one cell wider to cover rounding
+            const Ts extent = Ts(radiusSteps.getX() * std::sqrt(RealType(1.0) - lenYZ)) + 1;
+            const Ts x0 = std::max(-radiusX, -extent);
+            const Ts x1 = std::min(radiusX, extent + 1);
+
+            for (Ts x = x0; x < x1; ++x)
+            {
+                const RealType lenX = static_cast<RealType>(x) / radiusSteps.getX();
+
+                if (lenX * lenX + lenYZ > RealType(1.0))
+                    continue;
+
+                // Calculate grid coordinates
+                const auto coord = shapeCenter + BasicVector<Ts, 3>{x, y, z};
+
+                // Check if coordinates are in range
+                if (coord.inRange(minS, maxS))
+                    fnIn(BasicVector<T, 3>(coord));
+                else
+                    fnOut(BasicVector<T, 3>(coord));
+            }
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map sphere shape to 3D grid.
+ *
+ * @tparam OutIt Output iterator type.
+ * @tparam T     Coordinate value type.
+ * @tparam StepT Step type.
+ *
+ * @param out    Output iterator. It's required to be valid for all incrementations.
+ * @param shape  Sphere shape
+ * @param steps
+ * @param center Sphere center in grid coordinates.
+ * @param max    Maximum coordinates.
+ * @param min    Minimum coordinates (default is {0, 0, 0}).
+ */
+template<typename OutIt, typename T, typename StepT>
+OutIt mapShapeToGrid(OutIt out, const ShapeSphere& shape, const BasicVector<StepT, 3>& steps,
+    const BasicVector<T, 3>& center, const BasicVector<T, 3>& max,
+    const BasicVector<T, 3>& min = {})
+{
+    mapShapeToGrid(
+        [&out](BasicVector<T, 3>&& coord) { *out++ = coord; },
+        [](BasicVector<T, 3>&&) {},
+        shape, steps, center, max, min
+    );
+
+    return out;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map box shape to 3D grid.
+ *
+ * @tparam FnIn
+ * @tparam FnOut
+ * @tparam T     Coordinate value type.
+ * @tparam StepT Step type.
+ *
+ * @param fnIn
+ * @param fnOut
+ * @param shape  Box shape
+ * @param steps
+ * @param center Box center in grid coordinates.
+ * @param max    Maximum coordinates.
+ * @param min    Minimum coordinates (default is {0, 0, 0}).
+ */
+template<typename FnIn, typename FnOut, typename T, typename StepT>
+void mapShapeToGrid(FnIn fnIn, FnOut fnOut, const ShapeBox& shape, const BasicVector<StepT, 3>& steps,
+    const BasicVector<T, 3>& center, const BasicVector<T, 3>& max,
+    const BasicVector<T, 3>& min = {})
+{
+    // Get signed type
+    using Ts = typename std::make_signed<T>::type;
+
+    // Half size steps in grid
+    const auto sizeSteps = BasicVector<RealType, 3>(shape.size / steps / 2.f);
+    const auto shapeCenter = BasicVector<Ts, 3>(center + shape.center / steps);
+    const auto maxS = BasicVector<Ts, 3>(max);
+    const auto minS = BasicVector<Ts, 3>(min);
+
+    for (Ts z = Ts(-sizeSteps.getZ()); z < Ts(sizeSteps.getZ()); ++z)
+    {
+        for (Ts y = Ts(-sizeSteps.getY()); y < Ts(sizeSteps.getY()); ++y)
+        {
+            for (Ts x = Ts(-sizeSteps.getX()); x < Ts(sizeSteps.getX()); ++x)
+            {
+                // Calculate grid coordinates
+                const auto coord = shapeCenter + BasicVector<Ts, 3>{x, y, z};
+
+                // Check if coordinates are in range
+                if (coord.inRange(minS, maxS))
+                    fnIn(BasicVector<T, 3>(coord));
+                else
+                    fnOut(BasicVector<T, 3>(coord));
+            }
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map box shape to 3D grid.
+ *
+ * @tparam OutIt Output iterator type.
+ * @tparam T     Coordinate value type.
+ * @tparam StepT Step type.
+ *
+ * @param out    Output iterator. It's required to be valid for all incrementations.
+ * @param shape  Box shape
+ * @param steps
+ * @param center Box center in grid coordinates.
+ * @param max    Maximum coordinates.
+ * @param min    Minimum coordinates (default is {0, 0, 0}).
+ */
+template<typename OutIt, typename T, typename StepT>
+OutIt mapShapeToGrid(OutIt out, const ShapeBox& shape, const BasicVector<StepT, 3>& steps,
+    const BasicVector<T, 3>& center, const BasicVector<T, 3>& max,
+    const BasicVector<T, 3>& min = {})
+{
+    mapShapeToGrid(
+        [&out](BasicVector<T, 3>&& coord) { *out++ = coord; },
+        [](BasicVector<T, 3>&&) {},
+        shape, steps, center, max, min
+    );
+
+    return out;
+}
+
+/* ************************************************************************ */
+
 }
 }
 
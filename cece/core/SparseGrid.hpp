@@ -0,0 +1,591 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstdint>
+#include <algorithm>
+
+// CeCe
+#include "cece/core/Assert.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/StaticArray.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/UniquePtr.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Sparse grid of fixed-size blocks allocated on demand.
+ *
+ * Cells which were never written have background value and take no memory.
+ * Block directory is a small dense array (one index per block), so lookup
+ * is constant time without hashing. Allocated blocks are kept in active
+ * block list and sweeps visit only those blocks.
+ *
+ * Block addresses are stable, allocation of a new block doesn't invalidate
+ * references to cells of other blocks.
+ *
+ * @tparam T         Element type.
+ * @tparam BlockSize Block width and height in cells.
+ */
+template<typename T, unsigned int BlockSize = 16>
+class SparseGrid
+{
+
+// Public Types
+public:
+
+
+    /**
+     * @brief Value type.
+     */
+    using ValueType = T;
+
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = unsigned int;
+
+
+    /**
+     * @brief Coordinates type.
+     */
+    using CoordinateType = Vector<SizeType>;
+
+
+    /**
+     * @brief Block of cells.
+     */
+    struct Block
+    {
+        /// Block coordinates (in blocks).
+        CoordinateType coordinate;
+
+        /// Row-major block data.
+        StaticArray<T, BlockSize * BlockSize> data;
+    };
+
+
+// Public Constants
+public:
+
+
+    /// Block width and height.
+    static constexpr SizeType BLOCK_SIZE = BlockSize;
+
+    /// Number of cells in block.
+    static constexpr SizeType BLOCK_CELLS = BlockSize * BlockSize;
+
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Default constructor.
+     */
+    SparseGrid() = default;
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param size       Grid size.
+     * @param background Value of cells which were not allocated.
+     */
+    explicit SparseGrid(Vector<SizeType> size, ValueType background = ValueType{})
+        : m_background(std::move(background))
+    {
+        resize(std::move(size));
+    }
+
+
+// Public Operators
+public:
+
+
+    /**
+     * @brief Access cell for writing, allocate its block if required.
+     *
+     * Reading through this operator allocates the block too, use get() or
+     * find() for reading.
+     *
+     * @param coord Cell coordinates.
+     *
+     * @return
+     */
+    ValueType& operator[](const CoordinateType& coord)
+    {
+        CECE_ASSERT(inRange(coord));
+
+        const auto blockCoord = coord / BLOCK_SIZE;
+        return allocate(blockCoord).data[calcCellOffset(coord)];
+    }
+
+
+    /**
+     * @brief Access cell.
+     *
+     * @param coord Cell coordinates.
+     *
+     * @return Cell value or background value if block is not allocated.
+     */
+    const ValueType& operator[](const CoordinateType& coord) const noexcept
+    {
+        return get(coord);
+    }
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns grid size.
+     *
+     * @return
+     */
+    const Vector<SizeType>& getSize() const noexcept
+    {
+        return m_size;
+    }
+
+
+    /**
+     * @brief Returns grid size in blocks.
+     *
+     * @return
+     */
+    const Vector<SizeType>& getBlocksSize() const noexcept
+    {
+        return m_blocksSize;
+    }
+
+
+    /**
+     * @brief Returns background value.
+     *
+     * @return
+     */
+    const ValueType& getBackground() const noexcept
+    {
+        return m_background;
+    }
+
+
+    /**
+     * @brief Returns number of allocated blocks.
+     *
+     * @return
+     */
+    std::size_t getBlockCount() const noexcept
+    {
+        return m_blocks.size();
+    }
+
+
+    /**
+     * @brief Returns allocated blocks.
+     *
+     * @return
+     */
+    const DynamicArray<UniquePtr<Block>>& getBlocks() const noexcept
+    {
+        return m_blocks;
+    }
+
+
+    /**
+     * @brief Returns number of bytes used by allocated blocks and directory.
+     *
+     * @return
+     */
+    std::size_t getMemorySize() const noexcept
+    {
+        return m_blocks.size() * (sizeof(Block) + sizeof(UniquePtr<Block>)) +
+            m_directory.size() * sizeof(std::int32_t);
+    }
+
+
+    /**
+     * @brief Check if coordinates are in range.
+     *
+     * @param coord Cell coordinates.
+     *
+     * @return
+     */
+    bool inRange(const CoordinateType& coord) const noexcept
+    {
+        return
+            coord.getX() < getSize().getWidth() &&
+            coord.getY() < getSize().getHeight()
+        ;
+    }
+
+
+    /**
+     * @brief Check if cell's block is allocated.
+     *
+     * @param coord Cell coordinates.
+     *
+     * @return
+     */
+    bool isAllocated(const CoordinateType& coord) const noexcept
+    {
+        CECE_ASSERT(inRange(coord));
+        return m_directory[calcBlockOffset(coord / BLOCK_SIZE)] >= 0;
+    }
+
+
+    /**
+     * @brief Returns cell value.
+     *
+     * @param coord Cell coordinates.
+     *
+     * @return Cell value or background value if block is not allocated.
+     */
+    const ValueType& get(const CoordinateType& coord) const noexcept
+    {
+        CECE_ASSERT(inRange(coord));
+
+        const auto index = m_directory[calcBlockOffset(coord / BLOCK_SIZE)];
+
+        if (index < 0)
+            return m_background;
+
+        return m_blocks[index]->data[calcCellOffset(coord)];
+    }
+
+
+    /**
+     * @brief Find cell without allocating its block.
+     *
+     * @param coord Cell coordinates.
+     *
+     * @return Pointer to cell or nullptr if block is not allocated.
+     */
+    ValueType* find(const CoordinateType& coord) noexcept
+    {
+        CECE_ASSERT(inRange(coord));
+
+        const auto index = m_directory[calcBlockOffset(coord / BLOCK_SIZE)];
+
+        if (index < 0)
+            return nullptr;
+
+        return &m_blocks[index]->data[calcCellOffset(coord)];
+    }
+
+
+    /**
+     * @brief Find cell without allocating its block.
+     *
+     * @param coord Cell coordinates.
+     *
+     * @return Pointer to cell or nullptr if block is not allocated.
+     */
+    const ValueType* find(const CoordinateType& coord) const noexcept
+    {
+        CECE_ASSERT(inRange(coord));
+
+        const auto index = m_directory[calcBlockOffset(coord / BLOCK_SIZE)];
+
+        if (index < 0)
+            return nullptr;
+
+        return &m_blocks[index]->data[calcCellOffset(coord)];
+    }
+
+
+// Public Mutators
+public:
+
+
+    /**
+     * @brief Change cell value.
+     *
+     * Block is allocated only when the value differs from background value.
+     *
+     * @param coord Cell coordinates.
+     * @param value New value.
+     */
+    void set(const CoordinateType& coord, ValueType value)
+    {
+        if (auto cell = find(coord))
+            *cell = std::move(value);
+        else if (!(value == m_background))
+            (*this)[coord] = std::move(value);
+    }
+
+
+    /**
+     * @brief Change background value.
+     *
+     * Allocated cells keep their values.
+     *
+     * @param background
+     */
+    void setBackground(ValueType background)
+    {
+        m_background = std::move(background);
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Resize grid. All blocks are released.
+     *
+     * @param size New size of the grid.
+     */
+    void resize(Vector<SizeType> size)
+    {
+        m_size = std::move(size);
+        m_blocksSize = (m_size + (BLOCK_SIZE - 1)) / BLOCK_SIZE;
+        m_blocks.clear();
+        m_directory.assign(m_blocksSize.getWidth() * m_blocksSize.getHeight(), -1);
+    }
+
+
+    /**
+     * @brief Release all blocks.
+     */
+    void clear() noexcept
+    {
+        m_blocks.clear();
+        std::fill(m_directory.begin(), m_directory.end(), -1);
+    }
+
+
+    /**
+     * @brief Returns block, allocate it if required.
+     *
+     * New block is filled with background value.
+     *
+     * @param blockCoord Block coordinates.
+     *
+     * @return
+     */
+    Block& allocate(const CoordinateType& blockCoord)
+    {
+        auto& index = m_directory[calcBlockOffset(blockCoord)];
+
+        if (index < 0)
+        {
+            auto block = makeUnique<Block>();
+            block->coordinate = blockCoord;
+            block->data.fill(m_background);
+
+            index = static_cast<std::int32_t>(m_blocks.size());
+            m_blocks.push_back(std::move(block));
+        }
+
+        return *m_blocks[index];
+    }
+
+
+    /**
+     * @brief Release block.
+     *
+     * @param blockCoord Block coordinates.
+     */
+    void release(const CoordinateType& blockCoord) noexcept
+    {
+        auto& index = m_directory[calcBlockOffset(blockCoord)];
+
+        if (index < 0)
+            return;
+
+        // Move last block into the gap
+        const auto position = index;
+        index = -1;
+
+        if (static_cast<std::size_t>(position) + 1 != m_blocks.size())
+        {
+            m_blocks[position] = std::move(m_blocks.back());
+            m_directory[calcBlockOffset(m_blocks[position]->coordinate)] = position;
+        }
+
+        m_blocks.pop_back();
+    }
+
+
+    /**
+     * @brief Release blocks whose cells all have background value.
+     *
+     * @return Number of released blocks.
+     */
+    std::size_t prune()
+    {
+        std::size_t count = 0;
+
+        for (std::size_t i = m_blocks.size(); i-- > 0; )
+        {
+            const auto& data = m_blocks[i]->data;
+            const bool empty = std::all_of(data.begin(), data.end(), [this] (const ValueType& value) {
+                return value == m_background;
+            });
+
+            if (empty)
+            {
+                release(m_blocks[i]->coordinate);
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+
+    /**
+     * @brief Call function for every allocated cell.
+     *
+     * Cells of unallocated blocks are skipped.
+     *
+     * @param fn Function called with cell coordinates and value reference.
+     */
+    template<typename Fn>
+    void forEach(Fn fn)
+    {
+        for (auto& block : m_blocks)
+            forEachCell(*block, block->data.data(), fn);
+    }
+
+
+    /**
+     * @brief Call function for every allocated cell.
+     *
+     * Cells of unallocated blocks are skipped.
+     *
+     * @param fn Function called with cell coordinates and value reference.
+     */
+    template<typename Fn>
+    void forEach(Fn fn) const
+    {
+        for (const auto& block : m_blocks)
+            forEachCell(*block, block->data.data(), fn);
+    }
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Calculate offset of block in directory.
+     *
+     * @param blockCoord
+     *
+     * @return
+     */
+    SizeType calcBlockOffset(const CoordinateType& blockCoord) const noexcept
+    {
+        CECE_ASSERT(blockCoord.getX() < m_blocksSize.getWidth());
+        CECE_ASSERT(blockCoord.getY() < m_blocksSize.getHeight());
+        return blockCoord.getY() * m_blocksSize.getWidth() + blockCoord.getX();
+    }
+
+
+    /**
+     * @brief Calculate offset of cell in its block.
+     *
+     * @param coord
+     *
+     * @return
+     */
+    static SizeType calcCellOffset(const CoordinateType& coord) noexcept
+    {
+        return (coord.getY() % BLOCK_SIZE) * BLOCK_SIZE + (coord.getX() % BLOCK_SIZE);
+    }
+
+
+    /**
+     * @brief Call function for block cells inside the grid.
+     *
+     * @param block
+     * @param data
+     * @param fn
+     */
+    template<typename Data, typename Fn>
+    void forEachCell(const Block& block, Data* data, Fn& fn) const
+    {
+        const auto origin = block.coordinate * BLOCK_SIZE;
+        const auto width = std::min(BLOCK_SIZE, m_size.getWidth() - origin.getX());
+        const auto height = std::min(BLOCK_SIZE, m_size.getHeight() - origin.getY());
+
+        for (SizeType y = 0; y < height; ++y)
+            for (SizeType x = 0; x < width; ++x)
+                fn(origin + CoordinateType{x, y}, data[y * BLOCK_SIZE + x]);
+    }
+
+
+// Private Data Members
+private:
+
+    /// Grid size.
+    Vector<SizeType> m_size;
+
+    /// Grid size in blocks.
+    Vector<SizeType> m_blocksSize;
+
+    /// Background value.
+    ValueType m_background{};
+
+    /// Allocated (active) blocks.
+    DynamicArray<UniquePtr<Block>> m_blocks;
+
+    /// Block index for each block coordinate, negative if not allocated.
+    DynamicArray<std::int32_t> m_directory;
+
+};
+
+/* ************************************************************************ */
+
+template<typename T, unsigned int BlockSize>
+constexpr typename SparseGrid<T, BlockSize>::SizeType SparseGrid<T, BlockSize>::BLOCK_SIZE;
+
+/* ************************************************************************ */
+
+template<typename T, unsigned int BlockSize>
+constexpr typename SparseGrid<T, BlockSize>::SizeType SparseGrid<T, BlockSize>::BLOCK_CELLS;
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
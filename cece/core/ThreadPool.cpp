@@ -0,0 +1,199 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/core/ThreadPool.hpp"
+
+// C++
+#include <algorithm>
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// If current thread executes pool tasks.
+thread_local bool g_inTask = false;
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+ThreadPool::ThreadPool(unsigned int count)
+{
+    if (count == 0)
+        count = std::max(std::thread::hardware_concurrency(), 1u);
+
+    m_workers.reserve(count - 1);
+
+    for (unsigned int i = 1; i < count; ++i)
+        m_workers.emplace_back(&ThreadPool::work, this);
+}
+
+/* ************************************************************************ */
+
+ThreadPool::~ThreadPool()
+{
+    {
+        MutexGuard lock(m_mutex);
+        m_stop = true;
+    }
+
+    m_startCondition.notify_all();
+
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+/* ************************************************************************ */
+
+void ThreadPool::run(std::size_t count, const TaskFn& fn)
+{
+    if (count == 0)
+        return;
+
+    // Serial execution
+    if (g_inTask || m_workers.empty() || count == 1)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            fn(i);
+
+        return;
+    }
+
+    MutexGuard runGuard(m_runMutex);
+
+    {
+        MutexGuard lock(m_mutex);
+        m_fn = &fn;
+        m_count = count;
+        m_next.store(0, std::memory_order_relaxed);
+        m_finished = 0;
+        m_exception = nullptr;
+        ++m_generation;
+    }
+
+    m_startCondition.notify_all();
+
+    g_inTask = true;
+    process();
+    g_inTask = false;
+
+    std::exception_ptr exception;
+
+    {
+        std::unique_lock<Mutex> lock(m_mutex);
+        m_doneCondition.wait(lock, [this] {
+            return m_finished == m_workers.size();
+        });
+
+        m_fn = nullptr;
+        exception = m_exception;
+        m_exception = nullptr;
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+/* ************************************************************************ */
+
+ThreadPool& ThreadPool::getDefault()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+/* ************************************************************************ */
+
+void ThreadPool::work()
+{
+    g_inTask = true;
+    unsigned long generation = 0;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<Mutex> lock(m_mutex);
+            m_startCondition.wait(lock, [this, generation] {
+                return m_stop || m_generation != generation;
+            });
+
+            if (m_stop)
+                return;
+
+            generation = m_generation;
+        }
+
+        process();
+
+        {
+            MutexGuard lock(m_mutex);
+            ++m_finished;
+        }
+
+        m_doneCondition.notify_one();
+    }
+}
+
+/* ************************************************************************ */
+
+void ThreadPool::process() noexcept
+{
+    for (;;)
+    {
+        const auto index = m_next.fetch_add(1, std::memory_order_relaxed);
+
+        if (index >= m_count)
+            break;
+
+        try
+        {
+            (*m_fn)(index);
+        }
+        catch (...)
+        {
+            MutexGuard lock(m_mutex);
+
+            if (!m_exception)
+                m_exception = std::current_exception();
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,187 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+#include <thread>
+#include <functional>
+#include <exception>
+#include <condition_variable>
+
+// CeCe
+#include "cece/core/Mutex.hpp"
+#include "cece/core/Atomic.hpp"
+#include "cece/core/DynamicArray.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Pool of worker threads for data parallel loops.
+ *
+ * Pool runs one batch of indexed tasks at time and the calling thread takes
+ * part in the work. Calls from inside of a running task are executed
+ * serially so nested parallel algorithms cannot deadlock.
+ */
+class ThreadPool
+{
+
+// Public Types
+public:
+
+
+    /// Task function, called with task index.
+    using TaskFn = std::function<void(std::size_t)>;
+
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param count Number of threads including the calling thread. Zero
+     *              means number of hardware threads.
+     */
+    explicit ThreadPool(unsigned int count = 0);
+
+
+    /**
+     * @brief Destructor.
+     */
+    ~ThreadPool();
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns number of threads including the calling thread.
+     *
+     * @return
+     */
+    unsigned int getThreadCount() const noexcept
+    {
+        return static_cast<unsigned int>(m_workers.size()) + 1;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Run tasks with indices [0, count) and wait for them.
+     *
+     * Order of task execution is not specified. First exception thrown by
+     * a task is rethrown after all tasks are finished.
+     *
+     * @param count Number of tasks.
+     * @param fn    Task function.
+     */
+    void run(std::size_t count, const TaskFn& fn);
+
+
+    /**
+     * @brief Returns shared pool.
+     *
+     * @return
+     */
+    static ThreadPool& getDefault();
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Worker thread main loop.
+     */
+    void work();
+
+
+    /**
+     * @brief Process tasks of current batch until none are left.
+     */
+    void process() noexcept;
+
+
+// Private Data Members
+private:
+
+    /// Worker threads.
+    DynamicArray<std::thread> m_workers;
+
+    /// Serializes callers of run().
+    Mutex m_runMutex;
+
+    /// Protects batch state.
+    Mutex m_mutex;
+
+    /// Signals new batch or stop.
+    std::condition_variable m_startCondition;
+
+    /// Signals finished workers.
+    std::condition_variable m_doneCondition;
+
+    /// Current batch function.
+    const TaskFn* m_fn = nullptr;
+
+    /// Number of tasks in current batch.
+    std::size_t m_count = 0;
+
+    /// Next task index.
+    Atomic<std::size_t> m_next{0};
+
+    /// Batch generation.
+    unsigned long m_generation = 0;
+
+    /// Number of workers finished with current batch.
+    unsigned int m_finished = 0;
+
+    /// First exception thrown by a task.
+    std::exception_ptr m_exception;
+
+    /// Stop flag.
+    bool m_stop = false;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -189,6 +189,8 @@ inline TimeMeasurementDummy measure_time(Args&&... args) noexcept
  * @param fn   Output function.
  *
  * @return
+ *
+ * @deprecated Use CECE_PROFILE_ZONE from cece/core/Profiler.hpp.
  */
 template<typename Fn>
 inline TimeMeasurementBase<Fn> measure_time(String name, Fn fn) noexcept
@@ -206,6 +208,8 @@ inline TimeMeasurementBase<Fn> measure_time(String name, Fn fn) noexcept
  * @param name Measurement name.
  *
  * @return
+ *
+ * @deprecated Use CECE_PROFILE_ZONE from cece/core/Profiler.hpp.
  */
 inline TimeMeasurementBase<DefaultMeasurementOutput> measure_time(String name) noexcept
 {
@@ -51,9 +51,9 @@ namespace units {
 /* ************************************************************************ */
 
 /**
- * @brief Basic value.
+ * @brief Basic value, units are computed in computation precision.
  */
-using Value = RealType;
+using Value = ComputeRealType;
 
 /* ************************************************************************ */
 
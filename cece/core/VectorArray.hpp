@@ -0,0 +1,674 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+// CeCe
+#include "cece/core/Macro.hpp"
+#include "cece/core/Assert.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/StaticArray.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/AlignedAllocator.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+inline namespace core {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Array of vectors stored as structure of arrays.
+ *
+ * Each vector component is stored in its own contiguous array, so bulk
+ * operations over many vectors (positions, velocities, forces) run over
+ * plain arrays which the compiler vectorizes. Vectors are accessed by
+ * value, component arrays by getComponent().
+ *
+ * Value type can be a unit type from Units.hpp, e.g.
+ * VectorArray<units::Length> for positions.
+ *
+ * @tparam T     Component value type.
+ * @tparam N     Number of components.
+ * @tparam Alloc Component array allocator.
+ */
+template<typename T, unsigned N = config::DIMENSION, typename Alloc = AlignedAllocator<T, 64>>
+class VectorArray
+{
+
+// Public Types
+public:
+
+
+    /**
+     * @brief Component value type.
+     */
+    using ValueType = T;
+
+
+    /**
+     * @brief Vector type.
+     */
+    using VectorType = BasicVector<T, N>;
+
+
+    /**
+     * @brief Allocator type.
+     */
+    using AllocatorType = Alloc;
+
+
+    /**
+     * @brief Component array type.
+     */
+    using ContainerType = DynamicArray<T, Alloc>;
+
+
+    /**
+     * @brief Size type.
+     */
+    using SizeType = std::size_t;
+
+
+// Public Constants
+public:
+
+
+    /**
+     * @brief Number of components.
+     */
+    static constexpr unsigned SIZE = N;
+
+
+    /**
+     * @brief Number of vectors processed together.
+     *
+     * Constant block length lets the compiler vectorize the loops without
+     * runtime trip count checks.
+     */
+    static constexpr SizeType BLOCK_SIZE = 16;
+
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Default constructor.
+     */
+    VectorArray() = default;
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param size  Number of vectors.
+     * @param value Initial value.
+     */
+    explicit VectorArray(SizeType size, const VectorType& value = VectorType{})
+    {
+        resize(size, value);
+    }
+
+
+// Public Operators
+public:
+
+
+    /**
+     * @brief Returns vector at given position.
+     *
+     * @param pos
+     *
+     * @return
+     */
+    VectorType operator[](SizeType pos) const noexcept
+    {
+        return get(pos);
+    }
+
+
+    /**
+     * @brief Add vectors element-wise.
+     *
+     * @param rhs
+     *
+     * @return *this.
+     */
+    template<typename T2, typename Alloc2>
+    VectorArray& operator+=(const VectorArray<T2, N, Alloc2>& rhs) noexcept
+    {
+        CECE_ASSERT(rhs.getSize() == getSize());
+
+        for (unsigned d = 0; d < N; ++d)
+        {
+            T* out = getComponent(d);
+            const T2* in = rhs.getComponent(d);
+            update(out, getSize(), [in] (const T& value, SizeType i) { return value + in[i]; });
+        }
+
+        return *this;
+    }
+
+
+    /**
+     * @brief Subtract vectors element-wise.
+     *
+     * @param rhs
+     *
+     * @return *this.
+     */
+    template<typename T2, typename Alloc2>
+    VectorArray& operator-=(const VectorArray<T2, N, Alloc2>& rhs) noexcept
+    {
+        CECE_ASSERT(rhs.getSize() == getSize());
+
+        for (unsigned d = 0; d < N; ++d)
+        {
+            T* out = getComponent(d);
+            const T2* in = rhs.getComponent(d);
+            update(out, getSize(), [in] (const T& value, SizeType i) { return value - in[i]; });
+        }
+
+        return *this;
+    }
+
+
+    /**
+     * @brief Multiply all vectors by scalar.
+     *
+     * @param rhs
+     *
+     * @return *this.
+     */
+    VectorArray& operator*=(RealType rhs) noexcept
+    {
+        for (unsigned d = 0; d < N; ++d)
+        {
+            T* out = getComponent(d);
+            update(out, getSize(), [rhs] (const T& value, SizeType) { return value * rhs; });
+        }
+
+        return *this;
+    }
+
+
+    /**
+     * @brief Divide all vectors by scalar.
+     *
+     * @param rhs
+     *
+     * @return *this.
+     */
+    VectorArray& operator/=(RealType rhs) noexcept
+    {
+        return *this *= RealType(1) / rhs;
+    }
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns if array is empty.
+     *
+     * @return
+     */
+    bool isEmpty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+
+    /**
+     * @brief Returns number of vectors.
+     *
+     * @return
+     */
+    SizeType getSize() const noexcept
+    {
+        return m_size;
+    }
+
+
+    /**
+     * @brief Returns component array.
+     *
+     * @param d Component index.
+     *
+     * @return
+     */
+    T* getComponent(unsigned d) noexcept
+    {
+        CECE_ASSERT(d < N);
+        return m_components[d].data();
+    }
+
+
+    /**
+     * @brief Returns component array.
+     *
+     * @param d Component index.
+     *
+     * @return
+     */
+    const T* getComponent(unsigned d) const noexcept
+    {
+        CECE_ASSERT(d < N);
+        return m_components[d].data();
+    }
+
+
+    /**
+     * @brief Returns vector at given position.
+     *
+     * @param pos
+     *
+     * @return
+     */
+    VectorType get(SizeType pos) const noexcept
+    {
+        CECE_ASSERT(pos < m_size);
+
+        VectorType res;
+
+        for (unsigned d = 0; d < N; ++d)
+            res[d] = m_components[d][pos];
+
+        return res;
+    }
+
+
+// Public Mutators
+public:
+
+
+    /**
+     * @brief Change vector at given position.
+     *
+     * @param pos
+     * @param value
+     */
+    void set(SizeType pos, const VectorType& value) noexcept
+    {
+        CECE_ASSERT(pos < m_size);
+
+        for (unsigned d = 0; d < N; ++d)
+            m_components[d][pos] = value[d];
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Resize array.
+     *
+     * @param size  New number of vectors.
+     * @param value Value of the new vectors.
+     */
+    void resize(SizeType size, const VectorType& value = VectorType{})
+    {
+        for (unsigned d = 0; d < N; ++d)
+            m_components[d].resize(size, value[d]);
+
+        m_size = size;
+    }
+
+
+    /**
+     * @brief Reserve memory for vectors.
+     *
+     * @param size
+     */
+    void reserve(SizeType size)
+    {
+        for (auto& component : m_components)
+            component.reserve(size);
+    }
+
+
+    /**
+     * @brief Remove all vectors.
+     */
+    void clear() noexcept
+    {
+        for (auto& component : m_components)
+            component.clear();
+
+        m_size = 0;
+    }
+
+
+    /**
+     * @brief Append vector.
+     *
+     * @param value
+     */
+    void push(const VectorType& value)
+    {
+        for (unsigned d = 0; d < N; ++d)
+            m_components[d].push_back(value[d]);
+
+        ++m_size;
+    }
+
+
+    /**
+     * @brief Set all vectors to given value.
+     *
+     * @param value
+     */
+    void fill(const VectorType& value) noexcept
+    {
+        for (unsigned d = 0; d < N; ++d)
+        {
+            T* out = getComponent(d);
+            const T component = value[d];
+            generate(out, getSize(), [component] (SizeType) { return component; });
+        }
+    }
+
+
+    /**
+     * @brief Add scaled vectors, e.g. position.addScaled(velocity, dt).
+     *
+     * @param rhs   Added vectors.
+     * @param scale Scale, T2 * S must be convertible to T.
+     */
+    template<typename T2, typename Alloc2, typename S>
+    void addScaled(const VectorArray<T2, N, Alloc2>& rhs, S scale) noexcept
+    {
+        CECE_ASSERT(rhs.getSize() == getSize());
+
+        for (unsigned d = 0; d < N; ++d)
+        {
+            T* out = getComponent(d);
+            const T2* in = rhs.getComponent(d);
+            update(out, getSize(), [in, scale] (const T& value, SizeType i) { return value + in[i] * scale; });
+        }
+    }
+
+
+    /**
+     * @brief Load vectors from given positions of other array.
+     *
+     * @param src     Source array.
+     * @param indices Source positions.
+     * @param count   Number of positions.
+     */
+    template<typename Alloc2, typename IndexType>
+    void gather(const VectorArray<T, N, Alloc2>& src, const IndexType* indices, SizeType count)
+    {
+        resize(count);
+
+        for (unsigned d = 0; d < N; ++d)
+        {
+            T* out = getComponent(d);
+            const T* in = src.getComponent(d);
+
+            generate(out, count, [in, indices] (SizeType i) { return in[indices[i]]; });
+        }
+    }
+
+
+    /**
+     * @brief Store vectors into given positions of other array.
+     *
+     * @param dst     Destination array.
+     * @param indices Destination positions, one for each vector. They
+     *                should be unique, otherwise the last value wins.
+     */
+    template<typename Alloc2, typename IndexType>
+    void scatter(VectorArray<T, N, Alloc2>& dst, const IndexType* indices) const noexcept
+    {
+        for (unsigned d = 0; d < N; ++d)
+        {
+            T* out = dst.getComponent(d);
+            const T* in = getComponent(d);
+
+            for (SizeType i = 0; i < getSize(); ++i)
+                out[indices[i]] = in[i];
+        }
+    }
+
+
+    /**
+     * @brief Store function results for all indices in range [0, count).
+     *
+     * Indices are processed in blocks of constant size, the output array
+     * must not be accessed by the function.
+     *
+     * @param out   Output array.
+     * @param count Number of indices.
+     * @param fn    Function called with index, returns output value.
+     */
+    template<typename Out, typename Fn>
+    static void generate(Out* CECE_RESTRICT out, SizeType count, Fn fn) noexcept
+    {
+        SizeType i = 0;
+
+        for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+        {
+            for (SizeType j = 0; j < BLOCK_SIZE; ++j)
+                out[i + j] = fn(i + j);
+        }
+
+        for (; i < count; ++i)
+            out[i] = fn(i);
+    }
+
+
+    /**
+     * @brief Update values for all indices in range [0, count).
+     *
+     * @param out   Updated array.
+     * @param count Number of indices.
+     * @param fn    Function called with current value and index, returns
+     *              new value.
+     */
+    template<typename Out, typename Fn>
+    static void update(Out* CECE_RESTRICT out, SizeType count, Fn fn) noexcept
+    {
+        SizeType i = 0;
+
+        for (; i + BLOCK_SIZE <= count; i += BLOCK_SIZE)
+        {
+            for (SizeType j = 0; j < BLOCK_SIZE; ++j)
+                out[i + j] = fn(out[i + j], i + j);
+        }
+
+        for (; i < count; ++i)
+            out[i] = fn(out[i], i);
+    }
+
+
+// Private Data Members
+private:
+
+    /// Component arrays.
+    StaticArray<ContainerType, N> m_components;
+
+    /// Number of vectors.
+    SizeType m_size = 0;
+
+};
+
+/* ************************************************************************ */
+
+template<typename T, unsigned N, typename Alloc>
+constexpr unsigned VectorArray<T, N, Alloc>::SIZE;
+
+/* ************************************************************************ */
+
+template<typename T, unsigned N, typename Alloc>
+constexpr typename VectorArray<T, N, Alloc>::SizeType VectorArray<T, N, Alloc>::BLOCK_SIZE;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate dot products of vectors at the same positions.
+ *
+ * @param lhs
+ * @param rhs
+ * @param out Output array, one value for each vector.
+ */
+template<typename T1, typename T2, unsigned N, typename Alloc1, typename Alloc2, typename Out>
+void dot(const VectorArray<T1, N, Alloc1>& lhs, const VectorArray<T2, N, Alloc2>& rhs, Out* out) noexcept
+{
+    using SizeType = typename VectorArray<T1, N, Alloc1>::SizeType;
+
+    CECE_ASSERT(lhs.getSize() == rhs.getSize());
+
+    StaticArray<const T1*, N> a;
+    StaticArray<const T2*, N> b;
+
+    for (unsigned d = 0; d < N; ++d)
+    {
+        a[d] = lhs.getComponent(d);
+        b[d] = rhs.getComponent(d);
+    }
+
+    VectorArray<T1, N, Alloc1>::generate(out, lhs.getSize(), [&a, &b] (SizeType i) {
+        auto sum = a[0][i] * b[0][i];
+
+        for (unsigned d = 1; d < N; ++d)
+            sum += a[d][i] * b[d][i];
+
+        return sum;
+    });
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate squared lengths of vectors.
+ *
+ * @param array
+ * @param out   Output array, one value for each vector.
+ */
+template<typename T, unsigned N, typename Alloc, typename Out>
+void getLengthSquared(const VectorArray<T, N, Alloc>& array, Out* out) noexcept
+{
+    dot(array, array, out);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate lengths of vectors.
+ *
+ * @param array
+ * @param out   Output array, one value for each vector.
+ */
+template<typename T, unsigned N, typename Alloc>
+void getLength(const VectorArray<T, N, Alloc>& array, T* out) noexcept
+{
+    using SizeType = typename VectorArray<T, N, Alloc>::SizeType;
+    using std::sqrt;
+
+    StaticArray<const T*, N> in;
+
+    for (unsigned d = 0; d < N; ++d)
+        in[d] = array.getComponent(d);
+
+    VectorArray<T, N, Alloc>::generate(out, array.getSize(), [&in] (SizeType i) {
+        auto sum = in[0][i] * in[0][i];
+
+        for (unsigned d = 1; d < N; ++d)
+            sum += in[d][i] * in[d][i];
+
+        return static_cast<T>(sqrt(sum));
+    });
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Calculate unit vectors with direction of given vectors. Zero
+ * vectors stay zero.
+ *
+ * @param array Input vectors.
+ * @param out   Output unit vectors, resized to input size.
+ */
+template<typename T, unsigned N, typename Alloc, typename Alloc2>
+void normalize(const VectorArray<T, N, Alloc>& array, VectorArray<RealType, N, Alloc2>& out)
+{
+    using SizeType = typename VectorArray<T, N, Alloc>::SizeType;
+
+    out.resize(array.getSize());
+
+    // Lengths are stored temporarily in the first output component
+    RealType* length = out.getComponent(0);
+    StaticArray<const T*, N> in;
+
+    for (unsigned d = 0; d < N; ++d)
+        in[d] = array.getComponent(d);
+
+    VectorArray<T, N, Alloc>::generate(length, array.getSize(), [&in] (SizeType i) {
+        using std::sqrt;
+        auto sum = in[0][i] * in[0][i];
+
+        for (unsigned d = 1; d < N; ++d)
+            sum += in[d][i] * in[d][i];
+
+        const RealType len = static_cast<RealType>(sqrt(sum) / T(1));
+        const RealType inv = RealType(1) / len;
+        return len > 0 ? inv : RealType(0);
+    });
+
+    for (unsigned d = 1; d < N; ++d)
+    {
+        const T* src = in[d];
+
+        VectorArray<T, N, Alloc>::generate(out.getComponent(d), array.getSize(), [src, length] (SizeType i) {
+            return static_cast<RealType>(src[i] / T(1)) * length[i];
+        });
+    }
+
+    // First component replaces the stored lengths
+    const T* src = in[0];
+
+    VectorArray<T, N, Alloc>::update(length, array.getSize(), [src] (RealType value, SizeType i) {
+        return static_cast<RealType>(src[i] / T(1)) * value;
+    });
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
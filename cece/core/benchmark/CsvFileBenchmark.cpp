@@ -0,0 +1,151 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cstdio>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/String.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/StringStream.hpp"
+#include "cece/core/FileStream.hpp"
+#include "cece/core/CsvFile.hpp"
+#include "cece/core/DataExportCsv.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Writes records the way CsvFile and DataExportCsv did before the
+ * buffered writer: value strings through OutStringStream and FileStream.
+ */
+static void CsvFile_legacy(benchmark::State& state)
+{
+    FileStream file("CsvFile_legacy.csv", std::ios::binary | std::ios::out | std::ios::trunc);
+    int iteration = 0;
+
+    for (auto _ : state)
+    {
+        DynamicArray<String> values(4);
+        values[0] = toString(iteration++);
+
+        for (int i = 1; i < 4; ++i)
+        {
+            OutStringStream oss;
+            oss << std::scientific << iteration * 0.123456789 * i;
+            values[i] = oss.str();
+        }
+
+        for (auto it = values.begin(); it != values.end(); ++it)
+        {
+            if (it != values.begin())
+                file << ';';
+
+            file << *it;
+        }
+
+        file << "\r\n";
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    std::remove("CsvFile_legacy.csv");
+}
+
+BENCHMARK(CsvFile_legacy);
+
+/* ************************************************************************ */
+
+static void CsvFile_writeRecord(benchmark::State& state)
+{
+    int iteration = 0;
+
+    {
+        CsvFile file("CsvFile_writeRecord.csv");
+
+        for (auto _ : state)
+        {
+            ++iteration;
+            file.writeRecord(iteration, iteration * 0.123456789, iteration * 0.123456789 * 2, iteration * 0.123456789 * 3);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    std::remove("CsvFile_writeRecord.csv");
+}
+
+BENCHMARK(CsvFile_writeRecord);
+
+/* ************************************************************************ */
+
+static void CsvFile_writeRecordShortest(benchmark::State& state)
+{
+    int iteration = 0;
+
+    {
+        CsvFile file("CsvFile_writeRecordShortest.csv");
+        file.setRealFormat(CsvFile::RealFormat::Shortest);
+
+        for (auto _ : state)
+        {
+            ++iteration;
+            file.writeRecord(iteration, iteration * 0.123456789, iteration * 0.123456789 * 2, iteration * 0.123456789 * 3);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    std::remove("CsvFile_writeRecordShortest.csv");
+}
+
+BENCHMARK(CsvFile_writeRecordShortest);
+
+/* ************************************************************************ */
+
+static void DataExportCsv_writeRecord(benchmark::State& state)
+{
+    int iteration = 0;
+
+    {
+        DataExportCsv file("DataExportCsv_writeRecord");
+
+        for (auto _ : state)
+        {
+            ++iteration;
+            file.writeRecord(iteration, iteration * 0.123456789, iteration * 0.123456789 * 2, iteration * 0.123456789 * 3);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    std::remove("DataExportCsv_writeRecord.csv");
+}
+
+BENCHMARK(DataExportCsv_writeRecord);
+
+/* ************************************************************************ */
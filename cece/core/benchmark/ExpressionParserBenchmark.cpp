@@ -0,0 +1,71 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Parameters.hpp"
+#include "cece/core/ExpressionParser.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+static void ExpressionParser_constant(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(parseExpression("(1 + 2) * 3.5 - 4 / 8"));
+}
+
+BENCHMARK(ExpressionParser_constant);
+
+/* ************************************************************************ */
+
+static void ExpressionParser_functions(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(parseExpression("sin(pi / 4) + 2^8 * ln(e) + sqrt(16)"));
+}
+
+BENCHMARK(ExpressionParser_functions);
+
+/* ************************************************************************ */
+
+static void ExpressionParser_variables(benchmark::State& state)
+{
+    const Parameters parameters{{
+        {"v1", "5.0"}, {"v2", "2"}, {"v3", "-3"}
+    }};
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(parseExpression("v1 * v2 + v3 * (v1 - v2)", parameters));
+}
+
+BENCHMARK(ExpressionParser_variables);
+
+/* ************************************************************************ */
@@ -0,0 +1,208 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cmath>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/FastMath.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+constexpr unsigned int SIZE = 10000;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Concentrations in range (0, 10].
+ */
+DynamicArray<RealType> createValues()
+{
+    DynamicArray<RealType> values(SIZE);
+
+    for (unsigned int i = 0; i < SIZE; ++i)
+        values[i] = RealType(10) * (i + 1) / SIZE;
+
+    return values;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Run array function.
+ */
+template<typename Fn>
+void run(benchmark::State& state, Fn fn)
+{
+    const auto in = createValues();
+    DynamicArray<RealType> out(SIZE);
+
+    for (auto _ : state)
+    {
+        fn(in.data(), out.data(), SIZE);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * SIZE);
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void FastMath_expStd(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = std::exp(in[i]);
+    });
+}
+
+BENCHMARK(FastMath_expStd);
+
+/* ************************************************************************ */
+
+static void FastMath_expFast(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        math::exp(in, out, count, math::Accuracy::Fast);
+    });
+}
+
+BENCHMARK(FastMath_expFast);
+
+/* ************************************************************************ */
+
+static void FastMath_expPrecise(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        math::exp(in, out, count, math::Accuracy::Precise);
+    });
+}
+
+BENCHMARK(FastMath_expPrecise);
+
+/* ************************************************************************ */
+
+static void FastMath_logStd(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = std::log(in[i]);
+    });
+}
+
+BENCHMARK(FastMath_logStd);
+
+/* ************************************************************************ */
+
+static void FastMath_logPrecise(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        math::log(in, out, count, math::Accuracy::Precise);
+    });
+}
+
+BENCHMARK(FastMath_logPrecise);
+
+/* ************************************************************************ */
+
+static void FastMath_powStd(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i)
+            out[i] = std::pow(in[i], RealType(2.5));
+    });
+}
+
+BENCHMARK(FastMath_powStd);
+
+/* ************************************************************************ */
+
+static void FastMath_powPrecise(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        math::pow(in, RealType(2.5), out, count, math::Accuracy::Precise);
+    });
+}
+
+BENCHMARK(FastMath_powPrecise);
+
+/* ************************************************************************ */
+
+static void FastMath_hillStd(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        const RealType kn = std::pow(RealType(2), RealType(2.5));
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const RealType xn = std::pow(in[i], RealType(2.5));
+            out[i] = xn / (kn + xn);
+        }
+    });
+}
+
+BENCHMARK(FastMath_hillStd);
+
+/* ************************************************************************ */
+
+static void FastMath_hillFast(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        math::hill(in, RealType(2), RealType(2.5), out, count, math::Accuracy::Fast);
+    });
+}
+
+BENCHMARK(FastMath_hillFast);
+
+/* ************************************************************************ */
+
+static void FastMath_hillPrecise(benchmark::State& state)
+{
+    run(state, [](const RealType* in, RealType* out, std::size_t count) {
+        math::hill(in, RealType(2), RealType(2.5), out, count, math::Accuracy::Precise);
+    });
+}
+
+BENCHMARK(FastMath_hillPrecise);
+
+/* ************************************************************************ */
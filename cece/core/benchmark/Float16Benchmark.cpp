@@ -0,0 +1,124 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Grid.hpp"
+#include "cece/core/Float16.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+constexpr unsigned int SIZE = 2048;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Decay sweep: each row is loaded into RealType, updated and stored
+ * back into the storage type.
+ */
+template<typename T>
+void sweep(benchmark::State& state)
+{
+    Grid<T> grid(Vector<unsigned int>{SIZE, SIZE});
+    DynamicArray<RealType> row(SIZE);
+
+    for (auto& value : grid)
+        value = T(1.0f);
+
+    for (auto _ : state)
+    {
+        for (unsigned int y = 0; y < SIZE; ++y)
+        {
+            T* data = grid.getContainer().data() + y * SIZE;
+            convertValues(data, row.data(), SIZE);
+
+            for (auto& value : row)
+                value = value * RealType(0.99) + RealType(0.01);
+
+            convertValues(row.data(), data, SIZE);
+        }
+
+        benchmark::DoNotOptimize(grid.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["bytes"] = grid.getContainer().size() * sizeof(T);
+    state.SetBytesProcessed(state.iterations() * grid.getContainer().size() * sizeof(T) * 2);
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void Float16_sweepDouble(benchmark::State& state)
+{
+    sweep<double>(state);
+}
+
+BENCHMARK(Float16_sweepDouble);
+
+/* ************************************************************************ */
+
+static void Float16_sweepFloat(benchmark::State& state)
+{
+    sweep<float>(state);
+}
+
+BENCHMARK(Float16_sweepFloat);
+
+/* ************************************************************************ */
+
+static void Float16_sweepHalf(benchmark::State& state)
+{
+    sweep<Half>(state);
+}
+
+BENCHMARK(Float16_sweepHalf);
+
+/* ************************************************************************ */
+
+static void Float16_sweepBFloat16(benchmark::State& state)
+{
+    sweep<BFloat16>(state);
+}
+
+BENCHMARK(Float16_sweepBFloat16);
+
+/* ************************************************************************ */
@@ -0,0 +1,100 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/Grid.hpp"
+#include "cece/core/GridAlgorithm.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+static void GridAlgorithm_sumSerial(benchmark::State& state)
+{
+    const auto size = static_cast<unsigned int>(state.range(0));
+    Grid<RealType> grid;
+    grid.resize(Vector<unsigned int>{size, size}, 1);
+
+    for (auto _ : state)
+    {
+        RealType sum = 0;
+
+        for (auto value : grid)
+            sum += value;
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetBytesProcessed(state.iterations() * size * size * sizeof(RealType));
+}
+
+BENCHMARK(GridAlgorithm_sumSerial)->Arg(512)->Arg(2048);
+
+/* ************************************************************************ */
+
+static void GridAlgorithm_sumParallel(benchmark::State& state)
+{
+    const auto size = static_cast<unsigned int>(state.range(0));
+    Grid<RealType> grid;
+    grid.resize(Vector<unsigned int>{size, size}, 1);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(parallel::reduceSum(grid));
+
+    state.counters["threads"] = ThreadPool::getDefault().getThreadCount();
+    state.SetBytesProcessed(state.iterations() * size * size * sizeof(RealType));
+}
+
+BENCHMARK(GridAlgorithm_sumParallel)->Arg(512)->Arg(2048);
+
+/* ************************************************************************ */
+
+static void GridAlgorithm_zipTransform(benchmark::State& state)
+{
+    const auto size = static_cast<unsigned int>(state.range(0));
+    Grid<RealType> a, b, out;
+    a.resize(Vector<unsigned int>{size, size}, 1);
+    b.resize(Vector<unsigned int>{size, size}, 2);
+
+    for (auto _ : state)
+    {
+        parallel::zipTransform(a, b, out, [] (RealType x, RealType y) { return x * y + x; });
+        benchmark::DoNotOptimize(out.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * size * size * 3 * sizeof(RealType));
+}
+
+BENCHMARK(GridAlgorithm_zipTransform)->Arg(512)->Arg(2048);
+
+/* ************************************************************************ */
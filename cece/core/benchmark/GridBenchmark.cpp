@@ -0,0 +1,273 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/VectorRange.hpp"
+#include "cece/core/Grid.hpp"
+#include "cece/core/GridLayout.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+static void Grid_linear(benchmark::State& state)
+{
+    const auto size = static_cast<Grid<RealType>::SizeType>(state.range(0));
+    Grid<RealType> grid(Vector<Grid<RealType>::SizeType>{size, size});
+
+    for (auto _ : state)
+    {
+        for (auto& value : grid)
+            value += 1;
+
+        benchmark::DoNotOptimize(grid.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+BENCHMARK(Grid_linear)->Arg(64)->Arg(512)->Arg(2048);
+
+/* ************************************************************************ */
+
+static void Grid_coordinates(benchmark::State& state)
+{
+    const auto size = static_cast<Grid<RealType>::SizeType>(state.range(0));
+    Grid<RealType> grid(Vector<Grid<RealType>::SizeType>{size, size});
+
+    for (auto _ : state)
+    {
+        for (auto&& c : range(grid.getSize()))
+            grid[c] += 1;
+
+        benchmark::DoNotOptimize(grid.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+
+BENCHMARK(Grid_coordinates)->Arg(64)->Arg(512)->Arg(2048);
+
+/* ************************************************************************ */
+
+static void Grid_neighbours(benchmark::State& state)
+{
+    using SizeType = Grid<RealType>::SizeType;
+
+    const auto size = static_cast<SizeType>(state.range(0));
+    Grid<RealType> grid(Vector<SizeType>{size, size});
+    Grid<RealType> result(grid.getSize());
+
+    for (auto _ : state)
+    {
+        for (SizeType y = 1; y < size - 1; ++y)
+        {
+            for (SizeType x = 1; x < size - 1; ++x)
+            {
+                result[{x, y}] = RealType(0.25) * (
+                    grid[{x - 1, y}] + grid[{x + 1, y}] +
+                    grid[{x, y - 1}] + grid[{x, y + 1}]
+                );
+            }
+        }
+
+        benchmark::DoNotOptimize(result.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (size - 2) * (size - 2));
+}
+
+BENCHMARK(Grid_neighbours)->Arg(64)->Arg(512)->Arg(2048);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Five-point stencil visiting cells in storage order of the layout
+ * with neighbours addressed relatively to the cell offset.
+ */
+template<typename Layout>
+static void Grid_neighboursLayout(benchmark::State& state)
+{
+    using GridType = Grid<RealType, AlignedAllocator<RealType>, Layout>;
+    using SizeType = typename GridType::SizeType;
+    using CoordinateType = typename GridType::CoordinateType;
+
+    const auto size = static_cast<SizeType>(state.range(0));
+    GridType grid(Vector<SizeType>{size, size});
+    GridType result(grid.getSize());
+
+    const RealType* in = grid.getData();
+    RealType* out = result.getContainer().data();
+
+    for (auto _ : state)
+    {
+        grid.forEachOffset([&grid, in, out, size] (const CoordinateType& c, SizeType offset) {
+            if (c.getX() == 0 || c.getY() == 0 || c.getX() == size - 1 || c.getY() == size - 1)
+                return;
+
+            out[offset] = RealType(0.25) * (
+                in[grid.template calcNeighbourOffset<-1, 0>(c, offset)] +
+                in[grid.template calcNeighbourOffset<1, 0>(c, offset)] +
+                in[grid.template calcNeighbourOffset<0, -1>(c, offset)] +
+                in[grid.template calcNeighbourOffset<0, 1>(c, offset)]
+            );
+        });
+
+        benchmark::DoNotOptimize(out);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (size - 2) * (size - 2));
+}
+
+BENCHMARK_TEMPLATE(Grid_neighboursLayout, GridLayoutRowMajor)->Arg(64)->Arg(512)->Arg(2048)->Arg(4096);
+BENCHMARK_TEMPLATE(Grid_neighboursLayout, GridLayoutTiled<8>)->Arg(64)->Arg(512)->Arg(2048)->Arg(4096);
+BENCHMARK_TEMPLATE(Grid_neighboursLayout, GridLayoutTiled<32>)->Arg(64)->Arg(512)->Arg(2048)->Arg(4096);
+BENCHMARK_TEMPLATE(Grid_neighboursLayout, GridLayoutMorton<>)->Arg(64)->Arg(512)->Arg(2048)->Arg(4096);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Column by column sweep, e.g. vertical pass of separable filter or
+ * ADI solver. Row-major layout touches a new cache line for each cell.
+ */
+template<typename Layout>
+static void Grid_columnSweep(benchmark::State& state)
+{
+    using GridType = Grid<RealType, AlignedAllocator<RealType>, Layout>;
+    using SizeType = typename GridType::SizeType;
+
+    const auto size = static_cast<SizeType>(state.range(0));
+    GridType grid(Vector<SizeType>{size, size});
+
+    for (auto _ : state)
+    {
+        for (SizeType x = 0; x < size; ++x)
+            for (SizeType y = 1; y < size; ++y)
+                grid[{x, y}] += RealType(0.5) * grid[{x, y - 1}];
+
+        benchmark::DoNotOptimize(grid.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * (size - 1));
+}
+
+BENCHMARK_TEMPLATE(Grid_columnSweep, GridLayoutRowMajor)->Arg(512)->Arg(2048)->Arg(4096);
+BENCHMARK_TEMPLATE(Grid_columnSweep, GridLayoutTiled<8>)->Arg(512)->Arg(2048)->Arg(4096);
+BENCHMARK_TEMPLATE(Grid_columnSweep, GridLayoutMorton<>)->Arg(512)->Arg(2048)->Arg(4096);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Seven-point 3D stencil visiting cells in storage order of the
+ * layout with neighbours addressed relatively to the cell offset.
+ */
+template<typename Layout>
+static void Grid_neighbours3(benchmark::State& state)
+{
+    using GridType = Grid<RealType, AlignedAllocator<RealType>, Layout>;
+    using SizeType = typename GridType::SizeType;
+    using CoordinateType = typename GridType::CoordinateType;
+
+    const auto size = static_cast<SizeType>(state.range(0));
+    GridType grid(CoordinateType{size, size, size});
+    GridType result(grid.getSize());
+
+    const RealType* in = grid.getData();
+    RealType* out = result.getContainer().data();
+
+    for (auto _ : state)
+    {
+        grid.forEachOffset([&grid, in, out, size] (const CoordinateType& c, SizeType offset) {
+            if (c.getX() == 0 || c.getY() == 0 || c.getZ() == 0 ||
+                c.getX() == size - 1 || c.getY() == size - 1 || c.getZ() == size - 1)
+                return;
+
+            out[offset] = RealType(1.0 / 6) * (
+                in[grid.template calcNeighbourOffset<-1, 0, 0>(c, offset)] +
+                in[grid.template calcNeighbourOffset<1, 0, 0>(c, offset)] +
+                in[grid.template calcNeighbourOffset<0, -1, 0>(c, offset)] +
+                in[grid.template calcNeighbourOffset<0, 1, 0>(c, offset)] +
+                in[grid.template calcNeighbourOffset<0, 0, -1>(c, offset)] +
+                in[grid.template calcNeighbourOffset<0, 0, 1>(c, offset)]
+            );
+        });
+
+        benchmark::DoNotOptimize(out);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (size - 2) * (size - 2) * (size - 2));
+}
+
+BENCHMARK_TEMPLATE(Grid_neighbours3, GridLayoutRowMajor3)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(Grid_neighbours3, GridLayoutBlocked3<4>)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(Grid_neighbours3, GridLayoutBlocked3<8>)->Arg(64)->Arg(256);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Sweep across slices, e.g. z pass of ADI solver.
+ */
+template<typename Layout>
+static void Grid_depthSweep3(benchmark::State& state)
+{
+    using GridType = Grid<RealType, AlignedAllocator<RealType>, Layout>;
+    using SizeType = typename GridType::SizeType;
+    using CoordinateType = typename GridType::CoordinateType;
+
+    const auto size = static_cast<SizeType>(state.range(0));
+    GridType grid(CoordinateType{size, size, size});
+
+    for (auto _ : state)
+    {
+        for (SizeType y = 0; y < size; ++y)
+            for (SizeType x = 0; x < size; ++x)
+                for (SizeType z = 1; z < size; ++z)
+                    grid[{x, y, z}] += RealType(0.5) * grid[{x, y, z - 1}];
+
+        benchmark::DoNotOptimize(grid.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size * (size - 1));
+}
+
+BENCHMARK_TEMPLATE(Grid_depthSweep3, GridLayoutRowMajor3)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(Grid_depthSweep3, GridLayoutBlocked3<4>)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(Grid_depthSweep3, GridLayoutBlocked3<8>)->Arg(64)->Arg(256);
+
+/* ************************************************************************ */
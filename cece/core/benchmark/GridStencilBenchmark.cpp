@@ -0,0 +1,127 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/Grid.hpp"
+#include "cece/core/GridStencil.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Naive stencil loop with boundary check in every cell.
+ */
+static void GridStencil_naive(benchmark::State& state)
+{
+    const auto size = static_cast<unsigned int>(state.range(0));
+    RealGrid in;
+    in.resize(Vector<unsigned int>{size, size}, 1);
+    RealGrid out(Vector<unsigned int>{size, size});
+
+    for (auto _ : state)
+    {
+        for (unsigned int y = 0; y < size; ++y)
+        {
+            for (unsigned int x = 0; x < size; ++x)
+            {
+                const unsigned int xl = x > 0 ? x - 1 : x;
+                const unsigned int xr = x + 1 < size ? x + 1 : x;
+                const unsigned int yt = y > 0 ? y - 1 : y;
+                const unsigned int yb = y + 1 < size ? y + 1 : y;
+
+                out[Vector<unsigned int>(x, y)] =
+                    in[Vector<unsigned int>(xl, y)] + in[Vector<unsigned int>(xr, y)] +
+                    in[Vector<unsigned int>(x, yt)] + in[Vector<unsigned int>(x, yb)] -
+                    4 * in[Vector<unsigned int>(x, y)];
+            }
+        }
+
+        benchmark::DoNotOptimize(out.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size * size);
+    state.SetBytesProcessed(state.iterations() * size * size * 2 * sizeof(StorageRealType));
+}
+
+BENCHMARK(GridStencil_naive)->Arg(256)->Arg(2048);
+
+/* ************************************************************************ */
+
+static void GridStencil_laplacian5(benchmark::State& state)
+{
+    const auto size = static_cast<unsigned int>(state.range(0));
+    RealGrid in;
+    in.resize(Vector<unsigned int>{size, size}, 1);
+    RealGrid out(Vector<unsigned int>{size, size});
+    const auto stencil = Stencil::makeLaplacian5();
+
+    for (auto _ : state)
+    {
+        applyStencil(in, out, stencil, StencilBoundary::Clamp);
+        benchmark::DoNotOptimize(out.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetLabel(getStencilIsa());
+    state.SetItemsProcessed(state.iterations() * size * size);
+    state.SetBytesProcessed(state.iterations() * size * size * 2 * sizeof(StorageRealType));
+}
+
+BENCHMARK(GridStencil_laplacian5)->Arg(256)->Arg(2048);
+
+/* ************************************************************************ */
+
+static void GridStencil_laplacian9(benchmark::State& state)
+{
+    const auto size = static_cast<unsigned int>(state.range(0));
+    RealGrid in;
+    in.resize(Vector<unsigned int>{size, size}, 1);
+    RealGrid out(Vector<unsigned int>{size, size});
+    const auto stencil = Stencil::makeLaplacian9();
+
+    for (auto _ : state)
+    {
+        applyStencil(in, out, stencil, StencilBoundary::Periodic);
+        benchmark::DoNotOptimize(out.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetLabel(getStencilIsa());
+    state.SetItemsProcessed(state.iterations() * size * size);
+    state.SetBytesProcessed(state.iterations() * size * size * 2 * sizeof(StorageRealType));
+}
+
+BENCHMARK(GridStencil_laplacian9)->Arg(256)->Arg(2048);
+
+/* ************************************************************************ */
@@ -0,0 +1,124 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cmath>
+#include <random>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/ParticleSolver.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Area per particle, particles of radius one cover most of the area.
+constexpr RealType AREA_PER_PARTICLE = 5;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Create solver with randomly placed particles.
+ */
+ParticleSolver createSolver(std::size_t count)
+{
+    const RealType side = std::sqrt(AREA_PER_PARTICLE * count);
+
+    ParticleSolver solver;
+    solver.setStiffness(1);
+    solver.setViscosity(0.01);
+    solver.resize(count);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<RealType> position(0, side);
+    std::uniform_real_distribution<RealType> radius(0.8, 1.2);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        solver.getPositions().set(i, {position(gen), position(gen)});
+        solver.getRadii()[i] = radius(gen);
+        solver.getInverseMasses()[i] = 1;
+    }
+
+    return solver;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Contact forces of dense random particles.
+ */
+static void ParticleSolverContactForces(benchmark::State& state)
+{
+    auto solver = createSolver(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        solver.computeContactForces();
+        benchmark::DoNotOptimize(solver.getForces().getComponent(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["pairs"] = static_cast<double>(solver.getPairCount());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ParticleSolverContactForces)->Arg(1000)->Arg(10000)->Arg(100000);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Single solver step of dense random particles.
+ */
+static void ParticleSolverStep(benchmark::State& state)
+{
+    auto solver = createSolver(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        solver.step(0.1);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ParticleSolverStep)->Arg(1000)->Arg(10000)->Arg(100000);
+
+/* ************************************************************************ */
@@ -0,0 +1,101 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/String.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/UniquePtr.hpp"
+#include "cece/core/PtrNamedContainer.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+struct Item
+{
+    int value;
+};
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void PtrNamedContainer_get(benchmark::State& state)
+{
+    const auto count = state.range(0);
+
+    PtrNamedContainer<Item> container;
+    DynamicArray<String> names;
+
+    for (int i = 0; i < count; ++i)
+    {
+        names.push_back("module-" + toString(i));
+        container.add(names.back(), makeUnique<Item>(Item{i}));
+    }
+
+    std::size_t i = 0;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(container.get(names[i]));
+        i = (i + 1) % names.size();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(PtrNamedContainer_get)->Arg(4)->Arg(16)->Arg(64);
+
+/* ************************************************************************ */
+
+static void PtrNamedContainer_getMissing(benchmark::State& state)
+{
+    const auto count = state.range(0);
+
+    PtrNamedContainer<Item> container;
+
+    for (int i = 0; i < count; ++i)
+        container.add("module-" + toString(i), makeUnique<Item>(Item{i}));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(container.get("missing"));
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(PtrNamedContainer_getMissing)->Arg(4)->Arg(16)->Arg(64);
+
+/* ************************************************************************ */
@@ -0,0 +1,88 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/ShapeToGrid.hpp"
+#include "cece/core/ShapeFootprint.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Rasterize moving circle every step.
+ */
+static void ShapeFootprint_rasterize(benchmark::State& state)
+{
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    const Vector<unsigned int> size{1024, 1024};
+    const auto shape = Shape::makeCircle(units::um(state.range(0) * 0.5));
+    DynamicArray<GridSpan> spans;
+    unsigned int step = 0;
+
+    for (auto _ : state)
+    {
+        spans.clear();
+
+        // Moves one cell every 4 steps
+        mapShapeSpansToGrid([&spans] (unsigned int y, unsigned int begin, unsigned int end) {
+            spans.push_back(GridSpan{y, begin, end});
+        }, shape, steps, Vector<unsigned int>{256 + (++step / 4) % 512, 512}, Zero, size);
+
+        benchmark::DoNotOptimize(spans.data());
+    }
+}
+
+BENCHMARK(ShapeFootprint_rasterize)->Arg(16)->Arg(128);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Update footprint of moving circle every step.
+ */
+static void ShapeFootprint_update(benchmark::State& state)
+{
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    const Vector<unsigned int> size{1024, 1024};
+    const DynamicArray<Shape> shapes{Shape::makeCircle(units::um(state.range(0) * 0.5))};
+    ShapeFootprint footprint;
+    unsigned int step = 0;
+
+    for (auto _ : state)
+    {
+        footprint.update(shapes, 0, steps, Vector<unsigned int>{256 + (++step / 4) % 512, 512}, Zero, size);
+        benchmark::DoNotOptimize(footprint.getSpans().data());
+    }
+}
+
+BENCHMARK(ShapeFootprint_update)->Arg(16)->Arg(128);
+
+/* ************************************************************************ */
@@ -0,0 +1,182 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Units.hpp"
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Real.hpp"
+#include "cece/core/Grid.hpp"
+#include "cece/core/Shape.hpp"
+#include "cece/core/ShapeToGrid.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map shape into 512x512 grid with 1um steps, shape is in the grid
+ * center and the shape size is given by benchmark argument in micrometers.
+ *
+ * @param state
+ * @param shape
+ */
+void mapShape(benchmark::State& state, const Shape& shape)
+{
+    using CoordinateType = Vector<unsigned int>;
+
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    const CoordinateType max{512, 512};
+    const CoordinateType center{256, 256};
+
+    DynamicArray<CoordinateType> coords;
+    coords.reserve(512 * 512);
+
+    for (auto _ : state)
+    {
+        coords.clear();
+
+        mapShapeToGrid(
+            [&coords] (CoordinateType&& coord) { coords.push_back(coord); },
+            [] (CoordinateType&&) {},
+            shape, steps, center, units::deg(30), max
+        );
+
+        benchmark::DoNotOptimize(coords.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * coords.size());
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void ShapeToGrid_circle(benchmark::State& state)
+{
+    mapShape(state, Shape::makeCircle(units::um(state.range(0) * 0.5)));
+}
+
+BENCHMARK(ShapeToGrid_circle)->Arg(8)->Arg(64)->Arg(256);
+
+/* ************************************************************************ */
+
+static void ShapeToGrid_rectangle(benchmark::State& state)
+{
+    const auto size = units::um(state.range(0));
+    mapShape(state, Shape::makeRectangle({size, size}));
+}
+
+BENCHMARK(ShapeToGrid_rectangle)->Arg(8)->Arg(64)->Arg(256);
+
+/* ************************************************************************ */
+
+static void ShapeToGrid_edges(benchmark::State& state)
+{
+    const auto half = units::um(state.range(0) * 0.5);
+
+    mapShape(state, Shape::makeEdges({
+        {-half, -half},
+        { half, -half},
+        { half,  half},
+        {Zero,  half * 1.5},
+        {-half,  half}
+    }));
+}
+
+BENCHMARK(ShapeToGrid_edges)->Arg(8)->Arg(64)->Arg(256);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Add value to grid cells under circle, cell by cell.
+ */
+static void ShapeToGrid_stampCells(benchmark::State& state)
+{
+    using CoordinateType = Vector<unsigned int>;
+
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    const auto shape = Shape::makeCircle(units::um(state.range(0) * 0.5));
+    Grid<RealType> grid(CoordinateType{512, 512});
+
+    for (auto _ : state)
+    {
+        mapShapeToGrid(
+            [&grid] (CoordinateType&& coord) { grid[coord] += 1; },
+            [] (CoordinateType&&) {},
+            shape, steps, CoordinateType{256, 256}, units::deg(30), grid.getSize()
+        );
+
+        benchmark::DoNotOptimize(grid.getData());
+    }
+}
+
+BENCHMARK(ShapeToGrid_stampCells)->Arg(8)->Arg(64)->Arg(256);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Add value to grid cells under circle, span by span.
+ */
+static void ShapeToGrid_stampSpans(benchmark::State& state)
+{
+    using CoordinateType = Vector<unsigned int>;
+
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    const auto shape = Shape::makeCircle(units::um(state.range(0) * 0.5));
+    Grid<RealType> grid(CoordinateType{512, 512});
+
+    for (auto _ : state)
+    {
+        mapShapeSpansToGrid(
+            [&grid] (unsigned int y, unsigned int begin, unsigned int end) {
+                RealType* row = &grid[CoordinateType{0, y}];
+
+                for (auto x = begin; x < end; ++x)
+                    row[x] += 1;
+            },
+            shape, steps, CoordinateType{256, 256}, units::deg(30), grid.getSize()
+        );
+
+        benchmark::DoNotOptimize(grid.getData());
+    }
+}
+
+BENCHMARK(ShapeToGrid_stampSpans)->Arg(8)->Arg(64)->Arg(256);
+
+/* ************************************************************************ */
@@ -0,0 +1,125 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/Grid.hpp"
+#include "cece/core/SparseGrid.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+constexpr unsigned int SIZE = 2048;
+
+/* ************************************************************************ */
+
+/**
+ * @brief If cell is inside of the channel (diagonal band, ~10 % of area).
+ */
+bool isChannel(unsigned int x, unsigned int y) noexcept
+{
+    const int d = static_cast<int>(x) - static_cast<int>(y);
+    return d >= 0 && d < static_cast<int>(SIZE / 10);
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void SparseGrid_denseSweep(benchmark::State& state)
+{
+    Grid<RealType> grid(Vector<unsigned int>{SIZE, SIZE});
+
+    for (auto _ : state)
+    {
+        for (auto& value : grid)
+            value = value * RealType(0.5) + 1;
+
+        benchmark::DoNotOptimize(grid.getData());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["bytes"] = grid.getContainer().size() * sizeof(RealType);
+}
+
+BENCHMARK(SparseGrid_denseSweep);
+
+/* ************************************************************************ */
+
+static void SparseGrid_sparseSweep(benchmark::State& state)
+{
+    SparseGrid<RealType> grid(Vector<unsigned int>{SIZE, SIZE});
+
+    for (unsigned int y = 0; y < SIZE; ++y)
+        for (unsigned int x = 0; x < SIZE; ++x)
+            if (isChannel(x, y))
+                grid[{x, y}] = 0;
+
+    for (auto _ : state)
+    {
+        grid.forEach([] (const Vector<unsigned int>&, RealType& value) {
+            value = value * RealType(0.5) + 1;
+        });
+
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["bytes"] = grid.getMemorySize();
+    state.counters["blocks"] = grid.getBlockCount();
+}
+
+BENCHMARK(SparseGrid_sparseSweep);
+
+/* ************************************************************************ */
+
+static void SparseGrid_randomAccess(benchmark::State& state)
+{
+    SparseGrid<RealType> grid(Vector<unsigned int>{SIZE, SIZE});
+    unsigned int seed = 1;
+
+    for (auto _ : state)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const unsigned int x = (seed >> 8) % SIZE;
+        benchmark::DoNotOptimize(grid.get({x, x}));
+    }
+}
+
+BENCHMARK(SparseGrid_randomAccess);
+
+/* ************************************************************************ */
@@ -0,0 +1,169 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/Units.hpp"
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/VectorArray.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Number of vectors processed in one iteration.
+constexpr int COUNT = 10000;
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void VectorArray_integrateAos(benchmark::State& state)
+{
+    DynamicArray<units::PositionVector> position(COUNT, units::PositionVector{units::um(1), units::um(2)});
+    DynamicArray<units::VelocityVector> velocity(COUNT, units::VelocityVector{units::um_s(3), units::um_s(4)});
+    const auto dt = units::ms(1);
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < COUNT; ++i)
+            position[i] += velocity[i] * dt;
+
+        benchmark::DoNotOptimize(position.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(VectorArray_integrateAos);
+
+/* ************************************************************************ */
+
+static void VectorArray_integrateSoa(benchmark::State& state)
+{
+    VectorArray<units::Length> position(COUNT, {units::um(1), units::um(2)});
+    VectorArray<units::Velocity> velocity(COUNT, {units::um_s(3), units::um_s(4)});
+    const auto dt = units::ms(1);
+
+    for (auto _ : state)
+    {
+        position.addScaled(velocity, dt);
+
+        benchmark::DoNotOptimize(position.getComponent(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(VectorArray_integrateSoa);
+
+/* ************************************************************************ */
+
+static void VectorArray_normalizeAos(benchmark::State& state)
+{
+    DynamicArray<Vector<RealType>> in(COUNT);
+    DynamicArray<Vector<RealType>> out(COUNT);
+
+    for (int i = 0; i < COUNT; ++i)
+        in[i] = {RealType(i + 1), RealType(COUNT - i)};
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < COUNT; ++i)
+            out[i] = in[i] / in[i].getLength();
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(VectorArray_normalizeAos);
+
+/* ************************************************************************ */
+
+static void VectorArray_normalizeSoa(benchmark::State& state)
+{
+    VectorArray<RealType> in(COUNT);
+    VectorArray<RealType> out;
+
+    for (int i = 0; i < COUNT; ++i)
+        in.set(i, {RealType(i + 1), RealType(COUNT - i)});
+
+    for (auto _ : state)
+    {
+        normalize(in, out);
+
+        benchmark::DoNotOptimize(out.getComponent(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(VectorArray_normalizeSoa);
+
+/* ************************************************************************ */
+
+static void VectorArray_gather(benchmark::State& state)
+{
+    VectorArray<RealType> in(COUNT, {1, 2});
+    VectorArray<RealType> out;
+    DynamicArray<unsigned int> indices(COUNT);
+
+    for (int i = 0; i < COUNT; ++i)
+        indices[i] = static_cast<unsigned int>((i * 7919) % COUNT);
+
+    for (auto _ : state)
+    {
+        out.gather(in, indices.data(), indices.size());
+
+        benchmark::DoNotOptimize(out.getComponent(0));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(VectorArray_gather);
+
+/* ************************************************************************ */
@@ -0,0 +1,139 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/Units.hpp"
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/DynamicArray.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Number of vectors processed in one iteration.
+constexpr int COUNT = 1024;
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void Vector_add(benchmark::State& state)
+{
+    DynamicArray<Vector<RealType>> a(COUNT, Vector<RealType>{1, 2});
+    DynamicArray<Vector<RealType>> b(COUNT, Vector<RealType>{3, 4});
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < COUNT; ++i)
+            a[i] += b[i];
+
+        benchmark::DoNotOptimize(a.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(Vector_add);
+
+/* ************************************************************************ */
+
+static void Vector_mulScalar(benchmark::State& state)
+{
+    DynamicArray<Vector<RealType>> a(COUNT, Vector<RealType>{1, 2});
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < COUNT; ++i)
+            a[i] = a[i] * RealType(0.5) + Vector<RealType>{1, 1};
+
+        benchmark::DoNotOptimize(a.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(Vector_mulScalar);
+
+/* ************************************************************************ */
+
+static void Vector_dotLength(benchmark::State& state)
+{
+    DynamicArray<Vector<RealType>> a(COUNT, Vector<RealType>{1, 2});
+    DynamicArray<Vector<RealType>> b(COUNT, Vector<RealType>{3, 4});
+
+    for (auto _ : state)
+    {
+        RealType sum = 0;
+
+        for (int i = 0; i < COUNT; ++i)
+            sum += a[i].dot(b[i]) + a[i].getLength();
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(Vector_dotLength);
+
+/* ************************************************************************ */
+
+static void Vector_units(benchmark::State& state)
+{
+    DynamicArray<units::PositionVector> positions(COUNT, units::PositionVector{units::um(1), units::um(2)});
+    const units::VelocityVector velocity{units::um_s(3), units::um_s(4)};
+    const auto dt = units::s(0.1);
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < COUNT; ++i)
+            positions[i] += velocity * dt;
+
+        benchmark::DoNotOptimize(positions.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+
+BENCHMARK(Vector_units);
+
+/* ************************************************************************ */
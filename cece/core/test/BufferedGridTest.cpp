@@ -0,0 +1,111 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/BufferedGrid.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+TEST(BufferedGrid, swap)
+{
+    DoubleBufferedGrid<int> grid(Vector<unsigned int>{10, 5});
+    EXPECT_EQ((Vector<unsigned int>{10, 5}), grid.getSize());
+    EXPECT_EQ((Vector<unsigned int>{10, 5}), grid.getBack().getSize());
+
+    grid.getFront()[{1, 1}] = 1;
+    grid.getBack()[{1, 1}] = 2;
+
+    const int* front = grid.getFront().getData();
+    const int* back = grid.getBack().getData();
+
+    grid.swap();
+
+    // No copy
+    EXPECT_EQ(back, grid.getFront().getData());
+    EXPECT_EQ(front, grid.getBack().getData());
+    EXPECT_EQ(2, (grid.getFront()[{1, 1}]));
+    EXPECT_EQ(1, (grid.getPrevious()[{1, 1}]));
+}
+
+/* ************************************************************************ */
+
+TEST(BufferedGrid, rotation)
+{
+    BufferedGrid<int, 3> grid(Vector<unsigned int>{4, 4});
+    EXPECT_EQ(3u, grid.getBufferCount());
+
+    for (int i = 0; i < 3; ++i)
+        grid.getBuffer(i)[{0, 0}] = i;
+
+    grid.swap();
+    EXPECT_EQ(1, (grid.getFront()[{0, 0}]));
+    EXPECT_EQ(2, (grid.getBack()[{0, 0}]));
+    EXPECT_EQ(0, (grid.getPrevious()[{0, 0}]));
+
+    grid.swap();
+    grid.swap();
+    EXPECT_EQ(0, (grid.getFront()[{0, 0}]));
+}
+
+/* ************************************************************************ */
+
+TEST(BufferedGrid, snapshot)
+{
+    DoubleBufferedGrid<int> grid;
+    grid.resize(Vector<unsigned int>{8, 8}, 0);
+
+    grid.getFront()[{2, 2}] = 5;
+
+    auto snapshot = grid.snapshot();
+    EXPECT_EQ(&grid.getFront(), snapshot.get());
+
+    // Solver writes next step while snapshot is held
+    grid.getBack()[{2, 2}] = 6;
+    grid.swap();
+
+    // Snapshot buffer is not reused as the back buffer
+    EXPECT_NE(snapshot.get(), &grid.getBack());
+    EXPECT_EQ(grid.getSize(), grid.getBack().getSize());
+
+    grid.getBack()[{2, 2}] = 7;
+    EXPECT_EQ(5, ((*snapshot)[{2, 2}]));
+    EXPECT_EQ(6, (grid.getFront()[{2, 2}]));
+
+    // Released snapshot buffers are reused
+    snapshot.reset();
+    const int* back = grid.getBack().getData();
+    grid.swap();
+    grid.swap();
+    EXPECT_EQ(back, grid.getBack().getData());
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,124 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cstdint>
+#include <random>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Compression.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+static void roundTrip(const DynamicArray<std::uint8_t>& data)
+{
+    DynamicArray<std::uint8_t> compressed;
+    compression::compress(data.data(), data.size(), compressed);
+    EXPECT_LE(compressed.size(), compression::compressBound(data.size()));
+
+    DynamicArray<std::uint8_t> result(data.size());
+    compression::decompress(compressed.data(), compressed.size(), result.data(), result.size());
+    EXPECT_EQ(data, result);
+}
+
+/* ************************************************************************ */
+
+TEST(CompressionTest, empty)
+{
+    roundTrip({});
+    roundTrip({1, 2, 3});
+}
+
+/* ************************************************************************ */
+
+TEST(CompressionTest, repeated)
+{
+    DynamicArray<std::uint8_t> data(100000, 42);
+
+    DynamicArray<std::uint8_t> compressed;
+    compression::compress(data.data(), data.size(), compressed);
+    EXPECT_LT(compressed.size(), data.size() / 100);
+
+    roundTrip(data);
+}
+
+/* ************************************************************************ */
+
+TEST(CompressionTest, random)
+{
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::uniform_int_distribution<int> small(0, 3);
+
+    DynamicArray<std::uint8_t> noise(65536);
+    DynamicArray<std::uint8_t> text(65536);
+
+    for (std::size_t i = 0; i < noise.size(); ++i)
+    {
+        noise[i] = static_cast<std::uint8_t>(dist(gen));
+        text[i] = static_cast<std::uint8_t>('a' + small(gen));
+    }
+
+    roundTrip(noise);
+    roundTrip(text);
+}
+
+/* ************************************************************************ */
+
+TEST(CompressionTest, shuffle)
+{
+    const DynamicArray<std::uint8_t> data{1, 2, 3, 4, 5, 6, 7, 8};
+    DynamicArray<std::uint8_t> shuffled(data.size());
+    DynamicArray<std::uint8_t> result(data.size());
+
+    compression::shuffle(data.data(), shuffled.data(), 4, 2);
+    EXPECT_EQ((DynamicArray<std::uint8_t>{1, 3, 5, 7, 2, 4, 6, 8}), shuffled);
+
+    compression::unshuffle(shuffled.data(), result.data(), 4, 2);
+    EXPECT_EQ(data, result);
+}
+
+/* ************************************************************************ */
+
+TEST(CompressionTest, corrupted)
+{
+    const DynamicArray<std::uint8_t> data(1000, 7);
+    DynamicArray<std::uint8_t> compressed;
+    compression::compress(data.data(), data.size(), compressed);
+
+    DynamicArray<std::uint8_t> result(data.size());
+    EXPECT_ANY_THROW(compression::decompress(compressed.data(), compressed.size() - 1, result.data(), result.size()));
+    EXPECT_ANY_THROW(compression::decompress(compressed.data(), compressed.size(), result.data(), result.size() - 1));
+}
+
+/* ************************************************************************ */
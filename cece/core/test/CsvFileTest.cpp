@@ -0,0 +1,148 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cstdio>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/String.hpp"
+#include "cece/core/CsvFile.hpp"
+#include "cece/core/DataExportCsv.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+static String readFile(const FilePath& path)
+{
+    InFileStream file(path.toString(), std::ios::binary);
+    return String(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+/* ************************************************************************ */
+
+TEST(CsvFileTest, write)
+{
+    const FilePath path = "CsvFileTest.write.csv";
+
+    {
+        CsvFile file(path);
+        file.writeHeader("iteration", "name", "value");
+        file.writeRecord(1, "first", 1.5);
+        file.writeRecord(-20l, String("second"), 0.1);
+        file.writeRecordArray({"a", "b", "c"});
+    }
+
+    EXPECT_EQ(
+        "iteration;name;value\r\n"
+        "1;first;1.5\r\n"
+        "-20;second;0.1\r\n"
+        "a;b;c\r\n",
+        readFile(path)
+    );
+
+    std::remove(path.toString().c_str());
+}
+
+/* ************************************************************************ */
+
+TEST(CsvFileTest, realFormat)
+{
+    const FilePath path = "CsvFileTest.realFormat.csv";
+
+    {
+        CsvFile file(path);
+        file.writeRecord(1.5, 0.1, 1e6, 1.0f / 3);
+
+        file.setRealFormat(CsvFile::RealFormat::Scientific);
+        file.writeRecord(1.5, 0.1, 1e6, 1.0f / 3);
+
+        file.setRealFormat(CsvFile::RealFormat::Shortest);
+        file.writeRecord(1.5, 0.1, 1e6, 1.0 / 3);
+    }
+
+    EXPECT_EQ(
+        "1.5;0.1;1e+06;0.333333\r\n"
+        "1.500000e+00;1.000000e-01;1.000000e+06;3.333333e-01\r\n"
+        "1.5e+00;1e-01;1e+06;3.333333333333333e-01\r\n",
+        readFile(path)
+    );
+
+    std::remove(path.toString().c_str());
+}
+
+/* ************************************************************************ */
+
+TEST(CsvFileTest, dataExport)
+{
+    {
+        DataExportCsv file("CsvFileTest.dataExport");
+        file.writeHeader("iteration", "value");
+        file.writeRecord(1, 1.5);
+        file.writeRecord(2, -0.125);
+    }
+
+    EXPECT_EQ(
+        "iteration;value\r\n"
+        "1;1.500000e+00\r\n"
+        "2;-1.250000e-01\r\n",
+        readFile("CsvFileTest.dataExport.csv")
+    );
+
+    std::remove("CsvFileTest.dataExport.csv");
+}
+
+/* ************************************************************************ */
+
+TEST(CsvFileTest, large)
+{
+    const FilePath path = "CsvFileTest.large.csv";
+    const String longValue(CsvFile::BUFFER_SIZE + 10, 'x');
+    String expected;
+
+    {
+        CsvFile file(path);
+
+        for (int i = 0; i < 100000; ++i)
+        {
+            file.writeRecord(i, i * 2u);
+            expected += std::to_string(i) + ";" + std::to_string(i * 2u) + "\r\n";
+        }
+
+        file.writeRecord(longValue);
+        expected += longValue + "\r\n";
+    }
+
+    EXPECT_EQ(expected, readFile(path));
+
+    std::remove(path.toString().c_str());
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,351 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/FastMath.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns maximum relative error of values.
+ */
+RealType maxRelativeError(const DynamicArray<RealType>& values, const DynamicArray<RealType>& expected)
+{
+    RealType error = 0;
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+        error = std::max(error, std::abs(values[i] - expected[i]) / std::abs(expected[i]));
+
+    return error;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Generate geometric sequence.
+ */
+DynamicArray<RealType> geometric(RealType first, RealType last, std::size_t count)
+{
+    DynamicArray<RealType> values(count);
+    const RealType step = std::pow(last / first, RealType(1) / (count - 1));
+
+    values[0] = first;
+
+    for (std::size_t i = 1; i < count; ++i)
+        values[i] = values[i - 1] * step;
+
+    return values;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Generate arithmetic sequence.
+ */
+DynamicArray<RealType> linear(RealType first, RealType last, std::size_t count)
+{
+    DynamicArray<RealType> values(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+        values[i] = first + (last - first) * i / (count - 1);
+
+    return values;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, exp)
+{
+    const auto in = linear(-700, 700, 100003);
+    DynamicArray<RealType> expected(in.size());
+    DynamicArray<RealType> fast(in.size());
+    DynamicArray<RealType> precise(in.size());
+    DynamicArray<RealType> exact(in.size());
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+        expected[i] = std::exp(in[i]);
+
+    math::exp(in.data(), fast.data(), in.size(), math::Accuracy::Fast);
+    math::exp(in.data(), precise.data(), in.size(), math::Accuracy::Precise);
+    math::exp(in.data(), exact.data(), in.size(), math::Accuracy::Exact);
+
+    EXPECT_LT(maxRelativeError(fast, expected), 1e-4);
+    EXPECT_LT(maxRelativeError(precise, expected), 1e-7);
+    EXPECT_EQ(expected, exact);
+
+    // Bulk and scalar versions use same approximation, FMA contraction can
+    // change last bits
+    for (std::size_t i = 0; i < in.size(); i += 97)
+    {
+        EXPECT_NEAR(math::exp<math::Accuracy::Fast>(in[i]), fast[i], 1e-14 * fast[i]);
+        EXPECT_NEAR(math::exp<math::Accuracy::Precise>(in[i]), precise[i], 1e-14 * precise[i]);
+    }
+
+    EXPECT_NEAR(1, math::exp(0.0), 1e-15);
+    EXPECT_NEAR(std::exp(1.0), math::exp(1.0), 1e-10);
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, expSpecial)
+{
+    constexpr RealType inf = std::numeric_limits<RealType>::infinity();
+    constexpr RealType nan = std::numeric_limits<RealType>::quiet_NaN();
+
+    const DynamicArray<RealType> in = {inf, -inf, nan, 710, 1000, -750, -1e10, 709.7};
+    DynamicArray<RealType> out(in.size());
+
+    for (auto accuracy : {math::Accuracy::Fast, math::Accuracy::Precise})
+    {
+        math::exp(in.data(), out.data(), in.size(), accuracy);
+
+        EXPECT_EQ(inf, out[0]);
+        EXPECT_EQ(0, out[1]);
+        EXPECT_TRUE(std::isnan(out[2]));
+        EXPECT_EQ(inf, out[3]);
+        EXPECT_EQ(inf, out[4]);
+        EXPECT_EQ(0, out[5]);
+        EXPECT_EQ(0, out[6]);
+        EXPECT_TRUE(std::isfinite(out[7]));
+        EXPECT_NEAR(std::exp(709.7), out[7], 1e-4 * out[7]);
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, log)
+{
+    auto in = geometric(1e-300, 1e300, 100003);
+
+    // Subnormals
+    in.push_back(std::numeric_limits<RealType>::denorm_min());
+    in.push_back(1e-310);
+    in.push_back(std::numeric_limits<RealType>::max());
+
+    DynamicArray<RealType> expected(in.size());
+    DynamicArray<RealType> fast(in.size());
+    DynamicArray<RealType> precise(in.size());
+    DynamicArray<RealType> exact(in.size());
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+        expected[i] = std::log(in[i]);
+
+    math::log(in.data(), fast.data(), in.size(), math::Accuracy::Fast);
+    math::log(in.data(), precise.data(), in.size(), math::Accuracy::Precise);
+    math::log(in.data(), exact.data(), in.size(), math::Accuracy::Exact);
+
+    EXPECT_LT(maxRelativeError(fast, expected), 1e-4);
+    EXPECT_LT(maxRelativeError(precise, expected), 1e-7);
+    EXPECT_EQ(expected, exact);
+
+    // Relative error near one, log is close to zero
+    for (RealType x = 0.5; x < 2; x += 0.001)
+    {
+        if (x == 1)
+            continue;
+
+        EXPECT_NEAR(std::log(x), math::log(x), 1e-7 * std::abs(std::log(x)));
+    }
+
+    EXPECT_EQ(0, math::log(1.0));
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, logSpecial)
+{
+    constexpr RealType inf = std::numeric_limits<RealType>::infinity();
+    constexpr RealType nan = std::numeric_limits<RealType>::quiet_NaN();
+
+    const DynamicArray<RealType> in = {inf, 0, -0.0, -1, -inf, nan};
+    DynamicArray<RealType> out(in.size());
+
+    for (auto accuracy : {math::Accuracy::Fast, math::Accuracy::Precise})
+    {
+        math::log(in.data(), out.data(), in.size(), accuracy);
+
+        EXPECT_EQ(inf, out[0]);
+        EXPECT_EQ(-inf, out[1]);
+        EXPECT_EQ(-inf, out[2]);
+        EXPECT_TRUE(std::isnan(out[3]));
+        EXPECT_TRUE(std::isnan(out[4]));
+        EXPECT_TRUE(std::isnan(out[5]));
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, rsqrt)
+{
+    const auto in = geometric(1e-150, 1e150, 100003);
+
+    DynamicArray<RealType> expected(in.size());
+    DynamicArray<RealType> fast(in.size());
+    DynamicArray<RealType> precise(in.size());
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        expected[i] = 1 / std::sqrt(in[i]);
+        fast[i] = math::rsqrtApprox<false>(in[i]);
+        precise[i] = math::rsqrtApprox<true>(in[i]);
+    }
+
+    EXPECT_LT(maxRelativeError(fast, expected), 1e-4);
+    EXPECT_LT(maxRelativeError(precise, expected), 1e-7);
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, pow)
+{
+    const auto in = geometric(1e-3, 1e3, 10007);
+    DynamicArray<RealType> expected(in.size());
+    DynamicArray<RealType> fast(in.size());
+    DynamicArray<RealType> precise(in.size());
+
+    for (RealType y : {-2.5, -1.0, 0.5, 1.0, 2.0, 3.7})
+    {
+        for (std::size_t i = 0; i < in.size(); ++i)
+            expected[i] = std::pow(in[i], y);
+
+        math::pow(in.data(), y, fast.data(), in.size(), math::Accuracy::Fast);
+        math::pow(in.data(), y, precise.data(), in.size(), math::Accuracy::Precise);
+
+        // Error of logarithm is multiplied by y * ln(x)
+        EXPECT_LT(maxRelativeError(fast, expected), 1e-3);
+        EXPECT_LT(maxRelativeError(precise, expected), 1e-7);
+    }
+
+    // x^0 is always 1
+    const DynamicArray<RealType> special = {0, 1, std::numeric_limits<RealType>::quiet_NaN()};
+    DynamicArray<RealType> out(special.size());
+    math::pow(special.data(), 0, out.data(), special.size());
+
+    EXPECT_EQ(DynamicArray<RealType>(special.size(), 1), out);
+
+    EXPECT_EQ(0, math::pow(0.0, 2.0));
+    EXPECT_EQ(1, math::pow(5.0, 0.0));
+    EXPECT_NEAR(8, math::pow(2.0, 3.0), 1e-14);
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, sigmoid)
+{
+    const auto in = linear(-30, 30, 10007);
+    DynamicArray<RealType> expected(in.size());
+    DynamicArray<RealType> fast(in.size());
+    DynamicArray<RealType> precise(in.size());
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+        expected[i] = 1 / (1 + std::exp(-in[i]));
+
+    math::sigmoid(in.data(), fast.data(), in.size(), math::Accuracy::Fast);
+    math::sigmoid(in.data(), precise.data(), in.size(), math::Accuracy::Precise);
+
+    EXPECT_LT(maxRelativeError(fast, expected), 1e-4);
+    EXPECT_LT(maxRelativeError(precise, expected), 1e-7);
+
+    EXPECT_EQ(0.5, math::sigmoid(0.0));
+    EXPECT_EQ(1, math::sigmoid(1000.0));
+    EXPECT_EQ(0, math::sigmoid(-1000.0));
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, hill)
+{
+    const auto in = geometric(1e-4, 1e4, 10007);
+    DynamicArray<RealType> expected(in.size());
+    DynamicArray<RealType> fast(in.size());
+    DynamicArray<RealType> precise(in.size());
+    DynamicArray<RealType> exact(in.size());
+
+    for (RealType n : {1.0, 2.0, 4.0})
+    {
+        const RealType k = 0.3;
+
+        for (std::size_t i = 0; i < in.size(); ++i)
+            expected[i] = std::pow(in[i], n) / (std::pow(k, n) + std::pow(in[i], n));
+
+        math::hill(in.data(), k, n, fast.data(), in.size(), math::Accuracy::Fast);
+        math::hill(in.data(), k, n, precise.data(), in.size(), math::Accuracy::Precise);
+        math::hill(in.data(), k, n, exact.data(), in.size(), math::Accuracy::Exact);
+
+        EXPECT_LT(maxRelativeError(fast, expected), 1e-3);
+        EXPECT_LT(maxRelativeError(precise, expected), 1e-7);
+        EXPECT_LT(maxRelativeError(exact, expected), 1e-15);
+    }
+
+    EXPECT_EQ(0, math::hill(0.0, 1.0, 2.0));
+    EXPECT_NEAR(0.5, math::hill(2.0, 2.0, 3.0), 1e-15);
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, inPlace)
+{
+    const auto in = linear(-10, 10, 1001);
+    auto values = in;
+
+    math::exp(values.data(), values.data(), values.size());
+    math::log(values.data(), values.data(), values.size());
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+        EXPECT_NEAR(in[i], values[i], 1e-10);
+}
+
+/* ************************************************************************ */
+
+TEST(FastMath, isa)
+{
+    const std::string isa = math::getMathIsa();
+
+    EXPECT_TRUE(isa == "avx512f" || isa == "avx2" || isa == "default");
+}
+
+/* ************************************************************************ */
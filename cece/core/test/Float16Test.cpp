@@ -0,0 +1,249 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cmath>
+#include <limits>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Float16.hpp"
+#include "cece/core/Grid.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+TEST(Half, exact)
+{
+    EXPECT_EQ(0x0000, Half(0.0f).getBits());
+    EXPECT_EQ(0x8000, Half(-0.0f).getBits());
+    EXPECT_EQ(0x3c00, Half(1.0f).getBits());
+    EXPECT_EQ(0xc000, Half(-2.0f).getBits());
+    EXPECT_EQ(0x7bff, Half(65504.0f).getBits());
+    EXPECT_EQ(0x0001, Half(std::ldexp(1.0f, -24)).getBits());
+    EXPECT_EQ(0x0400, Half(std::ldexp(1.0f, -14)).getBits());
+
+    // All finite values survive round-trip
+    for (unsigned int bits = 0; bits < 0x10000; ++bits)
+    {
+        if ((bits & 0x7c00) == 0x7c00)
+            continue;
+
+        const float value = Half::toFloat(static_cast<std::uint16_t>(bits));
+        EXPECT_EQ(bits, Half(value).getBits());
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(Half, rounding)
+{
+    // 1 + 2^-11 is halfway between 1 and next half, ties to even
+    EXPECT_EQ(0x3c00, Half(1.0f + std::ldexp(1.0f, -11)).getBits());
+    EXPECT_EQ(0x3c02, Half(1.0f + 3 * std::ldexp(1.0f, -11)).getBits());
+    EXPECT_EQ(0x3c01, Half(1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20)).getBits());
+
+    // Relative error is bounded by 2^-11
+    for (float value = 1e-3f; value < 6e4f; value *= 1.01f)
+        EXPECT_LE(std::abs(static_cast<float>(Half(value)) - value), value * std::ldexp(1.0f, -11));
+}
+
+/* ************************************************************************ */
+
+TEST(Half, special)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+
+    EXPECT_EQ(0x7c00, Half(inf).getBits());
+    EXPECT_EQ(0xfc00, Half(-inf).getBits());
+    EXPECT_EQ(0x7c00, Half(65520.0f).getBits());
+    EXPECT_EQ(0x7c00, Half(1e10f).getBits());
+    EXPECT_TRUE(std::isnan(static_cast<float>(Half(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_EQ(inf, static_cast<float>(Half::fromBits(0x7c00)));
+
+    // Underflow
+    EXPECT_EQ(0x0000, Half(std::ldexp(1.0f, -26)).getBits());
+    EXPECT_EQ(0x0001, Half(std::ldexp(1.5f, -25)).getBits());
+}
+
+/* ************************************************************************ */
+
+TEST(Half, conversionDouble)
+{
+    // Rounding through float would drop the sticky bit and round to even
+    const double above = 1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -40);
+    const double below = 1.0 + std::ldexp(1.0, -11) - std::ldexp(1.0, -40);
+
+    EXPECT_EQ(0x3c01, Half(above).getBits());
+    EXPECT_EQ(0x3c00, Half(below).getBits());
+    EXPECT_EQ(0x3c00, Half(1.0 + std::ldexp(1.0, -11)).getBits());
+    EXPECT_EQ(0x3f81, BFloat16(1.0 + std::ldexp(1.0, -8) + std::ldexp(1.0, -40)).getBits());
+    EXPECT_EQ(0x0001, Half(std::ldexp(1.0, -25) + std::ldexp(1.0, -60)).getBits());
+    EXPECT_EQ(0x7c00, Half(1e300).getBits());
+    EXPECT_EQ(0x8000, Half(-1e-300).getBits());
+    EXPECT_TRUE(std::isnan(static_cast<float>(Half(std::numeric_limits<double>::quiet_NaN()))));
+
+    // Bulk conversion matches scalar one
+    DynamicArray<double> values(19, above);
+    values[3] = below;
+    values[10] = -above;
+    values[18] = std::ldexp(1.0, -25) + std::ldexp(1.0, -60);
+
+    DynamicArray<Half> result(values.size());
+    convertValues(values.data(), result.data(), values.size());
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(Half(values[i]).getBits(), result[i].getBits());
+
+    DynamicArray<BFloat16> bresult(values.size());
+    convertValues(values.data(), bresult.data(), values.size());
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(BFloat16(values[i]).getBits(), bresult[i].getBits());
+}
+
+/* ************************************************************************ */
+
+TEST(BFloat16, conversion)
+{
+    EXPECT_EQ(0x3f80, BFloat16(1.0f).getBits());
+    EXPECT_EQ(0xc000, BFloat16(-2.0f).getBits());
+    EXPECT_EQ(1.0f, static_cast<float>(BFloat16(1.0f)));
+
+    // Ties to even
+    EXPECT_EQ(0x3f80, BFloat16(1.0f + std::ldexp(1.0f, -8)).getBits());
+    EXPECT_EQ(0x3f82, BFloat16(1.0f + 3 * std::ldexp(1.0f, -8)).getBits());
+
+    EXPECT_EQ(0x7f80, BFloat16(std::numeric_limits<float>::infinity()).getBits());
+    EXPECT_TRUE(std::isnan(static_cast<float>(BFloat16(std::numeric_limits<float>::quiet_NaN()))));
+
+    for (float value = 1e-30f; value < 1e30f; value *= 1.1f)
+        EXPECT_LE(std::abs(static_cast<float>(BFloat16(value)) - value), value * std::ldexp(1.0f, -8));
+}
+
+/* ************************************************************************ */
+
+TEST(Float16, convertValues)
+{
+    // Bulk conversions must match scalar ones
+    DynamicArray<Half> halfs;
+    DynamicArray<BFloat16> bfloats;
+
+    for (unsigned int bits = 0; bits < 0x10000; ++bits)
+    {
+        halfs.push_back(Half::fromBits(static_cast<std::uint16_t>(bits)));
+        bfloats.push_back(BFloat16::fromBits(static_cast<std::uint16_t>(bits)));
+    }
+
+    DynamicArray<float> floats(halfs.size());
+    DynamicArray<double> doubles(halfs.size());
+
+    convertValues(halfs.data(), floats.data(), halfs.size());
+    convertValues(halfs.data(), doubles.data(), halfs.size());
+
+    for (std::size_t i = 0; i < halfs.size(); ++i)
+    {
+        const float value = halfs[i];
+
+        if (std::isnan(value))
+        {
+            EXPECT_TRUE(std::isnan(floats[i]));
+            EXPECT_TRUE(std::isnan(doubles[i]));
+        }
+        else
+        {
+            EXPECT_EQ(value, floats[i]);
+            EXPECT_EQ(value, doubles[i]);
+        }
+    }
+
+    // Values between representable halfs, including ties
+    for (std::size_t i = 0; i < floats.size(); ++i)
+    {
+        if (!std::isnan(floats[i]))
+            floats[i] = std::nextafter(floats[i], 0.0f) * (i % 3 == 0 ? 1.0005f : 1.0f);
+    }
+
+    DynamicArray<Half> result(floats.size());
+    convertValues(floats.data(), result.data(), floats.size());
+
+    for (std::size_t i = 0; i < floats.size(); ++i)
+    {
+        if (std::isnan(floats[i]))
+            EXPECT_TRUE(std::isnan(static_cast<float>(result[i])));
+        else
+            EXPECT_EQ(Half(floats[i]).getBits(), result[i].getBits());
+    }
+
+    convertValues(bfloats.data(), floats.data(), bfloats.size());
+
+    for (std::size_t i = 0; i < bfloats.size(); ++i)
+    {
+        if (std::isnan(floats[i]))
+            continue;
+
+        EXPECT_EQ(static_cast<float>(bfloats[i]), floats[i]);
+        floats[i] *= 1.003f;
+    }
+
+    DynamicArray<BFloat16> bresult(floats.size());
+    convertValues(floats.data(), bresult.data(), floats.size());
+
+    for (std::size_t i = 0; i < floats.size(); ++i)
+        EXPECT_EQ(BFloat16(floats[i]).getBits(), bresult[i].getBits());
+}
+
+/* ************************************************************************ */
+
+TEST(Float16, grid)
+{
+    Grid<Half> grid(Vector<unsigned int>{8, 4});
+    EXPECT_EQ(0.0f, (grid[{3, 2}]));
+
+    grid[{3, 2}] = 0.5;
+    grid[{3, 2}] += 0.25f;
+    EXPECT_EQ(0.75f, (grid[{3, 2}]));
+
+    // Load row into compute precision, modify and store back
+    RealType row[8];
+    convertValues(grid.getData() + 2 * 8, row, 8);
+    EXPECT_EQ(RealType(0.75), row[3]);
+
+    for (auto& value : row)
+        value += 1;
+
+    convertValues(row, grid.getContainer().data() + 2 * 8, 8);
+    EXPECT_EQ(1.75f, (grid[{3, 2}]));
+    EXPECT_EQ(1.0f, (grid[{0, 2}]));
+    EXPECT_EQ(0.0f, (grid[{0, 1}]));
+}
+
+/* ************************************************************************ */
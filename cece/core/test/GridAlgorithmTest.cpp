@@ -0,0 +1,174 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// C++
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/GridAlgorithm.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+TEST(GridAlgorithm, bands)
+{
+    Vector<unsigned int> size{100, 1000};
+    unsigned int rows = 0;
+    Atomic<unsigned int> bands{0};
+
+    parallel::forEachBand(size, [&] (std::size_t, unsigned int begin, unsigned int end) {
+        ASSERT_LT(begin, end);
+        ASSERT_LE(end, 1000u);
+        ++bands;
+    });
+
+    EXPECT_EQ(parallel::calcBandCount(size), bands);
+
+    for (unsigned int i = 0; i < parallel::calcBandCount(size); ++i)
+        rows += std::min(parallel::calcBandRows(size), 1000u - i * parallel::calcBandRows(size));
+
+    EXPECT_EQ(1000u, rows);
+    EXPECT_EQ(0u, parallel::calcBandCount(Vector<unsigned int>{0, 10}));
+}
+
+/* ************************************************************************ */
+
+TEST(GridAlgorithm, forEachCell)
+{
+    ThreadPool pool(4);
+    Grid<int> grid(Vector<unsigned int>{123, 457});
+
+    parallel::forEachCell(grid, [] (const Vector<unsigned int>& coord, int& value) {
+        value = coord.getX() + coord.getY() * 1000;
+    }, pool);
+
+    for (unsigned int y = 0; y < 457; ++y)
+        for (unsigned int x = 0; x < 123; ++x)
+            EXPECT_EQ(static_cast<int>(x + y * 1000), (grid[{x, y}]));
+
+    parallel::fill(grid, 7, pool);
+
+    for (auto value : grid)
+        EXPECT_EQ(7, value);
+}
+
+/* ************************************************************************ */
+
+TEST(GridAlgorithm, transform)
+{
+    ThreadPool pool(4);
+    Grid<int> a(Vector<unsigned int>{300, 200});
+    Grid<int> b(Vector<unsigned int>{300, 200});
+    Grid<RealType> out;
+
+    parallel::forEachCell(a, [] (const Vector<unsigned int>& coord, int& value) {
+        value = coord.getX();
+    }, pool);
+
+    parallel::transform(a, b, [] (int value) { return value * 2; }, pool);
+    parallel::zipTransform(a, b, out, [] (int x, int y) { return RealType(x + y); }, pool);
+
+    ASSERT_EQ(a.getSize(), out.getSize());
+
+    for (unsigned int y = 0; y < 200; ++y)
+        for (unsigned int x = 0; x < 300; ++x)
+            EXPECT_EQ(RealType(3 * x), (out[{x, y}]));
+}
+
+/* ************************************************************************ */
+
+TEST(GridAlgorithm, reduce)
+{
+    Grid<int> grid(Vector<unsigned int>{500, 300});
+
+    parallel::forEachCell(grid, [] (const Vector<unsigned int>& coord, int& value) {
+        value = static_cast<int>(coord.getX()) - static_cast<int>(coord.getY());
+    });
+
+    long long sum = 0;
+
+    for (auto value : grid)
+        sum += value;
+
+    EXPECT_EQ(sum, parallel::reduce(grid, 0ll, [] (long long a, int b) { return a + b; }));
+    EXPECT_EQ(sum, parallel::reduceSum(grid));
+    EXPECT_EQ(-299, parallel::reduceMin(grid));
+    EXPECT_EQ(499, parallel::reduceMax(grid));
+}
+
+/* ************************************************************************ */
+
+TEST(GridAlgorithm, deterministic)
+{
+    Grid<float> grid(Vector<unsigned int>{777, 333});
+
+    parallel::forEachCell(grid, [] (const Vector<unsigned int>& coord, float& value) {
+        value = 1.0f / (1 + coord.getX() * 31 + coord.getY() * 17);
+    });
+
+    ThreadPool serial(1);
+    ThreadPool pool2(2);
+    ThreadPool pool5(5);
+
+    const float expected = parallel::reduceSum(grid, serial);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        const float s2 = parallel::reduceSum(grid, pool2);
+        const float s5 = parallel::reduceSum(grid, pool5);
+
+        // Bitwise identical
+        EXPECT_EQ(0, std::memcmp(&expected, &s2, sizeof(float)));
+        EXPECT_EQ(0, std::memcmp(&expected, &s5, sizeof(float)));
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(GridAlgorithm, accumulator)
+{
+    static_assert(std::is_same<AccumulatorType<int>::type, int>::value, "Integers are summed in itself");
+
+    // 0.1f can't be summed in float, sum drifts after few million cells
+    Grid<float> grid(Vector<unsigned int>{2048, 2048});
+    parallel::fill(grid, 0.1f);
+
+    using ResultType = AccumulatorType<float>::type;
+    const ResultType sum = parallel::reduceSum(grid);
+    const ResultType expected = ResultType(0.1f) * grid.getContainer().size();
+
+    EXPECT_NEAR(expected, sum, expected * std::numeric_limits<ResultType>::epsilon() * 4096);
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,113 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cstdio>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/Grid.hpp"
+#include "cece/core/Exception.hpp"
+#include "cece/core/GridSnapshot.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+TEST(GridSnapshotTest, readWrite)
+{
+    const FilePath path = "GridSnapshotTest.readWrite.grid";
+
+    Grid<double> grid({100, 70});
+
+    {
+        GridSnapshotWriter writer(path, {32, 16});
+
+        for (int frame = 0; frame < 5; ++frame)
+        {
+            for (unsigned int y = 0; y < grid.getSize().getHeight(); ++y)
+            for (unsigned int x = 0; x < grid.getSize().getWidth(); ++x)
+                grid[{x, y}] = frame * 1000.0 + x * 0.5 + y;
+
+            writer.write(grid, frame * 10, units::Time(frame * 0.5));
+        }
+    }
+
+    GridSnapshotReader reader(path);
+    EXPECT_EQ(100u, reader.getSize().getWidth());
+    EXPECT_EQ(70u, reader.getSize().getHeight());
+    EXPECT_EQ(GridSnapshotValueType::Float64, reader.getValueType());
+    ASSERT_EQ(5u, reader.getFrameCount());
+    EXPECT_EQ(30u, reader.getFrameIteration(3));
+    EXPECT_DOUBLE_EQ(1.5, reader.getFrameTime(3).value());
+
+    Grid<double> result;
+    reader.read(4, result);
+    ASSERT_EQ(grid.getSize(), result.getSize());
+    EXPECT_TRUE(std::equal(grid.begin(), grid.end(), result.begin()));
+
+    // Region
+    reader.readRegion(2, {30, 10}, {41, 50}, result);
+    ASSERT_EQ(41u, result.getSize().getWidth());
+    ASSERT_EQ(50u, result.getSize().getHeight());
+
+    for (unsigned int y = 0; y < result.getSize().getHeight(); ++y)
+    for (unsigned int x = 0; x < result.getSize().getWidth(); ++x)
+        EXPECT_DOUBLE_EQ(2000.0 + (x + 30) * 0.5 + (y + 10), (result[{x, y}]));
+
+    // Time range
+    const auto frames = reader.findFrames(units::Time(0.4), units::Time(1.5));
+    EXPECT_EQ(1u, frames.first);
+    EXPECT_EQ(4u, frames.second);
+
+    // Wrong type
+    Grid<float> wrong;
+    EXPECT_THROW(reader.read(0, wrong), InvalidArgumentException);
+    EXPECT_THROW(reader.readRegion(0, {90, 0}, {20, 10}, result), OutOfRangeException);
+
+    std::remove(path.toString().c_str());
+}
+
+/* ************************************************************************ */
+
+TEST(GridSnapshotTest, mismatch)
+{
+    const FilePath path = "GridSnapshotTest.mismatch.grid";
+
+    {
+        GridSnapshotWriter writer(path);
+        writer.write(Grid<int>({10, 10}), 0, Zero);
+        EXPECT_THROW(writer.write(Grid<int>({10, 11}), 1, Zero), InvalidArgumentException);
+        EXPECT_THROW(writer.write(Grid<float>({10, 10}), 1, Zero), InvalidArgumentException);
+    }
+
+    std::remove(path.toString().c_str());
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,189 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// C++
+#include <algorithm>
+
+// CeCe
+#include "cece/core/GridStencil.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Reference implementation.
+ */
+RealType reference(const RealGrid& in, int x, int y, const Stencil& stencil,
+    StencilBoundary boundary, RealType value)
+{
+    const int width = in.getSize().getWidth();
+    const int height = in.getSize().getHeight();
+    RealType sum = 0;
+
+    for (const auto& point : stencil.getPoints())
+    {
+        int sx = x + point.dx;
+        int sy = y + point.dy;
+        const bool inside = sx >= 0 && sx < width && sy >= 0 && sy < height;
+
+        if (!inside && boundary == StencilBoundary::Dirichlet)
+        {
+            sum += point.weight * value;
+            continue;
+        }
+
+        if (boundary == StencilBoundary::Clamp)
+        {
+            sx = std::min(std::max(sx, 0), width - 1);
+            sy = std::min(std::max(sy, 0), height - 1);
+        }
+        else
+        {
+            sx = ((sx % width) + width) % width;
+            sy = ((sy % height) + height) % height;
+        }
+
+        sum += point.weight * in[Vector<unsigned int>(sx, sy)];
+    }
+
+    return sum;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Compare stencil result with reference implementation.
+ */
+void check(unsigned int width, unsigned int height, const Stencil& stencil,
+    StencilBoundary boundary, RealType value = 0)
+{
+    RealGrid in(Vector<unsigned int>{width, height});
+    RealGrid out;
+
+    for (unsigned int y = 0; y < height; ++y)
+        for (unsigned int x = 0; x < width; ++x)
+            in[Vector<unsigned int>(x, y)] = static_cast<StorageRealType>((x * 7 + y * 13) % 17) - 8;
+
+    applyStencil(in, out, stencil, boundary, value);
+    ASSERT_EQ(in.getSize(), out.getSize());
+
+    for (unsigned int y = 0; y < height; ++y)
+    {
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            EXPECT_NEAR(reference(in, x, y, stencil, boundary, value),
+                out[Vector<unsigned int>(x, y)], 1e-4) << "(" << x << ", " << y << ")";
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(GridStencil, construct)
+{
+    Stencil stencil({{0, 0, 1}, {2, 0, 0}, {0, 0, 2}, {-1, 3, 1}});
+
+    ASSERT_EQ(2u, stencil.getPoints().size());
+    EXPECT_EQ(3, stencil.getPoints()[0].weight);
+    EXPECT_EQ(3u, stencil.getRadius());
+
+    EXPECT_EQ(5u, Stencil::makeLaplacian5().getPoints().size());
+    EXPECT_EQ(9u, Stencil::makeLaplacian9().getPoints().size());
+    EXPECT_EQ(1u, Stencil::makeLaplacian9().getRadius());
+}
+
+/* ************************************************************************ */
+
+TEST(GridStencil, constant)
+{
+    RealGrid in;
+    in.resize(Vector<unsigned int>{32, 16}, 2);
+    RealGrid out;
+
+    // Laplacian of constant field is zero everywhere except Dirichlet border
+    applyStencil(in, out, Stencil::makeLaplacian5(), StencilBoundary::Clamp);
+
+    for (auto value : out)
+        EXPECT_FLOAT_EQ(0, value);
+
+    applyStencil(in, out, Stencil::makeLaplacian9(), StencilBoundary::Periodic);
+
+    for (auto value : out)
+        EXPECT_NEAR(0, value, 1e-5);
+}
+
+/* ************************************************************************ */
+
+TEST(GridStencil, boundaries)
+{
+    const StencilBoundary boundaries[] = {
+        StencilBoundary::Clamp,
+        StencilBoundary::Periodic,
+        StencilBoundary::Dirichlet
+    };
+
+    const Stencil stencils[] = {
+        Stencil::makeLaplacian5(),
+        Stencil::makeNinePoint(0.5, 0.1, 0.025),
+        Stencil({{-2, 0, 0.5}, {0, 2, -1}, {1, -1, 2}, {0, 0, 0.25}})
+    };
+
+    for (auto boundary : boundaries)
+    {
+        for (const auto& stencil : stencils)
+        {
+            check(1, 1, stencil, boundary, 3);
+            check(3, 2, stencil, boundary, 3);
+            check(5, 5, stencil, boundary, 3);
+            check(37, 19, stencil, boundary, 3);
+            check(64, 64, stencil, boundary, 3);
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(GridStencil, isa)
+{
+    const String isa = getStencilIsa();
+
+    EXPECT_TRUE(isa == "avx512f" || isa == "avx2" || isa == "default");
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,263 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// C++
+#include <set>
+
+// CeCe
+#include "cece/core/Grid.hpp"
+#include "cece/core/GridLayout.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Check layout of grid with given size.
+ *
+ * @param width
+ * @param height
+ */
+template<typename Layout>
+void checkLayout(unsigned int width, unsigned int height)
+{
+    using GridType = Grid<int, AlignedAllocator<int>, Layout>;
+    using SizeType = typename GridType::SizeType;
+
+    GridType grid(Vector<SizeType>{width, height});
+    ASSERT_GE(grid.getContainer().size(), width * height);
+
+    std::set<SizeType> offsets;
+
+    for (SizeType y = 0; y < height; ++y)
+    {
+        for (SizeType x = 0; x < width; ++x)
+        {
+            const Vector<SizeType> coord{x, y};
+            const auto offset = grid.calcOffset(coord);
+
+            ASSERT_LT(offset, grid.getContainer().size());
+            EXPECT_EQ(coord, grid.calcCoordinate(offset));
+            EXPECT_TRUE(offsets.insert(offset).second);
+
+            grid[coord] = static_cast<int>(x + y * 1000);
+        }
+    }
+
+    for (SizeType y = 1; y + 1 < height; ++y)
+    {
+        for (SizeType x = 1; x + 1 < width; ++x)
+        {
+            const Vector<SizeType> coord{x, y};
+            const auto offset = grid.calcOffset(coord);
+
+            EXPECT_EQ(grid.calcOffset({x - 1, y}), (grid.template calcNeighbourOffset<-1, 0>(coord, offset)));
+            EXPECT_EQ(grid.calcOffset({x + 1, y}), (grid.template calcNeighbourOffset<1, 0>(coord, offset)));
+            EXPECT_EQ(grid.calcOffset({x, y - 1}), (grid.template calcNeighbourOffset<0, -1>(coord, offset)));
+            EXPECT_EQ(grid.calcOffset({x, y + 1}), (grid.template calcNeighbourOffset<0, 1>(coord, offset)));
+            EXPECT_EQ(grid.calcOffset({x + 1, y + 1}), (grid.template calcNeighbourOffset<1, 1>(coord, offset)));
+        }
+    }
+
+    SizeType count = 0;
+
+    grid.forEach([&count] (const Vector<SizeType>& coord, int& value) {
+        EXPECT_EQ(static_cast<int>(coord.getX() + coord.getY() * 1000), value);
+        ++count;
+    });
+
+    EXPECT_EQ(width * height, count);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Check 3D layout of grid with given size.
+ *
+ * @param size
+ */
+template<typename Layout>
+void checkLayout3(BasicVector<unsigned int, 3> size)
+{
+    using GridType = Grid<int, AlignedAllocator<int>, Layout>;
+    using SizeType = typename GridType::SizeType;
+    using CoordinateType = typename GridType::CoordinateType;
+
+    GridType grid(size);
+    ASSERT_GE(grid.getContainer().size(), size.getWidth() * size.getHeight() * size.getDepth());
+
+    std::set<SizeType> offsets;
+
+    for (SizeType z = 0; z < size.getDepth(); ++z)
+    {
+        for (SizeType y = 0; y < size.getHeight(); ++y)
+        {
+            for (SizeType x = 0; x < size.getWidth(); ++x)
+            {
+                const CoordinateType coord{x, y, z};
+                const auto offset = grid.calcOffset(coord);
+
+                ASSERT_LT(offset, grid.getContainer().size());
+                EXPECT_EQ(coord, grid.calcCoordinate(offset));
+                EXPECT_TRUE(offsets.insert(offset).second);
+                EXPECT_TRUE(grid.inRange(coord));
+
+                grid[coord] = static_cast<int>(x + y * 1000 + z * 1000000);
+            }
+        }
+    }
+
+    EXPECT_FALSE(grid.inRange({0, 0, size.getDepth()}));
+
+    for (SizeType z = 1; z + 1 < size.getDepth(); ++z)
+    {
+        for (SizeType y = 1; y + 1 < size.getHeight(); ++y)
+        {
+            for (SizeType x = 1; x + 1 < size.getWidth(); ++x)
+            {
+                const CoordinateType coord{x, y, z};
+                const auto offset = grid.calcOffset(coord);
+
+                EXPECT_EQ(grid.calcOffset({x - 1, y, z}), (grid.template calcNeighbourOffset<-1, 0, 0>(coord, offset)));
+                EXPECT_EQ(grid.calcOffset({x + 1, y, z}), (grid.template calcNeighbourOffset<1, 0, 0>(coord, offset)));
+                EXPECT_EQ(grid.calcOffset({x, y - 1, z}), (grid.template calcNeighbourOffset<0, -1, 0>(coord, offset)));
+                EXPECT_EQ(grid.calcOffset({x, y + 1, z}), (grid.template calcNeighbourOffset<0, 1, 0>(coord, offset)));
+                EXPECT_EQ(grid.calcOffset({x, y, z - 1}), (grid.template calcNeighbourOffset<0, 0, -1>(coord, offset)));
+                EXPECT_EQ(grid.calcOffset({x, y, z + 1}), (grid.template calcNeighbourOffset<0, 0, 1>(coord, offset)));
+                EXPECT_EQ(grid.calcOffset({x + 1, y - 1, z + 1}), (grid.template calcNeighbourOffset<1, -1, 1>(coord, offset)));
+            }
+        }
+    }
+
+    SizeType count = 0;
+
+    grid.forEach([&count] (const CoordinateType& coord, int& value) {
+        EXPECT_EQ(static_cast<int>(coord.getX() + coord.getY() * 1000 + coord.getZ() * 1000000), value);
+        ++count;
+    });
+
+    EXPECT_EQ(size.getWidth() * size.getHeight() * size.getDepth(), count);
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(GridTest, rowMajor)
+{
+    checkLayout<GridLayoutRowMajor>(13, 7);
+
+    Grid<int> grid(Vector<Grid<int>::SizeType>{4, 3});
+    EXPECT_EQ(12u, grid.getContainer().size());
+    EXPECT_EQ(9u, grid.calcOffset({1, 2}));
+}
+
+/* ************************************************************************ */
+
+TEST(GridTest, tiled)
+{
+    checkLayout<GridLayoutTiled<8>>(64, 64);
+    checkLayout<GridLayoutTiled<8>>(13, 21);
+    checkLayout<GridLayoutTiled<4>>(1, 9);
+
+    using Layout = GridLayoutTiled<4>;
+    EXPECT_EQ(96u, Layout::calcCapacity({5, 9}));
+    EXPECT_EQ(0u, Layout::calcOffset({5, 9}, {0, 0}));
+    EXPECT_EQ(5u, Layout::calcOffset({5, 9}, {1, 1}));
+    EXPECT_EQ(16u, Layout::calcOffset({5, 9}, {4, 0}));
+    EXPECT_EQ(32u, Layout::calcOffset({5, 9}, {0, 4}));
+}
+
+/* ************************************************************************ */
+
+TEST(GridTest, morton)
+{
+    checkLayout<GridLayoutMorton<>>(32, 32);
+    checkLayout<GridLayoutMorton<>>(10, 3);
+    checkLayout<GridLayoutMorton<8>>(37, 21);
+
+    using Layout = GridLayoutMorton<>;
+    EXPECT_EQ(16u, Layout::calcCapacity({3, 4}));
+    EXPECT_EQ(0u, Layout::calcCapacity({0, 4}));
+    EXPECT_EQ(1u, Layout::calcOffset({4, 4}, {1, 0}));
+    EXPECT_EQ(2u, Layout::calcOffset({4, 4}, {0, 1}));
+    EXPECT_EQ(3u, Layout::calcOffset({4, 4}, {1, 1}));
+    EXPECT_EQ(4u, Layout::calcOffset({4, 4}, {2, 0}));
+
+    // Thin grid is stored in blocks of its height
+    EXPECT_EQ(48u, Layout::calcCapacity({10, 3}));
+    EXPECT_EQ(16u, Layout::calcOffset({10, 3}, {4, 0}));
+    EXPECT_EQ(35u, Layout::calcOffset({10, 3}, {9, 1}));
+
+    // Non power of two grid is padded to whole blocks only
+    EXPECT_EQ(2u * 16u * 64u * 64u, Layout::calcCapacity({100, 1000}));
+    EXPECT_EQ(4096u, Layout::calcOffset({100, 1000}, {64, 0}));
+    EXPECT_EQ(2u * 4096u + 3u, Layout::calcOffset({100, 1000}, {1, 65}));
+}
+
+/* ************************************************************************ */
+
+TEST(GridTest, rowMajor3)
+{
+    checkLayout3<GridLayoutRowMajor3>({13, 7, 5});
+
+    Grid3<int> grid({4, 3, 2});
+    EXPECT_EQ(24u, grid.getContainer().size());
+    EXPECT_EQ(21u, grid.calcOffset({1, 2, 1}));
+}
+
+/* ************************************************************************ */
+
+TEST(GridTest, blocked3)
+{
+    checkLayout3<GridLayoutBlocked3<4>>({8, 8, 8});
+    checkLayout3<GridLayoutBlocked3<4>>({13, 7, 5});
+    checkLayout3<GridLayoutBlocked3<2>>({1, 5, 3});
+
+    using Layout = GridLayoutBlocked3<4>;
+    EXPECT_EQ(384u, Layout::calcCapacity({5, 9, 2}));
+    EXPECT_EQ(0u, Layout::calcOffset({5, 9, 2}, {0, 0, 0}));
+    EXPECT_EQ(21u, Layout::calcOffset({5, 9, 2}, {1, 1, 1}));
+    EXPECT_EQ(64u, Layout::calcOffset({5, 9, 2}, {4, 0, 0}));
+    EXPECT_EQ(128u, Layout::calcOffset({5, 9, 2}, {0, 4, 0}));
+
+    Grid3<RealType, AlignedAllocator<RealType>, Layout> grid({10, 10, 10});
+    EXPECT_EQ(27u * 64u, grid.getContainer().size());
+    grid[{9, 9, 9}] = 1;
+    EXPECT_EQ(1, (grid[{9, 9, 9}]));
+}
+
+/* ************************************************************************ */
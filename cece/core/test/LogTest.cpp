@@ -0,0 +1,185 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/String.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Log.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Output storing messages.
+ */
+struct StoreOutput : public Log::Output
+{
+    DynamicArray<String> messages;
+
+    void write(Log::Type, const String&, const String& msg) override
+    {
+        messages.push_back(msg);
+    }
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Counts how many times it was formatted.
+ */
+struct Formatted
+{
+    int* count;
+};
+
+/* ************************************************************************ */
+
+OutStream& operator<<(OutStream& os, const Formatted& value)
+{
+    ++*value.count;
+    return os << "formatted";
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(LogTest, level)
+{
+    StoreOutput output;
+    Log::setOutput(&output);
+    Log::setError(&output);
+
+    int count = 0;
+
+    Log::setLevel(Log::Type::Warning);
+    EXPECT_FALSE(Log::isEnabled(Log::Type::Info));
+    EXPECT_TRUE(Log::isEnabled(Log::Type::Warning));
+    EXPECT_TRUE(Log::isEnabled(Log::Type::Error));
+
+    Log::info("info ", Formatted{&count});
+    Log::warning("warning ", Formatted{&count});
+    Log::error("error ", Formatted{&count});
+
+    Log::setLevel(Log::Type::Debug);
+    Log::info("info ", Formatted{&count});
+
+    Log::setOutput(nullptr);
+    Log::setError(nullptr);
+
+    EXPECT_EQ(3, count);
+    ASSERT_EQ(3u, output.messages.size());
+    EXPECT_EQ("warning formatted", output.messages[0]);
+    EXPECT_EQ("error formatted", output.messages[1]);
+    EXPECT_EQ("info formatted", output.messages[2]);
+}
+
+/* ************************************************************************ */
+
+TEST(LogTest, asyncRepeated)
+{
+    StoreOutput output;
+
+    {
+        Log::AsyncOutput async(&output, 256, 0);
+
+        for (int i = 0; i < 100; ++i)
+            async.write(Log::Type::Warning, String{}, "Unable to create program");
+
+        async.write(Log::Type::Info, String{}, "done");
+        async.flush();
+
+        EXPECT_EQ(0u, async.getDroppedCount());
+    }
+
+    ASSERT_EQ(3u, output.messages.size());
+    EXPECT_EQ("Unable to create program", output.messages[0]);
+    EXPECT_EQ("Last message repeated 99 times", output.messages[1]);
+    EXPECT_EQ("done", output.messages[2]);
+}
+
+/* ************************************************************************ */
+
+TEST(LogTest, asyncRateLimit)
+{
+    StoreOutput output;
+
+    {
+        Log::AsyncOutput async(&output, 256, 3);
+
+        for (int i = 0; i < 20; ++i)
+            async.write(Log::Type::Warning, String{}, i % 2 ? "odd" : "even");
+    }
+
+    ASSERT_EQ(7u, output.messages.size());
+    EXPECT_EQ("even", output.messages[0]);
+    EXPECT_EQ("odd", output.messages[5]);
+    EXPECT_EQ("14 messages suppressed by rate limit", output.messages[6]);
+}
+
+/* ************************************************************************ */
+
+TEST(LogTest, asyncThreads)
+{
+    StoreOutput output;
+
+    {
+        Log::AsyncOutput async(&output, 1 << 16, 0);
+        DynamicArray<std::thread> threads;
+
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&async, t] {
+                for (int i = 0; i < 1000; ++i)
+                    async.write(Log::Type::Info, String{}, toString(t) + ":" + toString(i));
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        async.flush();
+        EXPECT_EQ(0u, async.getDroppedCount());
+    }
+
+    EXPECT_EQ(4000u, output.messages.size());
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,150 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// C++
+#include <cstdio>
+
+// CeCe
+#include "cece/core/Exception.hpp"
+#include "cece/core/MappedAllocator.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+TEST(MappedGrid, persist)
+{
+    const FilePath path = "mapped_grid_test.bin";
+    std::remove(path.c_str());
+
+    {
+        MappedGrid<float> grid(Vector<unsigned int>{64, 32}, MappedAllocator<float>(path));
+        ASSERT_NE(nullptr, grid.getData());
+        EXPECT_EQ(64u * 32u * sizeof(float), grid.getAllocator().getFile()->getFileSize());
+
+        grid.getAllocator().advise(MappedAccess::Sequential);
+
+        for (unsigned int y = 0; y < 32; ++y)
+            for (unsigned int x = 0; x < 64; ++x)
+                grid[{x, y}] = x + y * 0.5f;
+
+        grid.getAllocator().sync();
+    }
+
+    // Existing content is kept
+    {
+        MappedGrid<float> grid(Vector<unsigned int>{64, 32}, MappedAllocator<float>(path, MappedMode::ReadOnly));
+
+        for (unsigned int y = 0; y < 32; ++y)
+            for (unsigned int x = 0; x < 64; ++x)
+                EXPECT_FLOAT_EQ(x + y * 0.5f, (grid[{x, y}]));
+    }
+
+    // Read-only file cannot be extended
+    {
+        MappedGrid<float> grid(MappedAllocator<float>(path, MappedMode::ReadOnly));
+        EXPECT_THROW(grid.resize(Vector<unsigned int>{128, 128}), RuntimeException);
+    }
+
+    std::remove(path.c_str());
+}
+
+/* ************************************************************************ */
+
+TEST(MappedGrid, grow)
+{
+    const FilePath path = "mapped_grid_grow.bin";
+    std::remove(path.c_str());
+
+    MappedGrid<int> grid(Vector<unsigned int>{16, 4}, MappedAllocator<int>(path));
+
+    for (unsigned int i = 0; i < 64; ++i)
+        grid[i] = i;
+
+    // Growth maps the file again, old values stay in place
+    grid.resize(Vector<unsigned int>{16, 64});
+    EXPECT_EQ(16u * 64u * sizeof(int), grid.getAllocator().getFile()->getFileSize());
+
+    for (unsigned int i = 0; i < 64; ++i)
+        EXPECT_EQ(static_cast<int>(i), grid[i]);
+
+    std::remove(path.c_str());
+}
+
+/* ************************************************************************ */
+
+TEST(MappedGrid, copy)
+{
+    const FilePath path = "mapped_grid_copy.bin";
+    std::remove(path.c_str());
+
+    {
+        MappedGrid<int> grid(Vector<unsigned int>{8, 8}, MappedAllocator<int>(path));
+
+        for (unsigned int i = 0; i < 64; ++i)
+            grid[i] = i;
+
+        // Copy is on heap and doesn't write into the file
+        MappedGrid<int> copy(grid);
+        EXPECT_EQ(nullptr, copy.getAllocator().getFile());
+        EXPECT_NE(grid.getData(), copy.getData());
+
+        for (unsigned int i = 0; i < 64; ++i)
+            copy[i] = -1;
+
+        for (unsigned int i = 0; i < 64; ++i)
+            EXPECT_EQ(static_cast<int>(i), grid[i]);
+
+        // Assignment keeps the target allocator
+        copy = grid;
+        EXPECT_EQ(nullptr, copy.getAllocator().getFile());
+        EXPECT_EQ(63, copy[63]);
+
+        grid.getAllocator().sync();
+    }
+
+    {
+        MappedGrid<int> grid(Vector<unsigned int>{8, 8}, MappedAllocator<int>(path, MappedMode::ReadOnly));
+
+        for (unsigned int i = 0; i < 64; ++i)
+            EXPECT_EQ(static_cast<int>(i), grid[i]);
+    }
+
+    std::remove(path.c_str());
+}
+
+/* ************************************************************************ */
+
+TEST(MappedGrid, missing)
+{
+    EXPECT_THROW(MappedAllocator<int>("missing/file.bin", MappedMode::ReadOnly), RuntimeException);
+}
+
+/* ************************************************************************ */
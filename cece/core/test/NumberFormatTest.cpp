@@ -0,0 +1,190 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <cmath>
+#include <random>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/String.hpp"
+#include "cece/core/NumberFormat.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+static String integer(long long value)
+{
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    return String(buffer, formatInteger(buffer, value));
+}
+
+/* ************************************************************************ */
+
+static String real(double value)
+{
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    return String(buffer, formatReal(buffer, value));
+}
+
+/* ************************************************************************ */
+
+static String general(double value)
+{
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    return String(buffer, formatRealGeneral(buffer, value));
+}
+
+/* ************************************************************************ */
+
+static String scientific(double value)
+{
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    return String(buffer, formatRealScientific(buffer, value));
+}
+
+/* ************************************************************************ */
+
+static String reference(const char* format, double value)
+{
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    const int length = std::snprintf(buffer, sizeof(buffer), format, value);
+    return String(buffer, length);
+}
+
+/* ************************************************************************ */
+
+TEST(NumberFormatTest, integer)
+{
+    EXPECT_EQ("0", integer(0));
+    EXPECT_EQ("7", integer(7));
+    EXPECT_EQ("-1", integer(-1));
+    EXPECT_EQ("10", integer(10));
+    EXPECT_EQ("100", integer(100));
+    EXPECT_EQ("1234567", integer(1234567));
+    EXPECT_EQ("9223372036854775807", integer(std::numeric_limits<long long>::max()));
+    EXPECT_EQ("-9223372036854775808", integer(std::numeric_limits<long long>::min()));
+
+    char buffer[NUMBER_FORMAT_BUFFER_SIZE];
+    EXPECT_EQ("18446744073709551615", String(buffer, formatUnsigned(buffer, std::numeric_limits<unsigned long long>::max())));
+}
+
+/* ************************************************************************ */
+
+TEST(NumberFormatTest, real)
+{
+    EXPECT_EQ("0e+00", real(0.0));
+    EXPECT_EQ("-0e+00", real(-0.0));
+    EXPECT_EQ("1e+00", real(1.0));
+    EXPECT_EQ("1.5e+00", real(1.5));
+    EXPECT_EQ("-1.5e+00", real(-1.5));
+    EXPECT_EQ("1e-01", real(0.1));
+    EXPECT_EQ("1.23456e+02", real(123.456));
+    EXPECT_EQ("1e+100", real(1e100));
+    EXPECT_EQ("5e-324", real(5e-324));
+    EXPECT_EQ("1.7976931348623157e+308", real(std::numeric_limits<double>::max()));
+    EXPECT_EQ("inf", real(std::numeric_limits<double>::infinity()));
+    EXPECT_EQ("-inf", real(-std::numeric_limits<double>::infinity()));
+    EXPECT_EQ("nan", real(std::numeric_limits<double>::quiet_NaN()));
+}
+
+/* ************************************************************************ */
+
+TEST(NumberFormatTest, realRoundTrip)
+{
+    std::mt19937_64 gen(1);
+    std::uniform_real_distribution<double> dist(-1e6, 1e6);
+    std::uniform_int_distribution<int> exponent(-300, 300);
+
+    for (int i = 0; i < 100000; ++i)
+    {
+        const double value = dist(gen) * std::pow(10.0, exponent(gen));
+        EXPECT_EQ(value, std::strtod(real(value).c_str(), nullptr));
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(NumberFormatTest, realGeneral)
+{
+    EXPECT_EQ("0", general(0.0));
+    EXPECT_EQ("-0", general(-0.0));
+    EXPECT_EQ("1", general(1.0));
+    EXPECT_EQ("-1.5", general(-1.5));
+    EXPECT_EQ("0.1", general(0.1));
+    EXPECT_EQ("123.456", general(123.456));
+    EXPECT_EQ("0.0001", general(1e-4));
+    EXPECT_EQ("1e-05", general(1e-5));
+    EXPECT_EQ("100000", general(1e5));
+    EXPECT_EQ("1e+06", general(999999.5));
+    EXPECT_EQ("1.23457e+08", general(123456789));
+    EXPECT_EQ("1.23456e+06", general(1234565));
+    EXPECT_EQ("1e+100", general(1e100));
+    EXPECT_EQ("inf", general(std::numeric_limits<double>::infinity()));
+}
+
+/* ************************************************************************ */
+
+TEST(NumberFormatTest, realScientific)
+{
+    EXPECT_EQ("0.000000e+00", scientific(0.0));
+    EXPECT_EQ("-0.000000e+00", scientific(-0.0));
+    EXPECT_EQ("1.500000e+00", scientific(1.5));
+    EXPECT_EQ("1.234568e+08", scientific(123456789));
+    EXPECT_EQ("9.999999e-100", scientific(9.9999994e-100));
+    EXPECT_EQ("1.000000e+100", scientific(9.9999996e99));
+    EXPECT_EQ("4.940656e-324", scientific(5e-324));
+    EXPECT_EQ("-inf", scientific(-std::numeric_limits<double>::infinity()));
+}
+
+/* ************************************************************************ */
+
+TEST(NumberFormatTest, realPrintf)
+{
+    std::mt19937_64 gen(1);
+
+    // Digits must be the same as printf ones for any bit pattern
+    for (int i = 0; i < 100000; ++i)
+    {
+        const std::uint64_t bits = gen();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        EXPECT_EQ(reference("%g", value), general(value));
+        EXPECT_EQ(reference("%e", value), scientific(value));
+    }
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,246 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cmath>
+#include <random>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/constants.hpp"
+#include "cece/core/ParticleSolver.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Add particle.
+ */
+void add(ParticleSolver& solver, RealType x, RealType y, RealType radius, RealType inverseMass = 1)
+{
+    const auto index = solver.getCount();
+    solver.resize(index + 1);
+    solver.getPositions().set(index, {x, y});
+    solver.getRadii()[index] = radius;
+    solver.getInverseMasses()[index] = inverseMass;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(ParticleSolver, overlapRepulsion)
+{
+    ParticleSolver solver;
+    solver.setStiffness(10);
+
+    add(solver, 0, 0, 1);
+    add(solver, 1.5, 0, 1);
+    add(solver, 10, 0, 1);
+
+    solver.computeContactForces();
+
+    const auto& forces = solver.getForces();
+
+    // Overlap is 0.5
+    EXPECT_NEAR(-5, forces[0].getX(), 1e-9);
+    EXPECT_NEAR(5, forces[1].getX(), 1e-9);
+    EXPECT_DOUBLE_EQ(0, forces[0].getY());
+    EXPECT_DOUBLE_EQ(0, forces[1].getY());
+    EXPECT_DOUBLE_EQ(0, forces[2].getX());
+    EXPECT_DOUBLE_EQ(0, forces[2].getY());
+}
+
+/* ************************************************************************ */
+
+TEST(ParticleSolver, coincident)
+{
+    ParticleSolver solver;
+    solver.setStiffness(10);
+
+    add(solver, 1, 1, 1);
+    add(solver, 1, 1, 1);
+
+    solver.computeContactForces();
+
+    // No direction, no force
+    EXPECT_DOUBLE_EQ(0, solver.getForces()[0].getX());
+    EXPECT_DOUBLE_EQ(0, solver.getForces()[0].getY());
+    EXPECT_DOUBLE_EQ(0, solver.getForces()[1].getX());
+    EXPECT_DOUBLE_EQ(0, solver.getForces()[1].getY());
+}
+
+/* ************************************************************************ */
+
+TEST(ParticleSolver, bruteForce)
+{
+    constexpr std::size_t COUNT = 500;
+
+    ParticleSolver solver;
+    solver.setStiffness(3);
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<RealType> position(-20, 20);
+    std::uniform_real_distribution<RealType> radius(0.2, 1.5);
+
+    for (std::size_t i = 0; i < COUNT; ++i)
+        add(solver, position(gen), position(gen), radius(gen));
+
+    // Far particle makes grid cells larger
+    add(solver, 1e6, 1e6, 1);
+
+    solver.computeContactForces();
+
+    const auto& positions = solver.getPositions();
+    const auto& radii = solver.getRadii();
+
+    for (std::size_t i = 0; i < solver.getCount(); ++i)
+    {
+        Vector<RealType> expected = Zero;
+
+        for (std::size_t j = 0; j < solver.getCount(); ++j)
+        {
+            const auto diff = positions[i] - positions[j];
+            const auto distance = diff.getLength();
+            const auto overlap = radii[i] + radii[j] - distance;
+
+            if (i != j && overlap > 0)
+                expected += diff * (solver.getStiffness() * overlap / distance);
+        }
+
+        EXPECT_NEAR(expected.getX(), solver.getForces()[i].getX(), 1e-9);
+        EXPECT_NEAR(expected.getY(), solver.getForces()[i].getY(), 1e-9);
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(ParticleSolver, immovable)
+{
+    ParticleSolver solver;
+    solver.setStiffness(1);
+
+    add(solver, 0, 0, 1, 0);
+    add(solver, 1, 0, 1);
+
+    for (int i = 0; i < 100; ++i)
+        solver.step(0.1);
+
+    // Static particle stays and the other one is pushed away
+    EXPECT_DOUBLE_EQ(0, solver.getPositions()[0].getX());
+    EXPECT_DOUBLE_EQ(0, solver.getVelocities()[0].getX());
+    EXPECT_GT(solver.getPositions()[1].getX(), 1);
+}
+
+/* ************************************************************************ */
+
+TEST(ParticleSolver, drag)
+{
+    constexpr RealType VISCOSITY = 0.5;
+    constexpr RealType DT = 0.1;
+
+    ParticleSolver solver;
+    solver.setViscosity(VISCOSITY);
+
+    add(solver, 0, 0, 2, 0.25);
+    solver.getVelocities().set(0, {4, 0});
+
+    solver.step(DT);
+
+    const RealType gamma = 6 * constants::PI * VISCOSITY * 2;
+    const RealType velocity = 4 / (1 + DT * gamma * 0.25);
+
+    EXPECT_DOUBLE_EQ(velocity, solver.getVelocities()[0].getX());
+    EXPECT_DOUBLE_EQ(DT * velocity, solver.getPositions()[0].getX());
+}
+
+/* ************************************************************************ */
+
+TEST(ParticleSolver, force)
+{
+    ParticleSolver solver;
+
+    add(solver, 0, 0, 1, 0.5);
+    solver.getForces().set(0, {0, 2});
+
+    solver.step(1);
+
+    EXPECT_DOUBLE_EQ(1, solver.getVelocities()[0].getY());
+    EXPECT_DOUBLE_EQ(1, solver.getPositions()[0].getY());
+
+    // Forces are cleared by step
+    EXPECT_DOUBLE_EQ(0, solver.getForces()[0].getY());
+}
+
+/* ************************************************************************ */
+
+TEST(ParticleSolver, stable)
+{
+    ParticleSolver solver;
+    solver.setStiffness(1e4);
+
+    add(solver, 0, 0, 1);
+    add(solver, 1.9, 0, 1);
+
+    EXPECT_GT(solver.getStableTimeStep(), 0);
+    EXPECT_LT(solver.getStableTimeStep(), 0.01);
+
+    // Time step much longer than stable one is split into substeps
+    solver.step(0.01);
+
+    const auto distance = (solver.getPositions()[1] - solver.getPositions()[0]).getLength();
+
+    EXPECT_TRUE(std::isfinite(distance));
+    EXPECT_GT(distance, 1.9);
+    EXPECT_LT(distance, 10);
+}
+
+/* ************************************************************************ */
+
+TEST(ParticleSolver, empty)
+{
+    ParticleSolver solver;
+    solver.setStiffness(1);
+
+    solver.step(1);
+    solver.computeContactForces();
+
+    EXPECT_EQ(0u, solver.getCount());
+    EXPECT_EQ(0u, solver.getPairCount());
+    EXPECT_DOUBLE_EQ(0, solver.getStableTimeStep());
+}
+
+/* ************************************************************************ */
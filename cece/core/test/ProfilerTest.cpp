@@ -0,0 +1,224 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/StringStream.hpp"
+#include "cece/core/Profiler.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+static void inner()
+{
+    CECE_PROFILE_ZONE("ProfilerTest.inner");
+}
+
+/* ************************************************************************ */
+
+static void outer()
+{
+    CECE_PROFILE_ZONE("ProfilerTest.outer");
+    inner();
+    inner();
+}
+
+/* ************************************************************************ */
+
+TEST(ProfilerTest, registerZone)
+{
+    const auto id = Profiler::registerZone("ProfilerTest.zone");
+    EXPECT_EQ(id, Profiler::registerZone("ProfilerTest.zone"));
+    EXPECT_NE(id, Profiler::registerZone("ProfilerTest.other"));
+    EXPECT_EQ("ProfilerTest.zone", Profiler::getZoneName(id));
+}
+
+/* ************************************************************************ */
+
+TEST(ProfilerTest, disabled)
+{
+    Profiler::setEnabled(false);
+    Profiler::reset();
+
+    outer();
+    Profiler::endIteration(1);
+
+    for (const auto& zone : Profiler::getStats())
+        EXPECT_EQ(0u, zone.calls);
+}
+
+/* ************************************************************************ */
+
+TEST(ProfilerTest, hierarchy)
+{
+    Profiler::setEnabled(true);
+    Profiler::setTraceEnabled(true);
+    Profiler::reset();
+
+    outer();
+    Profiler::endIteration(1);
+    outer();
+    std::thread(outer).join();
+    Profiler::endIteration(2);
+
+    Profiler::setEnabled(false);
+    Profiler::setTraceEnabled(false);
+
+    const auto outerId = Profiler::registerZone("ProfilerTest.outer");
+    const auto innerId = Profiler::registerZone("ProfilerTest.inner");
+    const auto stats = Profiler::getStats();
+
+    EXPECT_EQ(2u, Profiler::getIterationCount());
+    EXPECT_EQ(3u, stats[outerId].calls);
+    EXPECT_EQ(6u, stats[innerId].calls);
+    EXPECT_EQ(0u, stats[outerId].depth);
+    EXPECT_EQ(1u, stats[innerId].depth);
+    EXPECT_EQ(2u, stats[outerId].iterations);
+    EXPECT_GE(stats[outerId].total, stats[innerId].total);
+    EXPECT_EQ(stats[outerId].total - stats[innerId].total, stats[outerId].self);
+    EXPECT_EQ(stats[innerId].total, stats[innerId].self);
+
+    OutStringStream trace;
+    Profiler::writeChromeTrace(trace);
+    EXPECT_EQ(0u, trace.str().find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    EXPECT_NE(String::npos, trace.str().find("\"name\":\"ProfilerTest.inner\""));
+
+    OutStringStream summary;
+    Profiler::writeSummary(summary);
+    EXPECT_NE(String::npos, summary.str().find("ProfilerTest.outer"));
+
+    Profiler::reset();
+}
+
+/* ************************************************************************ */
+
+TEST(ProfilerTest, prefix)
+{
+    const auto id = Profiler::registerZone("ProfilerTest:", "type");
+    EXPECT_EQ(id, Profiler::registerZone("ProfilerTest:type"));
+    EXPECT_EQ(id, Profiler::registerZone("ProfilerTest:", "type"));
+
+    Profiler::setEnabled(true);
+    Profiler::reset();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ProfilerScope _("ProfilerTest:", "type");
+    }
+
+    {
+        ProfilerScope _("ProfilerTest:", "other");
+    }
+
+    Profiler::endIteration(1);
+    Profiler::setEnabled(false);
+
+    const auto stats = Profiler::getStats("ProfilerTest:");
+    ASSERT_EQ(2u, stats.size());
+    EXPECT_EQ("ProfilerTest:type", stats[0].name);
+    EXPECT_EQ(3u, stats[0].calls);
+    EXPECT_EQ("ProfilerTest:other", stats[1].name);
+    EXPECT_EQ(1u, stats[1].calls);
+
+    Profiler::reset();
+}
+
+/* ************************************************************************ */
+
+TEST(ProfilerTest, manyZones)
+{
+    constexpr unsigned int COUNT = 50000;
+
+    Profiler::setEnabled(true);
+    Profiler::reset();
+
+    // More zone calls in single iteration than fits into thread buffer
+    {
+        CECE_PROFILE_ZONE("ProfilerTest.many");
+
+        for (unsigned int i = 0; i < COUNT; ++i)
+            inner();
+    }
+
+    Profiler::endIteration(1);
+    Profiler::setEnabled(false);
+
+    const auto manyId = Profiler::registerZone("ProfilerTest.many");
+    const auto innerId = Profiler::registerZone("ProfilerTest.inner");
+    const auto stats = Profiler::getStats();
+
+    EXPECT_EQ(0u, Profiler::getDroppedCount());
+    EXPECT_EQ(1u, stats[manyId].calls);
+    EXPECT_EQ(COUNT, stats[innerId].calls);
+    EXPECT_EQ(1u, stats[innerId].iterations);
+    EXPECT_EQ(stats[manyId].total - stats[innerId].total, stats[manyId].self);
+
+    Profiler::reset();
+}
+
+/* ************************************************************************ */
+
+TEST(ProfilerTest, counters)
+{
+    // Counters are often unavailable (containers, VMs), then enabling fails
+    // and zones are measured without them
+    const bool available = isPerfCountersAvailable();
+    EXPECT_EQ(available, Profiler::setCountersEnabled(true));
+    EXPECT_EQ(available, Profiler::isCountersEnabled());
+
+    Profiler::setEnabled(true);
+    Profiler::reset();
+
+    outer();
+    Profiler::endIteration(1);
+
+    Profiler::setEnabled(false);
+    Profiler::setCountersEnabled(false);
+    EXPECT_FALSE(Profiler::isCountersEnabled());
+
+    const auto outerId = Profiler::registerZone("ProfilerTest.outer");
+    const auto innerId = Profiler::registerZone("ProfilerTest.inner");
+    const auto stats = Profiler::getStats();
+    const auto cycles = static_cast<std::size_t>(PerfCounter::Cycles);
+
+    EXPECT_EQ(1u, stats[outerId].calls);
+
+    if (available)
+        EXPECT_GE(stats[outerId].counters[cycles], stats[innerId].counters[cycles]);
+    else
+        EXPECT_EQ(0u, stats[outerId].counters[cycles]);
+
+    Profiler::reset();
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,176 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// C++
+#include <set>
+#include <utility>
+
+// CeCe
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/ShapeFootprint.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+using CellSet = std::set<std::pair<unsigned int, unsigned int>>;
+
+/* ************************************************************************ */
+
+CellSet toCells(const DynamicArray<GridSpan>& spans)
+{
+    CellSet cells;
+
+    for (const auto& span : spans)
+        for (auto x = span.begin; x < span.end; ++x)
+            EXPECT_TRUE(cells.emplace(x, span.y).second);
+
+    return cells;
+}
+
+/* ************************************************************************ */
+
+CellSet subtract(const CellSet& lhs, const CellSet& rhs)
+{
+    CellSet result;
+
+    for (const auto& cell : lhs)
+        if (!rhs.count(cell))
+            result.insert(cell);
+
+    return result;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeFootprint, subtract)
+{
+    const DynamicArray<GridSpan> lhs{{1, 0, 10}, {1, 20, 30}, {2, 5, 8}};
+    const DynamicArray<GridSpan> rhs{{0, 0, 100}, {1, 2, 4}, {1, 6, 22}, {1, 29, 40}, {3, 0, 10}};
+    DynamicArray<GridSpan> result;
+
+    subtractSpans(lhs, rhs, result);
+
+    const DynamicArray<GridSpan> expected{{1, 0, 2}, {1, 4, 6}, {1, 22, 29}, {2, 5, 8}};
+    EXPECT_EQ(expected, result);
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeFootprint, update)
+{
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    const Vector<unsigned int> size{200, 100};
+    const DynamicArray<Shape> shapes{
+        Shape::makeCircle(units::um(10)),
+        Shape::makeRectangle({units::um(30), units::um(4)}, {units::um(5), Zero})
+    };
+
+    ShapeFootprint footprint;
+
+    // Initial
+    footprint.update(shapes, 1, steps, {100, 50}, Zero, size);
+    EXPECT_TRUE(footprint.isRasterized());
+    EXPECT_TRUE(footprint.getLeft().empty());
+    EXPECT_EQ(footprint.getSpans(), footprint.getEntered());
+
+    const auto initial = toCells(footprint.getSpans());
+    EXPECT_GT(initial.size(), 300u);
+
+    // Not moved
+    footprint.update(shapes, 1, steps, {100, 50}, Zero, size);
+    EXPECT_FALSE(footprint.isRasterized());
+    EXPECT_TRUE(footprint.getEntered().empty());
+    EXPECT_TRUE(footprint.getLeft().empty());
+    EXPECT_EQ(initial, toCells(footprint.getSpans()));
+
+    // Translated
+    footprint.update(shapes, 1, steps, {103, 48}, Zero, size);
+    EXPECT_FALSE(footprint.isRasterized());
+
+    const auto moved = toCells(footprint.getSpans());
+    CellSet expected;
+
+    for (const auto& cell : initial)
+        expected.emplace(cell.first + 3, cell.second - 2);
+
+    EXPECT_EQ(expected, moved);
+    EXPECT_EQ(subtract(moved, initial), toCells(footprint.getEntered()));
+    EXPECT_EQ(subtract(initial, moved), toCells(footprint.getLeft()));
+
+    // Shapes changed
+    footprint.update(shapes, 2, steps, {103, 48}, Zero, size);
+    EXPECT_TRUE(footprint.isRasterized());
+    EXPECT_TRUE(footprint.getEntered().empty());
+
+    // Rotation changed
+    footprint.update(shapes, 2, steps, {103, 48}, units::deg(30), size);
+    EXPECT_TRUE(footprint.isRasterized());
+
+    // Clipped by grid border
+    footprint.update(shapes, 2, steps, {195, 48}, units::deg(30), size);
+    EXPECT_TRUE(footprint.isRasterized());
+    footprint.update(shapes, 2, steps, {194, 48}, units::deg(30), size);
+    EXPECT_TRUE(footprint.isRasterized());
+
+    for (const auto& span : footprint.getSpans())
+        EXPECT_LE(span.end, size.getWidth());
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeFootprint, rotationTolerance)
+{
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    const Vector<unsigned int> size{100, 100};
+    const DynamicArray<Shape> shapes{Shape::makeRectangle({units::um(20), units::um(6)})};
+
+    ShapeFootprint footprint;
+    footprint.setRotationTolerance(units::deg(2));
+
+    footprint.update(shapes, 0, steps, {50, 50}, units::deg(10), size);
+    EXPECT_TRUE(footprint.isRasterized());
+
+    footprint.update(shapes, 0, steps, {50, 50}, units::deg(11), size);
+    EXPECT_FALSE(footprint.isRasterized());
+
+    footprint.update(shapes, 0, steps, {50, 50}, units::deg(13), size);
+    EXPECT_TRUE(footprint.isRasterized());
+}
+
+/* ************************************************************************ */
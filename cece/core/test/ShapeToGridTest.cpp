@@ -0,0 +1,295 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// C++
+#include <set>
+#include <utility>
+#include <algorithm>
+#include <tuple>
+
+// CeCe
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/ShapeToGrid.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+using CoordinateType = Vector<unsigned int>;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Map shape into 100x100 grid and return sorted inner coordinates.
+ */
+DynamicArray<CoordinateType> map(const Shape& shape, units::Angle rotation,
+    CoordinateType center = {50, 50})
+{
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    DynamicArray<CoordinateType> coords;
+
+    mapShapeToGrid(
+        [&coords] (CoordinateType&& coord) { coords.push_back(coord); },
+        [] (CoordinateType&&) {},
+        shape, steps, center, rotation, CoordinateType{100, 100}
+    );
+
+    std::sort(coords.begin(), coords.end(), [] (const CoordinateType& lhs, const CoordinateType& rhs) {
+        return std::make_pair(lhs.getY(), lhs.getX()) < std::make_pair(rhs.getY(), rhs.getX());
+    });
+
+    return coords;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Check if spans cover the same cells as per-cell mapping.
+ */
+void checkSpans(const Shape& shape, units::Angle rotation, CoordinateType center)
+{
+    const units::SizeVector steps{units::um(1), units::um(1)};
+    const CoordinateType max{100, 80};
+    const CoordinateType min{5, 10};
+
+    std::set<std::pair<unsigned int, unsigned int>> cells;
+    std::set<std::pair<unsigned int, unsigned int>> spans;
+
+    mapShapeToGrid(
+        [&cells] (CoordinateType&& coord) { cells.emplace(coord.getX(), coord.getY()); },
+        [] (CoordinateType&&) {},
+        shape, steps, center, rotation, max, min
+    );
+
+    mapShapeSpansToGrid([&spans, &min, &max] (unsigned int y, unsigned int begin, unsigned int end) {
+        ASSERT_LT(begin, end);
+        ASSERT_GE(begin, min.getX());
+        ASSERT_LE(end, max.getX());
+        ASSERT_GE(y, min.getY());
+        ASSERT_LT(y, max.getY());
+
+        for (auto x = begin; x < end; ++x)
+            EXPECT_TRUE(spans.emplace(x, y).second);
+    }, shape, steps, center, rotation, max, min);
+
+    EXPECT_EQ(cells, spans);
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeToGrid, edges)
+{
+    const auto shape = Shape::makeEdges({
+        {units::um(-10), units::um(-5)},
+        {units::um( 10), units::um(-5)},
+        {units::um( 10), units::um( 5)},
+        {units::um(-10), units::um( 5)}
+    });
+
+    const auto coords = map(shape, Zero);
+    ASSERT_EQ(200u, coords.size());
+
+    for (const auto& coord : coords)
+    {
+        EXPECT_GE(coord.getX(), 40u);
+        EXPECT_LT(coord.getX(), 60u);
+        EXPECT_GE(coord.getY(), 46u);
+        EXPECT_LT(coord.getY(), 56u);
+    }
+
+    // Only rows inside of the grid are visited
+    EXPECT_EQ(160u, map(shape, Zero, {50, 96}).size());
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeToGrid, edgesRotation)
+{
+    const auto shape = Shape::makeEdges({
+        {units::um(-20), units::um(-4)},
+        {units::um( 20), units::um(-4)},
+        {units::um( 20), units::um( 4)},
+        {units::um(-20), units::um( 4)}
+    });
+
+    const auto coords = map(shape, units::deg(90));
+    ASSERT_FALSE(coords.empty());
+
+    // Polygon is vertical after rotation
+    const auto minmaxX = std::minmax_element(coords.begin(), coords.end(),
+        [] (const CoordinateType& lhs, const CoordinateType& rhs) { return lhs.getX() < rhs.getX(); });
+    const auto minmaxY = std::minmax_element(coords.begin(), coords.end(),
+        [] (const CoordinateType& lhs, const CoordinateType& rhs) { return lhs.getY() < rhs.getY(); });
+
+    EXPECT_LE(minmaxX.second->getX() - minmaxX.first->getX(), 9u);
+    EXPECT_GE(minmaxY.second->getY() - minmaxY.first->getY(), 38u);
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeToGrid, rectangleRotation)
+{
+    const auto shape = Shape::makeRectangle({units::um(30), units::um(10)});
+
+    EXPECT_NEAR(300, static_cast<int>(map(shape, Zero).size()), 30);
+
+    for (int angle : {15, 30, 45, 60, 90})
+    {
+        const auto count = map(shape, units::deg(angle)).size();
+
+        // Area is kept up to rasterization error
+        EXPECT_NEAR(300, static_cast<int>(count), 40) << angle;
+    }
+
+    // Rotation by 90 degrees swaps rectangle sides
+    const auto coords = map(shape, units::deg(90));
+    const auto minmaxX = std::minmax_element(coords.begin(), coords.end(),
+        [] (const CoordinateType& lhs, const CoordinateType& rhs) { return lhs.getX() < rhs.getX(); });
+
+    EXPECT_LE(minmaxX.second->getX() - minmaxX.first->getX(), 11u);
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeToGrid, spans)
+{
+    const Shape shapes[] = {
+        Shape::makeCircle(units::um(13.7)),
+        Shape::makeCircle(units::um(4), {units::um(3), units::um(-2)}),
+        Shape::makeRectangle({units::um(21), units::um(9)}),
+        Shape::makeEdges({
+            {units::um(-12.5), units::um(-7)},
+            {units::um( 11), units::um(-9.3)},
+            {units::um( 3), units::um( 1)},
+            {units::um( 14), units::um( 12)},
+            {units::um(-10), units::um( 8.2)}
+        })
+    };
+
+    const CoordinateType centers[] = {{50, 40}, {3, 12}, {98, 79}, {60, 5}};
+
+    for (const auto& shape : shapes)
+    {
+        for (const auto& center : centers)
+        {
+            for (int angle : {0, 20, 90, 135})
+                checkSpans(shape, units::deg(angle), center);
+        }
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeToGrid, sphere)
+{
+    using Coordinate3 = BasicVector<unsigned int, 3>;
+
+    const BasicVector<units::Length, 3> steps{units::um(1), units::um(1), units::um(1)};
+    const Coordinate3 center{20, 20, 10};
+    const Coordinate3 max{40, 40, 40};
+
+    ShapeSphere sphere;
+    sphere.radius = units::um(8);
+
+    std::set<std::tuple<unsigned int, unsigned int, unsigned int>> cells;
+    unsigned int outside = 0;
+
+    mapShapeToGrid(
+        [&cells] (Coordinate3&& coord) { EXPECT_TRUE(cells.emplace(coord.getX(), coord.getY(), coord.getZ()).second); },
+        [&outside] (Coordinate3&&) { ++outside; },
+        sphere, steps, center, max
+    );
+
+    // Same cells as testing whole bounding cube
+    std::set<std::tuple<unsigned int, unsigned int, unsigned int>> expected;
+
+    for (int z = -8; z < 8; ++z)
+    {
+        for (int y = -8; y < 8; ++y)
+        {
+            for (int x = -8; x < 8; ++x)
+            {
+                const RealType lx = x / RealType(8);
+                const RealType ly = y / RealType(8);
+                const RealType lz = z / RealType(8);
+
+                if (lx * lx + (ly * ly + lz * lz) <= 1)
+                    expected.emplace(20 + x, 20 + y, 10 + z);
+            }
+        }
+    }
+
+    EXPECT_EQ(expected, cells);
+    EXPECT_EQ(0u, outside);
+
+    // Volume
+    EXPECT_NEAR(4.0 / 3.0 * 3.14159 * 512, static_cast<double>(cells.size()), 150);
+
+    // Clipped by grid
+    DynamicArray<Coordinate3> clipped;
+    mapShapeToGrid(std::back_inserter(clipped), sphere, steps, center, max, Coordinate3{0, 0, 10});
+    EXPECT_EQ(std::count_if(cells.begin(), cells.end(), [] (const std::tuple<unsigned int, unsigned int, unsigned int>& cell) {
+        return std::get<2>(cell) >= 10;
+    }), static_cast<long>(clipped.size()));
+}
+
+/* ************************************************************************ */
+
+TEST(ShapeToGrid, box)
+{
+    using Coordinate3 = BasicVector<unsigned int, 3>;
+
+    const BasicVector<units::Length, 3> steps{units::um(1), units::um(1), units::um(1)};
+
+    ShapeBox box;
+    box.size = {units::um(10), units::um(6), units::um(4)};
+
+    DynamicArray<Coordinate3> cells;
+    mapShapeToGrid(std::back_inserter(cells), box, steps, Coordinate3{10, 10, 10}, Coordinate3{20, 20, 20});
+
+    EXPECT_EQ(240u, cells.size());
+
+    for (const auto& cell : cells)
+    {
+        EXPECT_TRUE(cell.inRange(Coordinate3{5, 7, 8}, Coordinate3{15, 13, 12}));
+    }
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,143 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/SparseGrid.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+TEST(SparseGrid, access)
+{
+    SparseGrid<int, 8> grid(Vector<unsigned int>{100, 50}, -1);
+    const auto& cgrid = grid;
+
+    EXPECT_EQ((Vector<unsigned int>{13, 7}), grid.getBlocksSize());
+    EXPECT_EQ(0u, grid.getBlockCount());
+    EXPECT_EQ(-1, (cgrid[{10, 10}]));
+    EXPECT_EQ(0u, grid.getBlockCount());
+
+    grid[{10, 10}] = 5;
+    EXPECT_EQ(1u, grid.getBlockCount());
+    EXPECT_TRUE(grid.isAllocated({15, 8}));
+    EXPECT_FALSE(grid.isAllocated({16, 8}));
+    EXPECT_EQ(5, (cgrid[{10, 10}]));
+    EXPECT_EQ(-1, (cgrid[{11, 10}]));
+
+    // References stay valid after allocating other blocks
+    int& ref = grid[{10, 10}];
+    grid[{99, 49}] = 3;
+    grid[{0, 0}] = 2;
+    EXPECT_EQ(3u, grid.getBlockCount());
+    EXPECT_EQ(5, ref);
+    EXPECT_EQ(3, (cgrid[{99, 49}]));
+}
+
+/* ************************************************************************ */
+
+TEST(SparseGrid, read)
+{
+    SparseGrid<int, 8> grid(Vector<unsigned int>{32, 32}, -1);
+
+    // Reading doesn't allocate
+    EXPECT_EQ(-1, (grid.get({3, 3})));
+    EXPECT_EQ(nullptr, (grid.find({3, 3})));
+    EXPECT_EQ(0u, grid.getBlockCount());
+
+    // Background value is not stored
+    grid.set({3, 3}, -1);
+    EXPECT_EQ(0u, grid.getBlockCount());
+
+    grid.set({3, 3}, 4);
+    EXPECT_EQ(1u, grid.getBlockCount());
+    ASSERT_NE(nullptr, (grid.find({3, 3})));
+    EXPECT_EQ(4, *grid.find({3, 3}));
+    EXPECT_EQ(-1, *grid.find({4, 3}));
+
+    // Allocated cell is overwritten with background value
+    grid.set({3, 3}, -1);
+    EXPECT_EQ(1u, grid.getBlockCount());
+    EXPECT_EQ(-1, (grid.get({3, 3})));
+}
+
+/* ************************************************************************ */
+
+TEST(SparseGrid, release)
+{
+    SparseGrid<int, 4> grid(Vector<unsigned int>{16, 16});
+
+    grid[{0, 0}] = 1;
+    grid[{5, 0}] = 2;
+    grid[{9, 9}] = 3;
+
+    grid.release({0, 0});
+    EXPECT_EQ(2u, grid.getBlockCount());
+    EXPECT_EQ(0, (grid.get({0, 0})));
+    EXPECT_EQ(2, (grid.get({5, 0})));
+    EXPECT_EQ(3, (grid.get({9, 9})));
+
+    // Unused block
+    grid[{12, 12}] = 0;
+    EXPECT_EQ(3u, grid.getBlockCount());
+    EXPECT_EQ(1u, grid.prune());
+    EXPECT_EQ(2u, grid.getBlockCount());
+    EXPECT_FALSE(grid.isAllocated({12, 12}));
+
+    grid.clear();
+    EXPECT_EQ(0u, grid.getBlockCount());
+    EXPECT_EQ(0, (grid.get({5, 0})));
+}
+
+/* ************************************************************************ */
+
+TEST(SparseGrid, forEach)
+{
+    // Size is not multiple of block size
+    SparseGrid<int, 4> grid(Vector<unsigned int>{10, 6});
+
+    grid[{9, 5}] = 1;
+    grid[{1, 1}] = 2;
+
+    unsigned int count = 0;
+    int sum = 0;
+
+    grid.forEach([&] (const Vector<unsigned int>& coord, int& value) {
+        EXPECT_TRUE(grid.inRange(coord));
+        ++count;
+        sum += value;
+    });
+
+    // Block (0, 0) has 16 cells, block (2, 1) is clipped to 2x2
+    EXPECT_EQ(20u, count);
+    EXPECT_EQ(3, sum);
+}
+
+/* ************************************************************************ */
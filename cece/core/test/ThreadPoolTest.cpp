@@ -0,0 +1,100 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// C++
+#include <stdexcept>
+
+// CeCe
+#include "cece/core/Atomic.hpp"
+#include "cece/core/ThreadPool.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+TEST(ThreadPool, run)
+{
+    ThreadPool pool(4);
+    EXPECT_EQ(4u, pool.getThreadCount());
+
+    DynamicArray<int> values(1000, 0);
+
+    pool.run(values.size(), [&values] (std::size_t i) {
+        values[i] += static_cast<int>(i);
+    });
+
+    for (std::size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(static_cast<int>(i), values[i]);
+
+    // Pool is reusable
+    for (int i = 0; i < 100; ++i)
+    {
+        Atomic<int> count{0};
+        pool.run(17, [&count] (std::size_t) { ++count; });
+        EXPECT_EQ(17, count);
+    }
+}
+
+/* ************************************************************************ */
+
+TEST(ThreadPool, nested)
+{
+    ThreadPool pool(3);
+    Atomic<int> count{0};
+
+    pool.run(8, [&] (std::size_t) {
+        pool.run(8, [&count] (std::size_t) { ++count; });
+    });
+
+    EXPECT_EQ(64, count);
+}
+
+/* ************************************************************************ */
+
+TEST(ThreadPool, exception)
+{
+    ThreadPool pool(2);
+    Atomic<int> count{0};
+
+    EXPECT_THROW(pool.run(10, [&count] (std::size_t i) {
+        ++count;
+
+        if (i == 5)
+            throw std::runtime_error("task failed");
+    }), std::runtime_error);
+
+    // All tasks are still executed
+    EXPECT_EQ(10, count);
+
+    pool.run(3, [&count] (std::size_t) { ++count; });
+    EXPECT_EQ(13, count);
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,188 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/Units.hpp"
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/VectorArray.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+TEST(VectorArray, access)
+{
+    VectorArray<RealType> array;
+    EXPECT_TRUE(array.isEmpty());
+
+    for (int i = 0; i < 37; ++i)
+        array.push({RealType(i), RealType(-i)});
+
+    ASSERT_EQ(37u, array.getSize());
+    EXPECT_EQ((Vector<RealType>{5, -5}), array[5]);
+    EXPECT_EQ(RealType(7), array.getComponent(0)[7]);
+    EXPECT_EQ(RealType(-7), array.getComponent(1)[7]);
+
+    array.set(3, {1, 2});
+    EXPECT_EQ((Vector<RealType>{1, 2}), array.get(3));
+
+    array.resize(40, {9, 9});
+    EXPECT_EQ((Vector<RealType>{9, 9}), array[39]);
+    EXPECT_EQ((Vector<RealType>{36, -36}), array[36]);
+
+    array.fill({1, -1});
+
+    for (std::size_t i = 0; i < array.getSize(); ++i)
+        EXPECT_EQ((Vector<RealType>{1, -1}), array[i]);
+
+    array.clear();
+    EXPECT_TRUE(array.isEmpty());
+}
+
+/* ************************************************************************ */
+
+TEST(VectorArray, arithmetic)
+{
+    VectorArray<RealType> a(35, {1, 2});
+    VectorArray<RealType> b(35);
+
+    for (std::size_t i = 0; i < b.getSize(); ++i)
+        b.set(i, {RealType(i), 1});
+
+    a += b;
+    EXPECT_EQ((Vector<RealType>{21, 3}), a[20]);
+
+    a -= b;
+    EXPECT_EQ((Vector<RealType>{1, 2}), a[20]);
+
+    a *= 3;
+    EXPECT_EQ((Vector<RealType>{3, 6}), a[34]);
+
+    a /= 3;
+    EXPECT_EQ((Vector<RealType>{1, 2}), a[34]);
+
+    a.addScaled(b, RealType(0.5));
+    EXPECT_EQ((Vector<RealType>{9, 2.5}), a[16]);
+}
+
+/* ************************************************************************ */
+
+TEST(VectorArray, length)
+{
+    VectorArray<RealType> a;
+    a.push({3, 4});
+    a.push({0, 0});
+    a.push({-6, 8});
+
+    for (int i = 0; i < 20; ++i)
+        a.push({RealType(i), RealType(1)});
+
+    VectorArray<RealType> b(a.getSize(), {1, 1});
+
+    RealType out[23];
+
+    dot(a, b, out);
+    EXPECT_EQ(RealType(7), out[0]);
+    EXPECT_EQ(RealType(2), out[2]);
+
+    getLengthSquared(a, out);
+    EXPECT_EQ(RealType(25), out[0]);
+    EXPECT_EQ(RealType(100), out[2]);
+
+    getLength(a, out);
+    EXPECT_EQ(RealType(5), out[0]);
+    EXPECT_EQ(RealType(0), out[1]);
+    EXPECT_EQ(RealType(10), out[2]);
+
+    for (std::size_t i = 0; i < a.getSize(); ++i)
+        EXPECT_DOUBLE_EQ(a[i].getLength(), out[i]);
+
+    VectorArray<RealType> n;
+    normalize(a, n);
+    ASSERT_EQ(a.getSize(), n.getSize());
+    EXPECT_DOUBLE_EQ(RealType(0.6), n[0].getX());
+    EXPECT_DOUBLE_EQ(RealType(0.8), n[0].getY());
+    EXPECT_EQ((Vector<RealType>{0, 0}), n[1]);
+    EXPECT_DOUBLE_EQ(RealType(-0.6), n[2].getX());
+
+    for (std::size_t i = 3; i < n.getSize(); ++i)
+        EXPECT_NEAR(1, n[i].getLength(), 1e-6);
+}
+
+/* ************************************************************************ */
+
+TEST(VectorArray, gatherScatter)
+{
+    VectorArray<int> a;
+
+    for (int i = 0; i < 50; ++i)
+        a.push({i, i * 10});
+
+    const unsigned int indices[] = {40, 2, 17, 17, 0};
+
+    VectorArray<int> b;
+    b.gather(a, indices, 5);
+    ASSERT_EQ(5u, b.getSize());
+    EXPECT_EQ((Vector<int>{40, 400}), b[0]);
+    EXPECT_EQ((Vector<int>{17, 170}), b[3]);
+    EXPECT_EQ((Vector<int>{0, 0}), b[4]);
+
+    b *= 2;
+
+    const unsigned int targets[] = {1, 3, 5, 7, 9};
+    b.scatter(a, targets);
+    EXPECT_EQ((Vector<int>{80, 800}), a[1]);
+    EXPECT_EQ((Vector<int>{2, 20}), a[2]);
+    EXPECT_EQ((Vector<int>{0, 0}), a[9]);
+}
+
+/* ************************************************************************ */
+
+TEST(VectorArray, units)
+{
+    VectorArray<units::Length> position(20, {units::um(1), units::um(2)});
+    VectorArray<units::Velocity> velocity(20, {units::um_s(3), units::um_s(4)});
+
+    position.addScaled(velocity, units::s(2));
+    EXPECT_DOUBLE_EQ(units::um(7).value(), position[10].getX().value());
+    EXPECT_DOUBLE_EQ(units::um(10).value(), position[10].getY().value());
+
+    units::Velocity speed[20];
+    getLength(velocity, speed);
+    EXPECT_DOUBLE_EQ(units::um_s(5).value(), speed[19].value());
+
+    VectorArray<RealType> direction;
+    normalize(velocity, direction);
+    EXPECT_DOUBLE_EQ(RealType(0.6), direction[0].getX());
+    EXPECT_DOUBLE_EQ(RealType(0.8), direction[0].getY());
+}
+
+/* ************************************************************************ */
@@ -30,6 +30,7 @@
 #include <algorithm>
 
 // CeCe
+#include "cece/core/Profiler.hpp"
 #include "cece/module/Module.hpp"
 
 /* ************************************************************************ */
@@ -57,7 +58,10 @@ void Container::update()
 {
     // Update modules
     for (auto& module : getSortedListAsc())
+    {
+        ProfilerScope _("module:", Profiler::isEnabled() ? getName(module) : StringView{});
         module->update();
+    }
 }
 
 /* ************************************************************************ */
@@ -121,6 +125,19 @@ void Container::drawSwapState()
 
 /* ************************************************************************ */
 
+StringView Container::getName(ViewPtr<Module> module) const noexcept
+{
+    for (const auto& record : *this)
+    {
+        if (record.object == module)
+            return record.name;
+    }
+
+    return {};
+}
+
+/* ************************************************************************ */
+
 DynamicArray<ViewPtr<Module>> Container::getSortedListAsc() const noexcept
 {
     DynamicArray<ViewPtr<Module>> modules;
@@ -116,6 +116,16 @@ public:
 protected:
 
 
+    /**
+     * @brief Returns name of stored module.
+     *
+     * @param module Module.
+     *
+     * @return Module name or empty string if module is not stored.
+     */
+    StringView getName(ViewPtr<Module> module) const noexcept;
+
+
     /**
      * @brief Returns sorted list of modules by priority.
      *
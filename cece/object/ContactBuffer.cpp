@@ -0,0 +1,108 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/object/ContactBuffer.hpp"
+
+// C++
+#include <algorithm>
+
+// CeCe
+#include "cece/object/Object.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace object {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns if type name matches filter.
+ *
+ * @param filter Filter type name, empty matches anything.
+ * @param name   Object type name.
+ *
+ * @return
+ */
+bool match(const String& filter, StringView name) noexcept
+{
+    return filter.empty() || StringView(filter) == name;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+bool ContactBuffer::accepts(const Object& first, const Object& second) const noexcept
+{
+    if (m_filters.empty())
+        return true;
+
+    const auto name1 = first.getTypeName();
+    const auto name2 = second.getTypeName();
+
+    for (const auto& filter : m_filters)
+    {
+        if (match(filter.first, name1) && match(filter.second, name2))
+            return true;
+
+        if (match(filter.first, name2) && match(filter.second, name1))
+            return true;
+    }
+
+    return false;
+}
+
+/* ************************************************************************ */
+
+void ContactBuffer::removeObjects(DynamicArray<const Object*> objects)
+{
+    if (objects.empty() || m_events.empty())
+        return;
+
+    std::sort(objects.begin(), objects.end());
+
+    const auto contains = [&objects] (ViewPtr<Object> object) {
+        return std::binary_search(objects.begin(), objects.end(), object.get());
+    };
+
+    m_events.erase(std::remove_if(m_events.begin(), m_events.end(), [&contains] (const ContactEvent& event) {
+        return contains(event.first) || contains(event.second);
+    }), m_events.end());
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,321 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+#include <utility>
+
+// CeCe
+#include "cece/core/Assert.hpp"
+#include "cece/core/Real.hpp"
+#include "cece/core/String.hpp"
+#include "cece/core/StringView.hpp"
+#include "cece/core/Units.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/ViewPtr.hpp"
+#include "cece/core/DynamicArray.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace object {
+
+/* ************************************************************************ */
+
+class Object;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Contact between two objects.
+ */
+struct ContactEvent
+{
+    /**
+     * @brief Event types.
+     */
+    enum class Type
+    {
+        /// Objects started touching.
+        Begin,
+
+        /// Objects stopped touching.
+        End
+    };
+
+    /// Event type.
+    Type type;
+
+    /// The first object.
+    ViewPtr<Object> first;
+
+    /// The second object.
+    ViewPtr<Object> second;
+
+    /// Contact normal in world coordinates, points from first to second.
+    Vector<RealType> normal;
+
+    /// Normal impulse applied by solver in the step contact began, zero
+    /// for end events and sensors.
+    units::ImpulseVector impulse;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Buffer of contact events of single simulation step.
+ *
+ * Physics engine records contacts into the buffer during step and
+ * consumers read them after the step, so no user code runs inside the
+ * solver. Events are kept until the next step, events of removed objects
+ * are dropped with them. Recording can be limited to contacts between
+ * given object types.
+ *
+ * Events are recorded only while the buffer has registered consumers, each
+ * consumer registers itself with addConsumer() and unregisters with
+ * removeConsumer() when it's no longer interested.
+ */
+class ContactBuffer
+{
+
+// Public Types
+public:
+
+
+    /// Events container type.
+    using ContainerType = DynamicArray<ContactEvent>;
+
+    /// Events iterator.
+    using ConstIterator = ContainerType::const_iterator;
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns if events are recorded.
+     *
+     * @return
+     */
+    bool isEnabled() const noexcept
+    {
+        return m_consumers != 0;
+    }
+
+
+    /**
+     * @brief Returns number of registered consumers.
+     *
+     * @return
+     */
+    unsigned int getConsumerCount() const noexcept
+    {
+        return m_consumers;
+    }
+
+
+    /**
+     * @brief Returns recorded events.
+     *
+     * @return
+     */
+    const ContainerType& getEvents() const noexcept
+    {
+        return m_events;
+    }
+
+
+    /**
+     * @brief Returns number of recorded events.
+     *
+     * @return
+     */
+    std::size_t getCount() const noexcept
+    {
+        return m_events.size();
+    }
+
+
+    /**
+     * @brief Returns begin iterator.
+     *
+     * @return
+     */
+    ConstIterator begin() const noexcept
+    {
+        return m_events.begin();
+    }
+
+
+    /**
+     * @brief Returns end iterator.
+     *
+     * @return
+     */
+    ConstIterator end() const noexcept
+    {
+        return m_events.end();
+    }
+
+
+    /**
+     * @brief Returns if contact between objects passes type filters.
+     *
+     * Without filters all contacts pass.
+     *
+     * @param first  The first object.
+     * @param second The second object.
+     *
+     * @return
+     */
+    bool accepts(const Object& first, const Object& second) const noexcept;
+
+
+// Public Mutators
+public:
+
+
+    /**
+     * @brief Register events consumer, recording is enabled.
+     */
+    void addConsumer() noexcept
+    {
+        ++m_consumers;
+    }
+
+
+    /**
+     * @brief Unregister events consumer. Recording is disabled and events
+     * are removed when the last consumer is gone.
+     */
+    void removeConsumer() noexcept
+    {
+        CECE_ASSERT(m_consumers > 0);
+
+        if (--m_consumers == 0)
+            m_events.clear();
+    }
+
+
+    /**
+     * @brief Record only contacts between given object types.
+     *
+     * Filters are symmetric and multiple filters are combined, contact is
+     * recorded if it passes any of them. Empty type name matches any type.
+     *
+     * @param first  The first object type name.
+     * @param second The second object type name.
+     */
+    void addFilter(String first, String second)
+    {
+        m_filters.emplace_back(std::move(first), std::move(second));
+    }
+
+
+    /**
+     * @brief Remove all type filters.
+     */
+    void clearFilters() noexcept
+    {
+        m_filters.clear();
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Record event.
+     *
+     * @param event
+     *
+     * @return Event index.
+     */
+    std::size_t push(const ContactEvent& event)
+    {
+        m_events.push_back(event);
+        return m_events.size() - 1;
+    }
+
+
+    /**
+     * @brief Add impulse to recorded event.
+     *
+     * @param index   Event index.
+     * @param impulse Impulse.
+     */
+    void addImpulse(std::size_t index, const units::ImpulseVector& impulse) noexcept
+    {
+        m_events[index].impulse += impulse;
+    }
+
+
+    /**
+     * @brief Remove events of given objects.
+     *
+     * It must be called before the objects are destroyed, events would
+     * point to freed objects.
+     *
+     * @param objects Objects.
+     */
+    void removeObjects(DynamicArray<const Object*> objects);
+
+
+    /**
+     * @brief Remove recorded events.
+     */
+    void clear() noexcept
+    {
+        m_events.clear();
+    }
+
+
+// Private Data Members
+private:
+
+    /// Number of registered consumers, events are recorded if non-zero.
+    unsigned int m_consumers = 0;
+
+    /// Recorded events.
+    ContainerType m_events;
+
+    /// Type filters.
+    DynamicArray<std::pair<String, String>> m_filters;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -38,6 +38,9 @@ class Object;
 
 /**
  * @brief Object contact listener.
+ *
+ * Listeners are notified after physics step about contacts which began
+ * during the step, use ContactBuffer for other event data.
  */
 class ContactListener
 {
@@ -0,0 +1,160 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// CeCe
+#include "cece/core/Map.hpp"
+#include "cece/core/Units.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/ShapeFootprint.hpp"
+#include "cece/object/Object.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace object {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Cache of object footprints in a grid.
+ *
+ * Modules which map objects into their grid every step keep one cache and
+ * call update() for each object instead of rasterizing object shapes again.
+ * Footprint is rasterized only when object shapes (Object::setShapes),
+ * rotation or the grid change; otherwise it's translated.
+ */
+class FootprintCache
+{
+
+// Public Types
+public:
+
+
+    /// Grid coordinates type.
+    using CoordinateType = ShapeFootprint::CoordinateType;
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns number of cached footprints.
+     *
+     * @return
+     */
+    std::size_t getSize() const noexcept
+    {
+        return m_footprints.size();
+    }
+
+
+    /**
+     * @brief Returns maximum rotation change which doesn't require
+     * rasterization.
+     *
+     * @return
+     */
+    units::Angle getRotationTolerance() const noexcept
+    {
+        return m_rotationTolerance;
+    }
+
+
+// Public Mutators
+public:
+
+
+    /**
+     * @brief Set maximum rotation change which doesn't require rasterization.
+     *
+     * @param tolerance
+     */
+    void setRotationTolerance(units::Angle tolerance) noexcept
+    {
+        m_rotationTolerance = tolerance;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Update object footprint.
+     *
+     * @param object Object.
+     * @param steps  Grid cell size.
+     * @param center Object center in grid coordinates.
+     * @param size   Grid size.
+     *
+     * @return Updated footprint with entered and left cells.
+     */
+    const ShapeFootprint& update(const Object& object, const units::SizeVector& steps,
+        const CoordinateType& center, const CoordinateType& size);
+
+
+    /**
+     * @brief Remove object footprint.
+     *
+     * @param id Object ID.
+     */
+    void erase(Object::IdType id)
+    {
+        m_footprints.erase(id);
+    }
+
+
+    /**
+     * @brief Remove all footprints.
+     */
+    void clear()
+    {
+        m_footprints.clear();
+    }
+
+
+// Private Data Members
+private:
+
+    /// Footprints by object ID.
+    Map<Object::IdType, ShapeFootprint> m_footprints;
+
+    /// Maximum rotation change which doesn't require rasterization.
+    units::Angle m_rotationTolerance = Zero;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
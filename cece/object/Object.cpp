@@ -38,9 +38,11 @@
 #include "cece/core/UnitIo.hpp"
 #include "cece/core/Log.hpp"
 #include "cece/core/Real.hpp"
+#include "cece/core/constants.hpp"
 #include "cece/core/FileStream.hpp"
 #include "cece/config/Configuration.hpp"
 #include "cece/plugin/Context.hpp"
+#include "cece/object/StateSnapshot.hpp"
 #include "cece/simulator/Simulation.hpp"
 #include "cece/simulator/ConverterBox2D.hpp"
 
@@ -114,6 +116,10 @@ Object::Object(simulator::Simulation& simulation, String typeName, Type type) no
     , m_id(++s_id)
     , m_type(type)
 {
+    // State is kept in object
+    if (!getSimulation().usesBodies())
+        return;
+
     auto& world = getSimulation().getWorld();
 
     b2BodyDef bodyDef;
@@ -142,6 +148,12 @@ Object::Object(simulator::Simulation& simulation, String typeName, Type type) no
 
 Object::~Object()
 {
+    if (m_snapshot)
+        m_snapshot->detach(m_snapshotIndex);
+
+    if (!m_body)
+        return;
+
     auto& world = getSimulation().getWorld();
 
     // Pin the body
@@ -159,7 +171,12 @@ Object::~Object()
 
 units::PositionVector Object::getPosition() const noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+        return m_snapshot->getPosition(m_snapshotIndex);
+
+    if (!m_body)
+        return m_position;
+
     return simulator::ConverterBox2D::getInstance().convertPosition(m_body->GetPosition());
 }
 
@@ -167,7 +184,12 @@ units::PositionVector Object::getPosition() const noexcept
 
 units::PositionVector Object::getMassCenterPosition() const noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+        return getWorldPosition(m_snapshot->getMassCenterOffset(m_snapshotIndex));
+
+    if (!m_body)
+        return getWorldPosition(m_massCenter);
+
     return simulator::ConverterBox2D::getInstance().convertPosition(m_body->GetWorldCenter());
 }
 
@@ -175,7 +197,12 @@ units::PositionVector Object::getMassCenterPosition() const noexcept
 
 units::PositionVector Object::getMassCenterOffset() const noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+        return m_snapshot->getMassCenterOffset(m_snapshotIndex);
+
+    if (!m_body)
+        return m_massCenter;
+
     return simulator::ConverterBox2D::getInstance().convertPosition(m_body->GetLocalCenter());
 }
 
@@ -183,7 +210,15 @@ units::PositionVector Object::getMassCenterOffset() const noexcept
 
 units::PositionVector Object::getWorldPosition(units::PositionVector local) const noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+    {
+        return m_snapshot->getPosition(m_snapshotIndex) +
+            local.rotated(m_snapshot->getRotation(m_snapshotIndex));
+    }
+
+    if (!m_body)
+        return m_position + local.rotated(m_rotation);
+
     return simulator::ConverterBox2D::getInstance().convertPosition(
         m_body->GetWorldPoint(simulator::ConverterBox2D::getInstance().convertPosition(local))
     );
@@ -193,7 +228,12 @@ units::PositionVector Object::getWorldPosition(units::PositionVector local) cons
 
 units::Angle Object::getRotation() const noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+        return m_snapshot->getRotation(m_snapshotIndex);
+
+    if (!m_body)
+        return m_rotation;
+
     return simulator::ConverterBox2D::getInstance().convertAngle(m_body->GetAngle());
 }
 
@@ -201,7 +241,12 @@ units::Angle Object::getRotation() const noexcept
 
 units::VelocityVector Object::getVelocity() const noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+        return m_snapshot->getVelocity(m_snapshotIndex);
+
+    if (!m_body)
+        return m_velocity;
+
     return simulator::ConverterBox2D::getInstance().convertLinearVelocity(m_body->GetLinearVelocity());
 }
 
@@ -209,7 +254,12 @@ units::VelocityVector Object::getVelocity() const noexcept
 
 units::AngularVelocity Object::getAngularVelocity() const noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+        return m_snapshot->getAngularVelocity(m_snapshotIndex);
+
+    if (!m_body)
+        return m_angularVelocity;
+
     return simulator::ConverterBox2D::getInstance().convertAngularVelocity(m_body->GetAngularVelocity());
 }
 
@@ -217,7 +267,9 @@ units::AngularVelocity Object::getAngularVelocity() const noexcept
 
 units::Mass Object::getMass() const noexcept
 {
-    CECE_ASSERT(m_body);
+    if (!m_body)
+        return m_mass;
+
     return simulator::ConverterBox2D::getInstance().convertMass(m_body->GetMass());
 }
 
@@ -245,15 +297,43 @@ DynamicArray<ViewPtr<Object>> Object::getBoundObjects() const noexcept
 void Object::setType(Type type) noexcept
 {
     m_type = type;
-    CECE_ASSERT(m_body);
+
+    if (!m_body)
+    {
+        // Static bodies don't move, same as in Box2D
+        if (type == Type::Static)
+        {
+            setVelocity(Zero);
+            setAngularVelocity(Zero);
+        }
+
+        return;
+    }
+
+    syncBody();
     m_body->SetType(convert(type));
+
+    // Changing type resets velocities
+    if (m_snapshot)
+        m_snapshot->capture(m_snapshotIndex, *m_body);
 }
 
 /* ************************************************************************ */
 
 void Object::setPosition(units::PositionVector pos) noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+    {
+        m_snapshot->setPosition(m_snapshotIndex, pos);
+        return;
+    }
+
+    if (!m_body)
+    {
+        m_position = pos;
+        return;
+    }
+
     m_body->SetTransform(simulator::ConverterBox2D::getInstance().convertPosition(pos), m_body->GetAngle());
 
     if (m_pinBody)
@@ -264,7 +344,18 @@ void Object::setPosition(units::PositionVector pos) noexcept
 
 void Object::setRotation(units::Angle angle) noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+    {
+        m_snapshot->setRotation(m_snapshotIndex, angle);
+        return;
+    }
+
+    if (!m_body)
+    {
+        m_rotation = angle;
+        return;
+    }
+
     m_body->SetTransform(m_body->GetPosition(), simulator::ConverterBox2D::getInstance().convertAngle(angle));
 }
 
@@ -272,7 +363,18 @@ void Object::setRotation(units::Angle angle) noexcept
 
 void Object::setVelocity(units::VelocityVector vel) noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+    {
+        m_snapshot->setVelocity(m_snapshotIndex, vel);
+        return;
+    }
+
+    if (!m_body)
+    {
+        m_velocity = vel;
+        return;
+    }
+
     m_body->SetLinearVelocity(simulator::ConverterBox2D::getInstance().convertLinearVelocity(vel));
 }
 
@@ -280,7 +382,18 @@ void Object::setVelocity(units::VelocityVector vel) noexcept
 
 void Object::setAngularVelocity(units::AngularVelocity vel) noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+    {
+        m_snapshot->setAngularVelocity(m_snapshotIndex, vel);
+        return;
+    }
+
+    if (!m_body)
+    {
+        m_angularVelocity = vel;
+        return;
+    }
+
     m_body->SetAngularVelocity(simulator::ConverterBox2D::getInstance().convertAngularVelocity(vel));
 }
 
@@ -288,7 +401,17 @@ void Object::setAngularVelocity(units::AngularVelocity vel) noexcept
 
 void Object::applyForce(const units::ForceVector& force) noexcept
 {
-    CECE_ASSERT(m_body);
+    if (m_snapshot)
+    {
+        const auto f = simulator::ConverterBox2D::getInstance().convertForce(force);
+        m_snapshot->addForce(m_snapshotIndex, {f.x, f.y}, 0);
+        return;
+    }
+
+    // Object without body gets forces through snapshot only
+    if (!m_body)
+        return;
+
     m_body->ApplyForceToCenter(simulator::ConverterBox2D::getInstance().convertForce(force), true);
 }
 
@@ -296,34 +419,79 @@ void Object::applyForce(const units::ForceVector& force) noexcept
 
 void Object::applyForce(const units::ForceVector& force, const units::PositionVector& offset) noexcept
 {
-    CECE_ASSERT(m_body);
+    m_force += force;
+
+    if (m_snapshot)
+    {
+        const auto& converter = simulator::ConverterBox2D::getInstance();
+
+        // Torque arm from mass center in world orientation, same as Box2D
+        const auto arm = converter.convertPosition(
+            (offset - m_snapshot->getMassCenterOffset(m_snapshotIndex)).rotated(m_snapshot->getRotation(m_snapshotIndex))
+        );
+        const auto f = converter.convertForce(force);
+
+        m_snapshot->addForce(m_snapshotIndex, {f.x, f.y}, RealType(arm.x) * f.y - RealType(arm.y) * f.x);
+        return;
+    }
+
+    if (!m_body)
+        return;
+
     m_body->ApplyForce(
         simulator::ConverterBox2D::getInstance().convertForce(force),
         m_body->GetWorldPoint(simulator::ConverterBox2D::getInstance().convertPosition(offset)),
         true
     );
-
-    m_force += force;
 }
 
 /* ************************************************************************ */
 
 void Object::applyLinearImpulse(const units::ImpulseVector& impulse, const units::PositionVector& offset) noexcept
 {
-    CECE_ASSERT(m_body);
+    if (!m_body)
+    {
+        // Rotation is not simulated without body, offset doesn't matter
+        if (m_type == Type::Dynamic && m_mass > Zero)
+            setVelocity(getVelocity() + impulse / m_mass);
+
+        return;
+    }
+
+    syncBody();
     m_body->ApplyLinearImpulse(
         simulator::ConverterBox2D::getInstance().convertLinearImpulse(impulse),
         m_body->GetWorldPoint(simulator::ConverterBox2D::getInstance().convertPosition(offset)),
         true
     );
+
+    // Impulse changes velocities immediately
+    if (m_snapshot)
+        m_snapshot->capture(m_snapshotIndex, *m_body);
 }
 
 /* ************************************************************************ */
 
 void Object::applyAngularImpulse(const units::Impulse& impulse) noexcept
 {
-    CECE_ASSERT(m_body);
+    // Rotation is not simulated without body
+    if (!m_body)
+        return;
+
+    syncBody();
     m_body->ApplyAngularImpulse(simulator::ConverterBox2D::getInstance().convertAngularImpulse(impulse), true);
+
+    // Impulse changes velocities immediately
+    if (m_snapshot)
+        m_snapshot->capture(m_snapshotIndex, *m_body);
+}
+
+/* ************************************************************************ */
+
+void Object::syncBody() noexcept
+{
+    if (m_snapshot)
+        m_snapshot->apply(m_snapshotIndex);
 }
 
 /* ************************************************************************ */
@@ -349,9 +517,16 @@ void Object::destroy()
 
 void Object::createBound(Object& other, UniquePtr<BoundData> data)
 {
+    if (!m_body || !other.m_body)
+        throw RuntimeException("Object bounds require physics bodies");
+
     auto& world = getSimulation().getWorld();
     SharedPtr<BoundData> d = std::move(data);
 
+    // Joint is created from current body transforms
+    syncBody();
+    other.syncBody();
+
     b2WeldJointDef jointDef;
     jointDef.Initialize(m_body, other.m_body, m_body->GetWorldCenter());
     jointDef.userData = d.get();
@@ -480,6 +655,12 @@ void Object::configure(const config::Configuration& config, simulator::Simulatio
 
 void Object::initShapes()
 {
+    if (!m_body)
+    {
+        initMass();
+        return;
+    }
+
     // Delete old fixtures
     for (b2Fixture* fixture = getBody()->GetFixtureList();
          fixture != nullptr;
@@ -558,6 +739,41 @@ void Object::initShapes()
 
 /* ************************************************************************ */
 
+void Object::initMass() noexcept
+{
+    // Same rules as Box2D fixtures: edges have no mass and rectangles are
+    // centered at origin
+    units::Area area = Zero;
+    units::PositionVector moment = Zero;
+
+    for (const auto& shape : getShapes())
+    {
+        switch (shape.getType())
+        {
+        case ShapeType::Circle:
+        {
+            const auto& circle = shape.getCircle();
+            const units::Area circleArea = constants::PI * circle.radius * circle.radius;
+            area += circleArea;
+            moment += circle.center * circleArea.value();
+            break;
+        }
+
+        case ShapeType::Rectangle:
+            area += shape.getRectangle().size.getX() * shape.getRectangle().size.getY();
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    m_mass = units::Mass(getDensity().value() * area.value());
+    m_massCenter = area > Zero ? moment / area.value() : units::PositionVector(Zero);
+}
+
+/* ************************************************************************ */
+
 #ifdef CECE_RENDER
 void Object::draw(const simulator::Visualization&, render::Context& context)
 {
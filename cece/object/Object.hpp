@@ -73,8 +73,16 @@ namespace object {
 
 /* ************************************************************************ */
 
+class StateSnapshot;
+
+/* ************************************************************************ */
+
 /**
  * @brief Basic simulation object.
+ *
+ * Physics state getters read state snapshot captured by simulation after
+ * physics step and mutators write into it (see StateSnapshot). Objects
+ * created since the last capture access physics body directly.
  */
 class Object
 {
@@ -334,7 +342,11 @@ public:
     /**
      * @brief Returns physical body.
      *
-     * @return
+     * Body state doesn't contain pending changes from state snapshot, call
+     * syncBody() before accessing it directly.
+     *
+     * @return Body or nullptr if object was created when simulation
+     * doesn't use bodies.
      */
     b2Body* getBody() const noexcept
     {
@@ -342,6 +354,17 @@ public:
     }
 
 
+    /**
+     * @brief Returns body the pinned object is attached to.
+     *
+     * @return Pin body or nullptr if object is not pinned.
+     */
+    b2Body* getPinBody() const noexcept
+    {
+        return m_pinBody;
+    }
+
+
     /**
      * @brief Returns object shapes.
      *
@@ -358,16 +381,32 @@ public:
      *
      * This version allows to update shapes regulary without allocating new
      * memory for shapes vector and then replace the old one with the new one.
-     * Updating in place saves allocations and it's faster.
+     * Updating in place saves allocations and it's faster. Shapes are
+     * expected to change so the shapes revision is incremented.
      *
      * @return
      */
     DynamicArray<Shape>& getMutableShapes() noexcept
     {
+        ++m_shapesRevision;
         return m_shapes;
     }
 
 
+    /**
+     * @brief Returns shapes revision.
+     *
+     * Revision is changed every time the shapes are modified, it allows to
+     * cache data computed from shapes (e.g. grid footprint).
+     *
+     * @return
+     */
+    unsigned long getShapesRevision() const noexcept
+    {
+        return m_shapesRevision;
+    }
+
+
     /**
      * @brief Returns object programs.
      *
@@ -498,6 +537,21 @@ public:
     void setAngularVelocity(units::AngularVelocity vel) noexcept;
 
 
+    /**
+     * @brief Attach object to state snapshot.
+     *
+     * Called by StateSnapshot::capture().
+     *
+     * @param snapshot State snapshot.
+     * @param index    Object record index.
+     */
+    void attachSnapshot(ViewPtr<StateSnapshot> snapshot, std::size_t index) noexcept
+    {
+        m_snapshot = snapshot;
+        m_snapshotIndex = index;
+    }
+
+
     /**
      * @brief Set current force.
      *
@@ -562,6 +616,7 @@ public:
     void setShapes(DynamicArray<Shape> shapes) noexcept
     {
         m_shapes = std::move(shapes);
+        ++m_shapesRevision;
     }
 
 
@@ -684,6 +739,12 @@ public:
     }
 
 
+    /**
+     * @brief Write pending state snapshot changes into physics body.
+     */
+    void syncBody() noexcept;
+
+
     /**
      * @brief Delete object.
      *
@@ -697,6 +758,8 @@ public:
      *
      * @param other The other object.
      * @param data  Optional bind data.
+     *
+     * @throw RuntimeException When objects have no bodies.
      */
     void createBound(Object& other, UniquePtr<BoundData> data = {});
 
@@ -780,6 +843,16 @@ public:
 #endif
 
 
+// Private Operations
+private:
+
+
+    /**
+     * @brief Compute mass and mass center of object without body.
+     */
+    void initMass() noexcept;
+
+
 // Private Data Members
 private:
 
@@ -798,6 +871,9 @@ private:
     /// A list of object shapes.
     DynamicArray<Shape> m_shapes;
 
+    /// Shapes revision.
+    unsigned long m_shapesRevision = 0;
+
     /// Registered object programs.
     program::Container m_programs;
 
@@ -818,7 +894,7 @@ private:
 #endif
 
     /// Physics body.
-    b2Body* m_body;
+    b2Body* m_body = nullptr;
 
     /// Physics body for pin.
     b2Body* m_pinBody = nullptr;
@@ -835,6 +911,30 @@ private:
     /// Box2D doesn't have accessor to force.
     units::ForceVector m_force;
 
+    /// Position of object without body.
+    units::PositionVector m_position = Zero;
+
+    /// Rotation of object without body.
+    units::Angle m_rotation = Zero;
+
+    /// Linear velocity of object without body.
+    units::VelocityVector m_velocity = Zero;
+
+    /// Angular velocity of object without body.
+    units::AngularVelocity m_angularVelocity = Zero;
+
+    /// Mass of object without body, computed from shapes.
+    units::Mass m_mass = Zero;
+
+    /// Mass center local position of object without body.
+    units::PositionVector m_massCenter = Zero;
+
+    /// Physics state snapshot.
+    ViewPtr<StateSnapshot> m_snapshot;
+
+    /// Record index in physics state snapshot.
+    std::size_t m_snapshotIndex = 0;
+
     /// Outstream for object data
     UniquePtr<OutStream> m_dataOut;
 
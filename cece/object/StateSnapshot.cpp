@@ -0,0 +1,367 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/object/StateSnapshot.hpp"
+
+// Box2D
+#include <Box2D/Box2D.h>
+
+// CeCe
+#include "cece/core/Assert.hpp"
+#include "cece/object/Object.hpp"
+#include "cece/object/Container.hpp"
+#include "cece/simulator/ConverterBox2D.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace object {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Coefficients converting values between Box2D and simulation units.
+ *
+ * They are computed in the same way as ConverterBox2D does so values are
+ * same as ones returned by the converter.
+ */
+struct Coefficients
+{
+    /// Length coefficient.
+    RealType length;
+
+    /// Linear velocity coefficient.
+    RealType velocity;
+
+    /// Angular velocity coefficient.
+    RealType angularVelocity;
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns current conversion coefficients.
+ *
+ * @return
+ */
+Coefficients getCoefficients() noexcept
+{
+    const auto& converter = simulator::ConverterBox2D::getInstance();
+
+    return {
+        RealType(1) / converter.getLengthCoefficient(),
+        converter.getTimeCoefficient() / converter.getLengthCoefficient(),
+        converter.getTimeCoefficient()
+    };
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns current conversion coefficients from simulation units into
+ * Box2D units.
+ *
+ * Values are converted in the same way as ConverterBox2D does.
+ *
+ * @return
+ */
+Coefficients getInverseCoefficients() noexcept
+{
+    const auto& converter = simulator::ConverterBox2D::getInstance();
+
+    return {
+        converter.getLengthCoefficient(),
+        converter.getLengthCoefficient() / converter.getTimeCoefficient(),
+        RealType(1) / converter.getTimeCoefficient()
+    };
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Convert vector into Box2D vector.
+ *
+ * @param value Value in simulation units.
+ * @param coeff Conversion coefficient.
+ *
+ * @return
+ */
+b2Vec2 toBox2D(const Vector<RealType>& value, RealType coeff) noexcept
+{
+    return static_cast<float32>(coeff) * b2Vec2{
+        static_cast<float32>(value.getX()),
+        static_cast<float32>(value.getY())
+    };
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::capture(Container& objects)
+{
+    const auto count = objects.getCount();
+
+    m_position.resize(count);
+    m_massCenter.resize(count);
+    m_rotation.resize(count);
+    m_velocity.resize(count);
+    m_angularVelocity.resize(count);
+    m_force.resize(count);
+    m_force.fill(Zero);
+    m_torque.assign(count, 0);
+    m_flags.assign(count, 0);
+    m_objects.resize(count);
+    m_bodies.resize(count);
+    m_pinBodies.resize(count);
+    m_dirty.clear();
+    m_dirty.reserve(count);
+
+    std::size_t index = 0;
+    bool bodiless = false;
+
+    // Deleted objects are captured too, they are alive until removal
+    for (auto& record : objects)
+    {
+        CECE_ASSERT(record.ptr);
+
+        m_objects[index] = record.ptr.get();
+        m_bodies[index] = record->getBody();
+        m_pinBodies[index] = record->getPinBody();
+
+        if (m_bodies[index])
+            read(index, *m_bodies[index]);
+        else
+            bodiless = true;
+
+        ++index;
+    }
+
+    // Convert into simulation units in a batch
+    const auto coeffs = getCoefficients();
+
+    m_position *= coeffs.length;
+    m_massCenter *= coeffs.length;
+    m_velocity *= coeffs.velocity;
+
+    for (auto& velocity : m_angularVelocity)
+        velocity *= coeffs.angularVelocity;
+
+    // Objects without body have state in simulation units
+    if (bodiless)
+    {
+        for (index = 0; index < count; ++index)
+        {
+            if (!m_bodies[index])
+                read(index, *m_objects[index]);
+        }
+    }
+
+    for (index = 0; index < count; ++index)
+        m_objects[index]->attachSnapshot(this, index);
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::capture(std::size_t index, const b2Body& body) noexcept
+{
+    CECE_ASSERT(index < getSize());
+
+    read(index, body);
+
+    const auto coeffs = getCoefficients();
+
+    m_position.set(index, m_position[index] * coeffs.length);
+    m_massCenter.set(index, m_massCenter[index] * coeffs.length);
+    m_velocity.set(index, m_velocity[index] * coeffs.velocity);
+    m_angularVelocity[index] *= coeffs.angularVelocity;
+
+    clearFlags(index);
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::apply() noexcept
+{
+    if (m_dirty.empty())
+        return;
+
+    const auto coeffs = getInverseCoefficients();
+
+    for (auto index : m_dirty)
+        write(index, coeffs.length, coeffs.velocity, coeffs.angularVelocity);
+
+    m_dirty.clear();
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::apply(std::size_t index) noexcept
+{
+    CECE_ASSERT(index < getSize());
+
+    if (!m_flags[index])
+        return;
+
+    const auto coeffs = getInverseCoefficients();
+    write(index, coeffs.length, coeffs.velocity, coeffs.angularVelocity);
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::detach(std::size_t index) noexcept
+{
+    CECE_ASSERT(index < getSize());
+
+    m_objects[index] = nullptr;
+    m_bodies[index] = nullptr;
+    m_pinBodies[index] = nullptr;
+    clearFlags(index);
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::write(std::size_t index, RealType length, RealType velocity, RealType angularVelocity) noexcept
+{
+    const auto flags = m_flags[index];
+    const auto body = m_bodies[index];
+
+    // Already written or detached
+    if (!flags || !m_objects[index])
+        return;
+
+    if (!body)
+    {
+        write(index, *m_objects[index]);
+        return;
+    }
+
+    if (flags & FLAG_POSITION)
+    {
+        const auto position = toBox2D(m_position[index], length);
+
+        body->SetTransform(position, static_cast<float32>(m_rotation[index]));
+
+        if (m_pinBodies[index])
+            m_pinBodies[index]->SetTransform(position, 0);
+    }
+    else if (flags & FLAG_ROTATION)
+    {
+        // Keep body position untouched by conversion round-trip
+        body->SetTransform(body->GetPosition(), static_cast<float32>(m_rotation[index]));
+    }
+
+    if (flags & FLAG_VELOCITY)
+        body->SetLinearVelocity(toBox2D(m_velocity[index], velocity));
+
+    if (flags & FLAG_ANGULAR_VELOCITY)
+        body->SetAngularVelocity(static_cast<float32>(angularVelocity * m_angularVelocity[index]));
+
+    if (flags & FLAG_FORCE)
+    {
+        const auto force = m_force[index];
+
+        body->ApplyForceToCenter(b2Vec2(static_cast<float32>(force.getX()), static_cast<float32>(force.getY())), true);
+
+        if (m_torque[index] != 0)
+            body->ApplyTorque(static_cast<float32>(m_torque[index]), true);
+    }
+
+    clearFlags(index);
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::read(std::size_t index, const b2Body& body) noexcept
+{
+    const auto& position = body.GetPosition();
+    const auto& center = body.GetLocalCenter();
+    const auto& velocity = body.GetLinearVelocity();
+
+    m_position.set(index, {position.x, position.y});
+    m_massCenter.set(index, {center.x, center.y});
+    m_rotation[index] = body.GetAngle();
+    m_velocity.set(index, {velocity.x, velocity.y});
+    m_angularVelocity[index] = body.GetAngularVelocity();
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::write(std::size_t index, Object& object) noexcept
+{
+    const auto flags = m_flags[index];
+
+    // Object setters write into object when it's not attached
+    object.attachSnapshot(nullptr, 0);
+
+    if (flags & FLAG_POSITION)
+        object.setPosition(getPosition(index));
+
+    if (flags & FLAG_ROTATION)
+        object.setRotation(getRotation(index));
+
+    if (flags & FLAG_VELOCITY)
+        object.setVelocity(getVelocity(index));
+
+    if (flags & FLAG_ANGULAR_VELOCITY)
+        object.setAngularVelocity(getAngularVelocity(index));
+
+    object.attachSnapshot(this, index);
+
+    // Forces are consumed by physics backend from the snapshot
+    clearFlags(index);
+}
+
+/* ************************************************************************ */
+
+void StateSnapshot::read(std::size_t index, Object& object) noexcept
+{
+    // Object getters read object state when it's not attached
+    object.attachSnapshot(nullptr, 0);
+
+    const auto position = object.getPosition();
+    const auto center = object.getMassCenterOffset();
+    const auto velocity = object.getVelocity();
+
+    m_position.set(index, {position.getX().value(), position.getY().value()});
+    m_massCenter.set(index, {center.getX().value(), center.getY().value()});
+    m_rotation[index] = object.getRotation().value();
+    m_velocity.set(index, {velocity.getX().value(), velocity.getY().value()});
+    m_angularVelocity[index] = object.getAngularVelocity().value();
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,480 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// C++
+#include <cstddef>
+#include <cstdint>
+
+// CeCe
+#include "cece/core/Real.hpp"
+#include "cece/core/Units.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/VectorArray.hpp"
+
+/* ************************************************************************ */
+
+class b2Body;
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace object {
+
+/* ************************************************************************ */
+
+class Object;
+class Container;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Structure-of-arrays snapshot of object physics state.
+ *
+ * Simulation captures state of all bodies once after physics step and
+ * converts it into simulation units in a batch. Object getters read the
+ * snapshot instead of converting Box2D body state on every call. Object
+ * mutators write into the snapshot and mark the record dirty, pending
+ * changes of dirty records are converted and written back to the bodies in
+ * one pass before the next physics step.
+ *
+ * Objects created after capture are not attached and use their bodies
+ * directly, destroyed objects detach their records. Snapshot must outlive
+ * attached objects. Objects without body keep state themselves, their
+ * records are read from and written into the objects.
+ *
+ * Values are stored as SI values of the units, pending forces and torques
+ * are stored in Box2D units.
+ */
+class StateSnapshot
+{
+
+// Public Enums
+public:
+
+
+    /**
+     * @brief Pending write-back flags.
+     */
+    enum Flag : std::uint8_t
+    {
+        /// Position changed.
+        FLAG_POSITION = 1 << 0,
+
+        /// Rotation changed.
+        FLAG_ROTATION = 1 << 1,
+
+        /// Linear velocity changed.
+        FLAG_VELOCITY = 1 << 2,
+
+        /// Angular velocity changed.
+        FLAG_ANGULAR_VELOCITY = 1 << 3,
+
+        /// Force or torque applied.
+        FLAG_FORCE = 1 << 4
+    };
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns number of records.
+     *
+     * @return
+     */
+    std::size_t getSize() const noexcept
+    {
+        return m_rotation.size();
+    }
+
+
+    /**
+     * @brief Returns body position.
+     *
+     * @param index Record index.
+     *
+     * @return
+     */
+    units::PositionVector getPosition(std::size_t index) const noexcept
+    {
+        const auto position = m_position[index];
+        return {units::Length(position.getX()), units::Length(position.getY())};
+    }
+
+
+    /**
+     * @brief Returns mass center local position.
+     *
+     * @param index Record index.
+     *
+     * @return
+     */
+    units::PositionVector getMassCenterOffset(std::size_t index) const noexcept
+    {
+        const auto offset = m_massCenter[index];
+        return {units::Length(offset.getX()), units::Length(offset.getY())};
+    }
+
+
+    /**
+     * @brief Returns body rotation.
+     *
+     * @param index Record index.
+     *
+     * @return
+     */
+    units::Angle getRotation(std::size_t index) const noexcept
+    {
+        return units::Angle(m_rotation[index]);
+    }
+
+
+    /**
+     * @brief Returns body linear velocity.
+     *
+     * @param index Record index.
+     *
+     * @return
+     */
+    units::VelocityVector getVelocity(std::size_t index) const noexcept
+    {
+        const auto velocity = m_velocity[index];
+        return {units::Velocity(velocity.getX()), units::Velocity(velocity.getY())};
+    }
+
+
+    /**
+     * @brief Returns body angular velocity.
+     *
+     * @param index Record index.
+     *
+     * @return
+     */
+    units::AngularVelocity getAngularVelocity(std::size_t index) const noexcept
+    {
+        return units::AngularVelocity(m_angularVelocity[index]);
+    }
+
+
+    /**
+     * @brief Returns pending write-back flags.
+     *
+     * @param index Record index.
+     *
+     * @return
+     */
+    std::uint8_t getFlags(std::size_t index) const noexcept
+    {
+        return m_flags[index];
+    }
+
+
+    /**
+     * @brief Returns pending force in Box2D units.
+     *
+     * @param index Record index.
+     *
+     * @return
+     */
+    Vector<RealType> getForce(std::size_t index) const noexcept
+    {
+        return m_force[index];
+    }
+
+
+    /**
+     * @brief Returns pending torque in Box2D units.
+     *
+     * @param index Record index.
+     *
+     * @return
+     */
+    RealType getTorque(std::size_t index) const noexcept
+    {
+        return m_torque[index];
+    }
+
+
+// Public Mutators
+public:
+
+
+    /**
+     * @brief Change body position.
+     *
+     * @param index    Record index.
+     * @param position New position.
+     */
+    void setPosition(std::size_t index, const units::PositionVector& position) noexcept
+    {
+        m_position.set(index, {position.getX().value(), position.getY().value()});
+        mark(index, FLAG_POSITION);
+    }
+
+
+    /**
+     * @brief Change body rotation.
+     *
+     * @param index Record index.
+     * @param angle New rotation.
+     */
+    void setRotation(std::size_t index, units::Angle angle) noexcept
+    {
+        m_rotation[index] = angle.value();
+        mark(index, FLAG_ROTATION);
+    }
+
+
+    /**
+     * @brief Change body linear velocity.
+     *
+     * @param index    Record index.
+     * @param velocity New velocity.
+     */
+    void setVelocity(std::size_t index, const units::VelocityVector& velocity) noexcept
+    {
+        m_velocity.set(index, {velocity.getX().value(), velocity.getY().value()});
+        mark(index, FLAG_VELOCITY);
+    }
+
+
+    /**
+     * @brief Change body angular velocity.
+     *
+     * @param index    Record index.
+     * @param velocity New angular velocity.
+     */
+    void setAngularVelocity(std::size_t index, units::AngularVelocity velocity) noexcept
+    {
+        m_angularVelocity[index] = velocity.value();
+        mark(index, FLAG_ANGULAR_VELOCITY);
+    }
+
+
+    /**
+     * @brief Accumulate force applied to body.
+     *
+     * @param index  Record index.
+     * @param force  Force applied to mass center in Box2D units.
+     * @param torque Torque in Box2D units.
+     */
+    void addForce(std::size_t index, const Vector<RealType>& force, RealType torque) noexcept
+    {
+        m_force.set(index, m_force[index] + force);
+        m_torque[index] += torque;
+        mark(index, FLAG_FORCE);
+    }
+
+
+    /**
+     * @brief Clear pending force and torque of record.
+     *
+     * It's used by physics backend which consumes forces itself.
+     *
+     * @param index Record index.
+     */
+    void clearForce(std::size_t index) noexcept
+    {
+        m_flags[index] &= ~FLAG_FORCE;
+        m_force.set(index, Zero);
+        m_torque[index] = 0;
+    }
+
+
+    /**
+     * @brief Clear pending write-back of record.
+     *
+     * @param index Record index.
+     */
+    void clearFlags(std::size_t index) noexcept
+    {
+        m_flags[index] = 0;
+        m_force.set(index, Zero);
+        m_torque[index] = 0;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Capture state of all objects.
+     *
+     * Objects are attached to the snapshot and their getters read captured
+     * values until the next capture.
+     *
+     * @param objects Objects.
+     */
+    void capture(Container& objects);
+
+
+    /**
+     * @brief Capture state of single record again.
+     *
+     * It's used after body was changed directly, e.g. by an impulse.
+     *
+     * @param index Record index.
+     * @param body  Physics body.
+     */
+    void capture(std::size_t index, const b2Body& body) noexcept;
+
+
+    /**
+     * @brief Write pending changes of all dirty records back to their
+     * bodies.
+     */
+    void apply() noexcept;
+
+
+    /**
+     * @brief Write pending changes of single record back to its body.
+     *
+     * @param index Record index.
+     */
+    void apply(std::size_t index) noexcept;
+
+
+    /**
+     * @brief Detach record of destroyed object, pending changes are dropped.
+     *
+     * @param index Record index.
+     */
+    void detach(std::size_t index) noexcept;
+
+
+// Private Operations
+private:
+
+
+    /**
+     * @brief Write pending changes of record into its body.
+     *
+     * @param index           Record index.
+     * @param length          Length conversion coefficient.
+     * @param velocity        Linear velocity conversion coefficient.
+     * @param angularVelocity Angular velocity conversion coefficient.
+     */
+    void write(std::size_t index, RealType length, RealType velocity, RealType angularVelocity) noexcept;
+
+
+    /**
+     * @brief Write pending changes of record into object without body.
+     *
+     * Pending forces are dropped.
+     *
+     * @param index  Record index.
+     * @param object Object.
+     */
+    void write(std::size_t index, Object& object) noexcept;
+
+
+    /**
+     * @brief Mark record as changed.
+     *
+     * @param index Record index.
+     * @param flag  Change flag.
+     */
+    void mark(std::size_t index, Flag flag)
+    {
+        if (!m_flags[index])
+            m_dirty.push_back(index);
+
+        m_flags[index] |= flag;
+    }
+
+
+    /**
+     * @brief Store body state in Box2D units.
+     *
+     * @param index Record index.
+     * @param body  Physics body.
+     */
+    void read(std::size_t index, const b2Body& body) noexcept;
+
+
+    /**
+     * @brief Store state of object without body in simulation units.
+     *
+     * @param index  Record index.
+     * @param object Object.
+     */
+    void read(std::size_t index, Object& object) noexcept;
+
+
+// Private Data Members
+private:
+
+    /// Body positions.
+    VectorArray<RealType> m_position;
+
+    /// Mass center local positions.
+    VectorArray<RealType> m_massCenter;
+
+    /// Body rotations.
+    DynamicArray<RealType> m_rotation;
+
+    /// Linear velocities.
+    VectorArray<RealType> m_velocity;
+
+    /// Angular velocities.
+    DynamicArray<RealType> m_angularVelocity;
+
+    /// Pending forces.
+    VectorArray<RealType> m_force;
+
+    /// Pending torques.
+    DynamicArray<RealType> m_torque;
+
+    /// Pending write-back flags.
+    DynamicArray<std::uint8_t> m_flags;
+
+    /// Objects of records, nullptr for detached records.
+    DynamicArray<Object*> m_objects;
+
+    /// Bodies of records, nullptr for objects without body.
+    DynamicArray<b2Body*> m_bodies;
+
+    /// Pin bodies of pinned objects.
+    DynamicArray<b2Body*> m_pinBodies;
+
+    /// Indices of records with pending changes.
+    DynamicArray<std::size_t> m_dirty;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
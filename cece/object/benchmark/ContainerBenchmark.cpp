@@ -0,0 +1,166 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/ViewPtr.hpp"
+#include "cece/core/UniquePtr.hpp"
+#include "cece/plugin/Manager.hpp"
+#include "cece/object/Object.hpp"
+#include "cece/object/Container.hpp"
+#include "cece/simulator/DefaultSimulation.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Fill container with objects.
+ *
+ * @param container
+ * @param simulation
+ * @param count
+ */
+void fill(object::Container& container, simulator::Simulation& simulation, int count)
+{
+    for (int i = 0; i < count; ++i)
+        container.create<object::Object>(simulation, "benchmark.Object", object::Object::Type::Dynamic);
+
+    container.addPending();
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void ObjectContainer_add(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+
+    for (auto _ : state)
+    {
+        auto container = makeUnique<object::Container>();
+        fill(*container, simulation, count);
+
+        // Object destruction is not measured
+        state.PauseTiming();
+        container.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(ObjectContainer_add)->Arg(1000)->Arg(10000);
+
+/* ************************************************************************ */
+
+static void ObjectContainer_deleteObject(benchmark::State& state)
+{
+    using SizeType = object::Container::SizeType;
+
+    const auto count = static_cast<int>(state.range(0));
+
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto container = makeUnique<object::Container>();
+        fill(*container, simulation, count);
+
+        DynamicArray<ViewPtr<object::Object>> objects;
+
+        for (SizeType i = 0; i < container->getCount(); i += 2)
+            objects.push_back(container->get(i));
+
+        state.ResumeTiming();
+
+        // Delete every second object, the last ones first
+        for (auto it = objects.rbegin(); it != objects.rend(); ++it)
+            container->deleteObject(*it);
+
+        state.PauseTiming();
+        container.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (count / 2));
+}
+
+BENCHMARK(ObjectContainer_deleteObject)->Arg(1000)->Arg(10000);
+
+/* ************************************************************************ */
+
+static void ObjectContainer_removeDeleted(benchmark::State& state)
+{
+    using SizeType = object::Container::SizeType;
+
+    const auto count = static_cast<int>(state.range(0));
+
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto container = makeUnique<object::Container>();
+        fill(*container, simulation, count);
+
+        for (SizeType i = 0; i < container->getCount(); i += 2)
+            container->deleteObject(container->get(i));
+
+        state.ResumeTiming();
+
+        container->removeDeleted();
+
+        // Removed objects are destroyed by removeDeleted, remaining are not
+        // measured
+        state.PauseTiming();
+        container.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(ObjectContainer_removeDeleted)->Arg(1000)->Arg(10000);
+
+/* ************************************************************************ */
@@ -0,0 +1,133 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Units.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/plugin/Manager.hpp"
+#include "cece/object/Object.hpp"
+#include "cece/object/Container.hpp"
+#include "cece/object/StateSnapshot.hpp"
+#include "cece/simulator/DefaultSimulation.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Fill container with objects.
+ *
+ * @param container
+ * @param simulation
+ * @param count
+ */
+void fill(object::Container& container, simulator::Simulation& simulation, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        auto object = container.create<object::Object>(simulation, "benchmark.Object", object::Object::Type::Dynamic);
+        object->setPosition({units::um(i % 100), units::um(i / 100)});
+        object->setVelocity({units::um_s(1), units::um_s(2)});
+    }
+
+    container.addPending();
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Read state of all objects like Object::update does.
+ *
+ * @param container
+ * @param dt
+ */
+void update(object::Container& container, units::Duration dt)
+{
+    for (auto& record : container)
+    {
+        record->setPosition(record->getPosition() + record->getVelocity() * dt);
+        benchmark::DoNotOptimize(record->getRotation());
+        benchmark::DoNotOptimize(record->getAngularVelocity());
+    }
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+static void ObjectState_direct(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    object::Container container;
+    fill(container, simulation, count);
+
+    for (auto _ : state)
+        update(container, units::s(0.1));
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(ObjectState_direct)->Arg(1000)->Arg(10000);
+
+/* ************************************************************************ */
+
+static void ObjectState_snapshot(benchmark::State& state)
+{
+    const auto count = static_cast<int>(state.range(0));
+
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    object::StateSnapshot snapshot;
+    object::Container container;
+    fill(container, simulation, count);
+
+    // Capture and write-back are part of every step
+    for (auto _ : state)
+    {
+        snapshot.capture(container);
+        update(container, units::s(0.1));
+        snapshot.apply();
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK(ObjectState_snapshot)->Arg(1000)->Arg(10000);
+
+/* ************************************************************************ */
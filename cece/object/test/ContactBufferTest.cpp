@@ -0,0 +1,291 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// GTest
+#include <gtest/gtest.h>
+
+// CeCe
+#include "cece/core/Atomic.hpp"
+#include "cece/core/Units.hpp"
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/Shape.hpp"
+#include "cece/plugin/Manager.hpp"
+#include "cece/object/Object.hpp"
+#include "cece/object/ContactBuffer.hpp"
+#include "cece/object/ContactListener.hpp"
+#include "cece/simulator/DefaultSimulation.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Create circle object of given type.
+ */
+ViewPtr<object::Object> create(simulator::Simulation& simulation, String type, units::Length x)
+{
+    auto object = simulation.addObject(
+        makeUnique<object::Object>(simulation, std::move(type), object::Object::Type::Dynamic)
+    );
+    object->setShapes({Shape::makeCircle(units::um(1))});
+    object->initShapes();
+    object->setPosition({x, units::um(0)});
+
+    return object;
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Counts contacts.
+ */
+struct Counter : public object::ContactListener
+{
+    int count = 0;
+
+    void onContact(object::Object&, object::Object&) override
+    {
+        ++count;
+    }
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Deletes touching objects of type test.B.
+ */
+struct Deleter : public object::ContactListener
+{
+    void onContact(object::Object& o1, object::Object& o2) override
+    {
+        for (auto object : {&o1, &o2})
+        {
+            if (object->getTypeName() == "test.B")
+                object->destroy();
+        }
+    }
+};
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(ContactBuffer, record)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    auto o1 = create(simulation, "test.A", units::um(0));
+    auto o2 = create(simulation, "test.B", units::um(5));
+
+    object::ContactBuffer buffer;
+    EXPECT_FALSE(buffer.isEnabled());
+    EXPECT_EQ(0u, buffer.getCount());
+
+    const auto begin = buffer.push({object::ContactEvent::Type::Begin, o1, o2, {1, 0}, Zero});
+    const auto end = buffer.push({object::ContactEvent::Type::End, o2, o1, {-1, 0}, Zero});
+
+    EXPECT_EQ(0u, begin);
+    EXPECT_EQ(1u, end);
+    ASSERT_EQ(2u, buffer.getCount());
+    EXPECT_EQ(object::ContactEvent::Type::Begin, buffer.getEvents()[0].type);
+    EXPECT_EQ(o1, buffer.getEvents()[0].first);
+    EXPECT_EQ(o2, buffer.getEvents()[0].second);
+    EXPECT_EQ(object::ContactEvent::Type::End, buffer.getEvents()[1].type);
+    EXPECT_EQ(-1, buffer.getEvents()[1].normal.getX());
+    EXPECT_EQ(2, std::distance(buffer.begin(), buffer.end()));
+
+    buffer.clear();
+    EXPECT_EQ(0u, buffer.getCount());
+}
+
+/* ************************************************************************ */
+
+TEST(ContactBuffer, filter)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    auto a = create(simulation, "test.A", units::um(0));
+    auto b = create(simulation, "test.B", units::um(5));
+    auto c = create(simulation, "test.C", units::um(10));
+
+    object::ContactBuffer buffer;
+
+    // Without filters everything passes
+    EXPECT_TRUE(buffer.accepts(*a, *b));
+    EXPECT_TRUE(buffer.accepts(*b, *c));
+
+    // Filters are symmetric
+    buffer.addFilter("test.A", "test.B");
+    EXPECT_TRUE(buffer.accepts(*a, *b));
+    EXPECT_TRUE(buffer.accepts(*b, *a));
+    EXPECT_FALSE(buffer.accepts(*a, *c));
+    EXPECT_FALSE(buffer.accepts(*b, *c));
+
+    // Empty name matches anything
+    buffer.addFilter("test.C", "");
+    EXPECT_TRUE(buffer.accepts(*b, *c));
+    EXPECT_TRUE(buffer.accepts(*c, *a));
+    EXPECT_FALSE(buffer.accepts(*a, *a));
+
+    buffer.clearFilters();
+    EXPECT_TRUE(buffer.accepts(*a, *a));
+}
+
+/* ************************************************************************ */
+
+TEST(ContactBuffer, impulse)
+{
+    object::ContactBuffer buffer;
+
+    const auto index = buffer.push({object::ContactEvent::Type::Begin, nullptr, nullptr, Zero, Zero});
+    EXPECT_EQ(0, buffer.getEvents()[index].impulse.getX().value());
+
+    buffer.addImpulse(index, {units::Impulse(1), units::Impulse(2)});
+    buffer.addImpulse(index, {units::Impulse(0.5), units::Impulse(-1)});
+
+    EXPECT_DOUBLE_EQ(1.5, buffer.getEvents()[index].impulse.getX().value());
+    EXPECT_DOUBLE_EQ(1, buffer.getEvents()[index].impulse.getY().value());
+}
+
+/* ************************************************************************ */
+
+TEST(ContactBuffer, consumers)
+{
+    object::ContactBuffer buffer;
+
+    buffer.addConsumer();
+    buffer.addConsumer();
+    EXPECT_TRUE(buffer.isEnabled());
+    EXPECT_EQ(2u, buffer.getConsumerCount());
+
+    buffer.push({object::ContactEvent::Type::Begin, nullptr, nullptr, Zero, Zero});
+
+    buffer.removeConsumer();
+    EXPECT_TRUE(buffer.isEnabled());
+    EXPECT_EQ(1u, buffer.getCount());
+
+    // The last consumer removes events
+    buffer.removeConsumer();
+    EXPECT_FALSE(buffer.isEnabled());
+    EXPECT_EQ(0u, buffer.getCount());
+}
+
+/* ************************************************************************ */
+
+TEST(ContactBuffer, simulation)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    simulation.setTimeStep(units::ms(10));
+    simulation.setWorldSize({units::um(100), units::um(100)});
+
+    // Overlapping objects
+    create(simulation, "test.A", units::um(0));
+    auto b = create(simulation, "test.B", units::um(1));
+
+    auto buffer = simulation.getContactBuffer();
+    ASSERT_NE(nullptr, buffer);
+    buffer->addConsumer();
+    buffer->addFilter("test.A", "test.A");
+
+    Counter counter;
+    simulation.addContactListener(&counter);
+
+    AtomicBool flag{true};
+    simulation.initialize(flag);
+    simulation.update();
+
+    // Listeners are not affected by buffer filters
+    EXPECT_EQ(1, counter.count);
+    EXPECT_EQ(0u, buffer->getCount());
+
+    // Removed listener is not notified
+    simulation.removeContactListener(&counter);
+    buffer->clearFilters();
+    b->setPosition({units::um(20), units::um(0)});
+    simulation.update();
+    b->setPosition({units::um(1), units::um(0)});
+    simulation.update();
+
+    EXPECT_EQ(1, counter.count);
+    ASSERT_EQ(1u, buffer->getCount());
+    EXPECT_EQ(object::ContactEvent::Type::Begin, buffer->getEvents()[0].type);
+
+    buffer->removeConsumer();
+    EXPECT_FALSE(buffer->isEnabled());
+}
+
+/* ************************************************************************ */
+
+TEST(ContactBuffer, deleted)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    simulation.setTimeStep(units::ms(10));
+    simulation.setWorldSize({units::um(100), units::um(100)});
+
+    // Overlapping objects and one far away
+    auto a = create(simulation, "test.A", units::um(0));
+    create(simulation, "test.B", units::um(1));
+    auto c = create(simulation, "test.C", units::um(20));
+
+    auto buffer = simulation.getContactBuffer();
+    buffer->addConsumer();
+
+    // Listener deletes touching object in the step contact began
+    Deleter deleter;
+    simulation.addContactListener(&deleter);
+
+    AtomicBool flag{true};
+    simulation.initialize(flag);
+    simulation.update();
+
+    // Events of removed object are dropped with it
+    EXPECT_EQ(2u, simulation.getObjects().size());
+    EXPECT_EQ(0u, buffer->getCount());
+
+    simulation.removeContactListener(&deleter);
+
+    // Remaining events are kept until the next step
+    c->setPosition({units::um(1), units::um(0)});
+    simulation.update();
+
+    ASSERT_EQ(1u, buffer->getCount());
+    const auto& event = buffer->getEvents()[0];
+    EXPECT_TRUE((event.first == a && event.second == c) || (event.first == c && event.second == a));
+
+    buffer->removeConsumer();
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,305 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+
+// GTest
+#include <gtest/gtest.h>
+
+// C++
+#include <cmath>
+
+// Box2D
+#include <Box2D/Box2D.h>
+
+// CeCe
+#include "cece/core/Units.hpp"
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/Shape.hpp"
+#include "cece/core/constants.hpp"
+#include "cece/plugin/Manager.hpp"
+#include "cece/object/Object.hpp"
+#include "cece/object/Container.hpp"
+#include "cece/object/StateSnapshot.hpp"
+#include "cece/simulator/ConverterBox2D.hpp"
+#include "cece/simulator/DefaultSimulation.hpp"
+#include "cece/simulator/PhysicsBackendParticles.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Create dynamic object with mass center out of its origin.
+ */
+ViewPtr<object::Object> create(object::Container& container, simulator::Simulation& simulation,
+    object::Object::Type type = object::Object::Type::Dynamic)
+{
+    auto object = container.create<object::Object>(simulation, "test.Object", type);
+    object->setShapes({Shape::makeCircle(units::um(1), {units::um(2), units::um(0)})});
+    object->initShapes();
+    container.addPending();
+
+    return object;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+TEST(StateSnapshot, roundTrip)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    simulation.setTimeStep(units::ms(10));
+    object::StateSnapshot snapshot;
+    object::Container container;
+    const auto& converter = simulator::ConverterBox2D::getInstance();
+
+    auto object = create(container, simulation);
+    snapshot.capture(container);
+
+    object->setPosition({units::um(10), units::um(-5)});
+    object->setRotation(units::rad(0.5));
+    object->setVelocity({units::um_s(3), units::um_s(4)});
+    object->setAngularVelocity(units::AngularVelocity(0.25));
+
+    // Getters read pending values
+    EXPECT_DOUBLE_EQ(units::um(10).value(), object->getPosition().getX().value());
+    EXPECT_DOUBLE_EQ(units::um(-5).value(), object->getPosition().getY().value());
+    EXPECT_DOUBLE_EQ(0.5, object->getRotation().value());
+    EXPECT_DOUBLE_EQ(units::um_s(4).value(), object->getVelocity().getY().value());
+    EXPECT_DOUBLE_EQ(0.25, object->getAngularVelocity().value());
+
+    // Body gets the same values as with direct conversion
+    snapshot.apply();
+    EXPECT_EQ(0u, snapshot.getFlags(0));
+
+    const auto body = object->getBody();
+    const auto position = converter.convertPosition(units::PositionVector{units::um(10), units::um(-5)});
+    const auto velocity = converter.convertLinearVelocity(units::VelocityVector{units::um_s(3), units::um_s(4)});
+    EXPECT_FLOAT_EQ(position.x, body->GetPosition().x);
+    EXPECT_FLOAT_EQ(position.y, body->GetPosition().y);
+    EXPECT_FLOAT_EQ(0.5f, body->GetAngle());
+    EXPECT_FLOAT_EQ(velocity.x, body->GetLinearVelocity().x);
+    EXPECT_FLOAT_EQ(velocity.y, body->GetLinearVelocity().y);
+    EXPECT_FLOAT_EQ(converter.convertAngularVelocity(units::AngularVelocity(0.25)), body->GetAngularVelocity());
+
+    // Captured again from the body in float precision
+    snapshot.capture(container);
+    EXPECT_NEAR(units::um(10).value(), object->getPosition().getX().value(), units::um(10).value() * 1e-6);
+    EXPECT_NEAR(units::um_s(3).value(), object->getVelocity().getX().value(), units::um_s(3).value() * 1e-6);
+    EXPECT_NEAR(0.25, object->getAngularVelocity().value(), 1e-6);
+}
+
+/* ************************************************************************ */
+
+TEST(StateSnapshot, rotationKeepsPosition)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    simulation.setTimeStep(units::ms(10));
+    object::StateSnapshot snapshot;
+    object::Container container;
+
+    auto object = create(container, simulation);
+    object->setPosition({units::um(7), units::um(3)});
+    const auto position = object->getBody()->GetPosition();
+
+    snapshot.capture(container);
+    object->setRotation(units::rad(1));
+    snapshot.apply();
+
+    EXPECT_EQ(position.x, object->getBody()->GetPosition().x);
+    EXPECT_EQ(position.y, object->getBody()->GetPosition().y);
+    EXPECT_FLOAT_EQ(1.0f, object->getBody()->GetAngle());
+}
+
+/* ************************************************************************ */
+
+TEST(StateSnapshot, forceWithOffset)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    simulation.setTimeStep(units::ms(10));
+    object::StateSnapshot snapshot;
+    object::Container direct;
+    object::Container captured;
+
+    const units::ForceVector force{units::N(2e-18), units::N(-1e-18)};
+    const units::PositionVector offset{units::um(1), units::um(-1)};
+
+    // Same state, far from each other
+    auto first = create(direct, simulation);
+    auto second = create(captured, simulation);
+
+    first->setPosition({units::um(-50), units::um(0)});
+    first->setRotation(units::rad(0.3));
+    second->setPosition({units::um(50), units::um(0)});
+    second->setRotation(units::rad(0.3));
+
+    // Force applied by b2Body::ApplyForce and through the snapshot, it's
+    // small enough to not hit Box2D maximum translation and rotation
+    snapshot.capture(captured);
+    first->applyForce(force, offset);
+    second->applyForce(force, offset);
+    snapshot.apply();
+
+    simulation.getWorld().Step(0.1f, 1, 1);
+
+    const auto firstBody = first->getBody();
+    const auto secondBody = second->getBody();
+    const auto angular = firstBody->GetAngularVelocity();
+    const auto linear = firstBody->GetLinearVelocity();
+
+    // Torque is computed in double precision, Box2D uses float
+    ASSERT_NE(0.0f, angular);
+    EXPECT_NEAR(angular, secondBody->GetAngularVelocity(), std::abs(angular) * 1e-5);
+    EXPECT_NEAR(linear.x, secondBody->GetLinearVelocity().x, std::abs(linear.x) * 1e-5);
+    EXPECT_NEAR(linear.y, secondBody->GetLinearVelocity().y, std::abs(linear.y) * 1e-5);
+}
+
+/* ************************************************************************ */
+
+TEST(StateSnapshot, pinned)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    simulation.setTimeStep(units::ms(10));
+    object::StateSnapshot snapshot;
+    object::Container container;
+
+    auto object = create(container, simulation, object::Object::Type::Pinned);
+    ASSERT_NE(nullptr, object->getPinBody());
+
+    snapshot.capture(container);
+    object->setPosition({units::um(20), units::um(10)});
+    snapshot.apply();
+
+    const auto position = simulator::ConverterBox2D::getInstance().convertPosition(
+        units::PositionVector{units::um(20), units::um(10)}
+    );
+
+    EXPECT_FLOAT_EQ(position.x, object->getBody()->GetPosition().x);
+    EXPECT_FLOAT_EQ(position.y, object->getBody()->GetPosition().y);
+    EXPECT_FLOAT_EQ(position.x, object->getPinBody()->GetPosition().x);
+    EXPECT_FLOAT_EQ(position.y, object->getPinBody()->GetPosition().y);
+}
+
+/* ************************************************************************ */
+
+TEST(StateSnapshot, createRemove)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    simulation.setTimeStep(units::ms(10));
+    object::StateSnapshot snapshot;
+    object::Container container;
+
+    auto kept = create(container, simulation);
+    auto removed = create(container, simulation);
+    snapshot.capture(container);
+
+    kept->setVelocity({units::um_s(1), units::um_s(0)});
+    removed->setVelocity({units::um_s(2), units::um_s(0)});
+
+    // Removed object drops its pending changes
+    container.deleteObject(removed);
+    container.removeDeleted();
+    EXPECT_EQ(0u, snapshot.getFlags(1));
+
+    // Object created after capture is not attached and uses its body
+    auto added = create(container, simulation);
+    added->setPosition({units::um(30), units::um(0)});
+    EXPECT_FLOAT_EQ(
+        simulator::ConverterBox2D::getInstance().convertPosition(units::PositionVector{units::um(30), units::um(0)}).x,
+        added->getBody()->GetPosition().x
+    );
+
+    snapshot.apply();
+
+    EXPECT_FLOAT_EQ(
+        simulator::ConverterBox2D::getInstance().convertLinearVelocity(units::VelocityVector{units::um_s(1), units::um_s(0)}).x,
+        kept->getBody()->GetLinearVelocity().x
+    );
+
+    // Next capture attaches the new object
+    snapshot.capture(container);
+    EXPECT_EQ(2u, snapshot.getSize());
+    EXPECT_NEAR(units::um(30).value(), added->getPosition().getX().value(), units::um(30).value() * 1e-6);
+}
+
+/* ************************************************************************ */
+
+TEST(StateSnapshot, bodiless)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+    simulation.setTimeStep(units::ms(10));
+    simulation.setPhysicsBackend(makeUnique<simulator::PhysicsBackendParticles>(simulation.getWorld()));
+    object::StateSnapshot snapshot;
+    object::Container container;
+
+    auto object = create(container, simulation);
+    auto other = create(container, simulation);
+    ASSERT_EQ(nullptr, object->getBody());
+
+    // Mass from shapes
+    EXPECT_NEAR(constants::PI * units::um(1).value() * units::um(1).value(), object->getMass().value(), 1e-20);
+    EXPECT_DOUBLE_EQ(units::um(2).value(), object->getMassCenterOffset().getX().value());
+    EXPECT_THROW(object->createBound(*other), RuntimeException);
+
+    // State is kept in object before capture
+    object->setPosition({units::um(10), units::um(-5)});
+    object->setVelocity({units::um_s(3), units::um_s(4)});
+    EXPECT_DOUBLE_EQ(units::um(10).value(), object->getPosition().getX().value());
+    EXPECT_DOUBLE_EQ(units::um(12).value(), object->getMassCenterPosition().getX().value());
+
+    // Values are captured exactly, there is no Box2D conversion
+    snapshot.capture(container);
+    EXPECT_DOUBLE_EQ(units::um(-5).value(), object->getPosition().getY().value());
+    EXPECT_DOUBLE_EQ(units::um_s(4).value(), object->getVelocity().getY().value());
+
+    // Pending changes are written back into object
+    object->setPosition({units::um(20), units::um(1)});
+    object->setRotation(units::rad(0.5));
+    snapshot.apply();
+    EXPECT_EQ(0u, snapshot.getFlags(0));
+
+    snapshot.capture(container);
+    EXPECT_DOUBLE_EQ(units::um(20).value(), object->getPosition().getX().value());
+    EXPECT_DOUBLE_EQ(0.5, object->getRotation().value());
+    EXPECT_DOUBLE_EQ(units::um_s(3).value(), object->getVelocity().getX().value());
+}
+
+/* ************************************************************************ */
@@ -26,7 +26,19 @@
 // Declaration
 #include "cece/program/Container.hpp"
 
+// C++
+#include <typeinfo>
+
+#ifdef __GNUG__
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
 // CeCe
+#include "cece/core/Pair.hpp"
+#include "cece/core/String.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/Profiler.hpp"
 #include "cece/program/Program.hpp"
 
 /* ************************************************************************ */
@@ -36,10 +48,74 @@ namespace program {
 
 /* ************************************************************************ */
 
+namespace {
+
+/* ************************************************************************ */
+
+/// Profiler zones of program types.
+thread_local DynamicArray<Pair<const std::type_info*, ProfilerZoneId>> t_zones;
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns profiler zone for program type.
+ *
+ * @param program
+ *
+ * @return
+ */
+ProfilerZoneId getProfilerZone(const Program& program)
+{
+    const std::type_info* type = &typeid(program);
+
+    for (const auto& zone : t_zones)
+    {
+        if (*zone.first == *type)
+            return zone.second;
+    }
+
+    String name = type->name();
+
+#ifdef __GNUG__
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(type->name(), nullptr, nullptr, &status);
+
+    if (demangled)
+    {
+        if (status == 0)
+            name = demangled;
+
+        std::free(demangled);
+    }
+#endif
+
+    const auto zone = Profiler::registerZone("program:" + name);
+    t_zones.emplace_back(type, zone);
+
+    return zone;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
 void Container::call(simulator::Simulation& simulation, object::Object& object, units::Time dt)
 {
-    // Invoke all stored programs
-    invoke(&Program::call, simulation, object, dt);
+    if (!Profiler::isEnabled())
+    {
+        // Invoke all stored programs
+        invoke(&Program::call, simulation, object, dt);
+        return;
+    }
+
+    // Invoke all stored programs and measure them by type
+    for (const auto& program : *this)
+    {
+        ProfilerScope _(getProfilerZone(*program));
+        program->call(simulation, object, dt);
+    }
 }
 
 /* ************************************************************************ */
@@ -28,6 +28,7 @@
 
 // CeCe
 #include "cece/core/StaticArray.hpp"
+#include "cece/core/GridAlgorithm.hpp"
 #include "cece/render/Context.hpp"
 #include "cece/render/VertexFormat.hpp"
 #include "cece/render/Image.hpp"
@@ -120,9 +121,7 @@ void GridColor::resize(Size size, const Color& color)
 
 void GridColor::clear(const Color& color)
 {
-    for (auto& c : m_colors)
-        c = color;
-
+    parallel::fill(m_colors, color);
     m_colorsUpdated = true;
 }
 
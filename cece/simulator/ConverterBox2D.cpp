@@ -42,7 +42,7 @@ RealType ConverterBox2D::getTimeCoefficient() const noexcept
 
 units::Length ConverterBox2D::convertLength(float32 length) const noexcept
 {
-    const auto coeff = 1.0 / getLengthCoefficient();
+    const auto coeff = RealType(1) / getLengthCoefficient();
 
     return coeff * units::Length(length);
 }
@@ -60,7 +60,7 @@ float32 ConverterBox2D::convertLength(units::Length length) const noexcept
 
 units::PositionVector ConverterBox2D::convertPosition(b2Vec2 position) const noexcept
 {
-    const auto coeff = 1.0 / getLengthCoefficient();
+    const auto coeff = RealType(1) / getLengthCoefficient();
 
     return coeff * units::PositionVector{
         units::Length(position.x),
@@ -131,7 +131,7 @@ units::AngularVelocity ConverterBox2D::convertAngularVelocity(float32 velocity)
 
 float32 ConverterBox2D::convertAngularVelocity(units::AngularVelocity velocity) const noexcept
 {
-    const auto coeff = 1.0 / getTimeCoefficient();
+    const auto coeff = RealType(1) / getTimeCoefficient();
 
     return static_cast<float32>(coeff * velocity.value());
 }
@@ -164,7 +164,7 @@ b2Vec2 ConverterBox2D::convertLinearAcceleration(units::AccelerationVector accel
 
 units::Acceleration ConverterBox2D::convertAngularAcceleration(float32 acceleration) const noexcept
 {
-    const auto coeff = 1;
+    const auto coeff = RealType(1);
 
     return coeff * units::Acceleration(acceleration);
 }
@@ -278,7 +278,7 @@ float32 ConverterBox2D::convertMass(units::Mass mass) const noexcept
 
 units::Density ConverterBox2D::convertDensity(float32 density) const noexcept
 {
-    const auto coeff = 1.0 / (getLengthCoefficient() * getLengthCoefficient() * getLengthCoefficient());
+    const auto coeff = RealType(1) / (getLengthCoefficient() * getLengthCoefficient() * getLengthCoefficient());
 
     return coeff * units::Density(density);
 }
@@ -296,7 +296,7 @@ float32 ConverterBox2D::convertDensity(units::Density density) const noexcept
 
 units::Length ConverterBox2D::getMaxObjectTranslation() const noexcept
 {
-    const auto coeff = 1.0 / getLengthCoefficient();
+    const auto coeff = RealType(1) / getLengthCoefficient();
 
     return coeff * units::Length{b2_maxTranslation};
 }
@@ -32,6 +32,7 @@
 #include <fstream>
 #include <iterator>
 #include <iomanip>
+#include <utility>
 
 // Box2D
 #include <Box2D/Box2D.h>
@@ -39,18 +40,24 @@
 // CeCe
 #include "cece/core/Assert.hpp"
 #include "cece/core/Real.hpp"
+#include "cece/core/Shape.hpp"
 #include "cece/core/Log.hpp"
 #include "cece/core/Exception.hpp"
 #include "cece/core/OutStream.hpp"
+#include "cece/core/StringStream.hpp"
 #include "cece/core/FileStream.hpp"
 #include "cece/core/UnitIo.hpp"
+#include "cece/core/Profiler.hpp"
 #include "cece/plugin/Api.hpp"
 #include "cece/plugin/Manager.hpp"
 #include "cece/init/Initializer.hpp"
 #include "cece/module/Module.hpp"
 #include "cece/object/ContactListener.hpp"
+#include "cece/object/ContactBuffer.hpp"
 #include "cece/simulator/TimeMeasurement.hpp"
 #include "cece/simulator/ConverterBox2D.hpp"
+#include "cece/simulator/PhysicsBackendBox2D.hpp"
+#include "cece/simulator/PhysicsBackendParticles.hpp"
 
 #ifdef CECE_RENDER
 #  include "cece/render/PhysicsDebugger.hpp"
@@ -81,19 +88,121 @@ render::PhysicsDebugger g_physicsDebugger;
 
 struct DefaultSimulation::ContactListener : public b2ContactListener
 {
-    object::ContactListener* m_listener;
+    /// Target buffer.
+    object::ContactBuffer& m_buffer;
+
+    /// Begin events recorded in current step, waiting for impulse.
+    Map<const b2Contact*, std::size_t> m_begins;
+
+    /// Unfiltered contact begins of current step for contact listeners.
+    DynamicArray<std::pair<object::Object*, object::Object*>> m_pairs;
+
+    /// If contact begins are stored for contact listeners.
+    bool m_notify = false;
+
+    /// If physics step is running. Destroyed bodies report end of contact
+    /// outside of step and such objects must not get into buffer.
+    bool m_stepping = false;
+
+
+    explicit ContactListener(object::ContactBuffer& buffer) noexcept
+        : m_buffer(buffer)
+    {
+        // Nothing to do
+    }
+
 
     void BeginContact(b2Contact* contact) override
     {
-        if (!m_listener)
+        if (m_stepping && m_notify)
+        {
+            auto o1 = getObject(contact->GetFixtureA());
+            auto o2 = getObject(contact->GetFixtureB());
+
+            if (o1 && o2)
+                m_pairs.emplace_back(o1, o2);
+        }
+
+        const auto index = record(contact, object::ContactEvent::Type::Begin);
+
+        if (index != m_buffer.getCount())
+            m_begins.emplace(contact, index);
+    }
+
+
+    void EndContact(b2Contact* contact) override
+    {
+        record(contact, object::ContactEvent::Type::End);
+    }
+
+
+    void PostSolve(b2Contact* contact, const b2ContactImpulse* impulse) override
+    {
+        // Called for every touching contact, skip lookup when possible
+        if (m_begins.empty())
+            return;
+
+        auto it = m_begins.find(contact);
+
+        if (it == m_begins.end())
             return;
 
-        auto body1 = contact->GetFixtureA()->GetBody();
-        auto body2 = contact->GetFixtureB()->GetBody();
-        auto o1 = static_cast<object::Object*>(body1->GetUserData());
-        auto o2 = static_cast<object::Object*>(body2->GetUserData());
+        float32 sum = 0;
+
+        for (int32 i = 0; i < impulse->count; ++i)
+            sum += impulse->normalImpulses[i];
 
-        m_listener->onContact(*o1, *o2);
+        b2WorldManifold manifold;
+        contact->GetWorldManifold(&manifold);
+
+        m_buffer.addImpulse(it->second,
+            ConverterBox2D::getInstance().convertLinearImpulse(sum * manifold.normal)
+        );
+    }
+
+
+    /**
+     * @brief Returns object of fixture body.
+     *
+     * @param fixture Box2D fixture.
+     *
+     * @return
+     */
+    static object::Object* getObject(b2Fixture* fixture) noexcept
+    {
+        return static_cast<object::Object*>(fixture->GetBody()->GetUserData());
+    }
+
+
+    /**
+     * @brief Store contact event into buffer.
+     *
+     * @param contact Box2D contact.
+     * @param type    Event type.
+     *
+     * @return Event index or buffer size if event is not stored.
+     */
+    std::size_t record(b2Contact* contact, object::ContactEvent::Type type)
+    {
+        if (!m_stepping || !m_buffer.isEnabled())
+            return m_buffer.getCount();
+
+        auto o1 = getObject(contact->GetFixtureA());
+        auto o2 = getObject(contact->GetFixtureB());
+
+        if (!o1 || !o2 || !m_buffer.accepts(*o1, *o2))
+            return m_buffer.getCount();
+
+        // Manifold without points leaves normal untouched
+        b2WorldManifold manifold;
+        manifold.normal.SetZero();
+        contact->GetWorldManifold(&manifold);
+
+        return m_buffer.push(object::ContactEvent{
+            type, o1, o2,
+            {manifold.normal.x, manifold.normal.y},
+            Zero
+        });
     }
 };
 
@@ -103,7 +212,12 @@ DefaultSimulation::DefaultSimulation(const plugin::Repository& repository, FileP
     : m_pluginContext(repository)
     , m_fileName(std::move(path))
     , m_world{makeUnique<b2World>(b2Vec2{0.0f, 0.0f})}
+    , m_contactListener{makeUnique<ContactListener>(m_contactBuffer)}
 {
+    // Contacts are recorded only when buffer is enabled
+    m_world->SetContactListener(m_contactListener.get());
+    m_physics = makeUnique<PhysicsBackendBox2D>(*m_world);
+
 #ifdef CECE_RENDER
     g_physicsDebugger.SetFlags(
         render::PhysicsDebugger::e_shapeBit |
@@ -425,18 +539,31 @@ void DefaultSimulation::setPhysicsEngineTimeStep(units::Time dt) noexcept
 
 void DefaultSimulation::setContactListener(object::ContactListener* listener)
 {
+    m_contactListeners.clear();
+
     if (listener)
-    {
-        if (!m_contactListener)
-            m_contactListener = makeUnique<ContactListener>();
+        addContactListener(listener);
+}
 
-        m_contactListener->m_listener = listener;
-        m_world->SetContactListener(m_contactListener.get());
-    }
-    else
-    {
-        m_world->SetContactListener(nullptr);
-    }
+/* ************************************************************************ */
+
+void DefaultSimulation::addContactListener(object::ContactListener* listener)
+{
+    CECE_ASSERT(listener);
+    m_contactListeners.push_back(listener);
+
+    if (!m_physics->usesBodies())
+        Log::warning("[simulation] Contact listeners are not notified with '", m_physics->getName(), "' physics");
+}
+
+/* ************************************************************************ */
+
+void DefaultSimulation::removeContactListener(object::ContactListener* listener)
+{
+    m_contactListeners.erase(
+        std::remove(m_contactListeners.begin(), m_contactListeners.end(), listener),
+        m_contactListeners.end()
+    );
 }
 
 /* ************************************************************************ */
@@ -452,9 +579,35 @@ void DefaultSimulation::loadConfig(const config::Configuration& config)
 #endif
     }
 
+    // Backend must be known before objects are created, it decides if
+    // objects create bodies
+    const auto physics = config.get("physics", m_physics->getName());
+
+    if (physics == "particles")
+        m_physics = makeUnique<PhysicsBackendParticles>(*m_world);
+    else if (physics == "box2d")
+        m_physics = makeUnique<PhysicsBackendBox2D>(*m_world);
+    else
+        throw InvalidArgumentException("Unknown physics backend: " + physics);
+
+    if (m_physics->usesBodies())
+    {
+        for (const auto& obj : m_objects)
+        {
+            if (!obj->getBody())
+                throw InvalidArgumentException("Physics backend '" + physics + "' cannot simulate objects without bodies");
+        }
+    }
+
+    m_physics->loadConfig(config);
+
     Simulation::loadConfig(config);
 
     setGravity(config.get("gravity", getGravity()));
+
+    // Profiling is global, it's kept as it is when not specified
+    if (config.has("profile"))
+        Profiler::setEnabled(config.get<bool>("profile"));
 }
 
 /* ************************************************************************ */
@@ -465,6 +618,11 @@ void DefaultSimulation::storeConfig(config::Configuration& config) const
 
     config.set("length-coefficient", ConverterBox2D::getInstance().getLengthCoefficient());
     config.set("gravity", getGravity());
+
+    if (Profiler::isEnabled())
+        config.set("profile", true);
+    config.set("physics", m_physics->getName());
+    m_physics->storeConfig(config);
 }
 
 /* ************************************************************************ */
@@ -488,6 +646,12 @@ void DefaultSimulation::initialize(AtomicBool& flag)
     // Initialize simulation
     m_initializers.init(*this);
 
+    if (!m_physics->usesBodies())
+        checkPhysicsFeatures();
+
+    // Objects read physics state from snapshot
+    m_stateSnapshot.capture(m_objects);
+
     // Update states
 #ifdef CECE_RENDER
     m_modules.drawStoreState(m_visualization);
@@ -532,9 +696,28 @@ bool DefaultSimulation::update()
     updateObjects();
 
     {
+        CECE_PROFILE_ZONE("sim.physics");
         auto _ = measure_time("sim.physics", TimeMeasurement(this));
 
-        m_world->Step(static_cast<float32>(getPhysicsEngineTimeStep().value()), 10, 10);
+        m_contactBuffer.clear();
+        m_contactListener->m_begins.clear();
+        m_contactListener->m_pairs.clear();
+        m_contactListener->m_notify = !m_contactListeners.empty();
+        m_contactListener->m_stepping = true;
+        m_physics->step(m_objects, m_stateSnapshot, getTimeStep());
+        m_contactListener->m_stepping = false;
+    }
+
+    if (!m_contactListeners.empty())
+    {
+        CECE_PROFILE_ZONE("sim.contacts");
+
+        // Notify listeners outside of the solver
+        for (const auto& pair : m_contactListener->m_pairs)
+        {
+            for (auto listener : m_contactListeners)
+                listener->onContact(*pair.first, *pair.second);
+        }
     }
 
     // Detect object that leaved the scene
@@ -561,13 +744,42 @@ bool DefaultSimulation::update()
 #ifdef CECE_THREAD_SAFE
         MutexGuard _(m_mutex);
 #endif
+        const auto count = m_objects.getCount();
+
+        // Contact events are kept until the next step, they must not point
+        // to removed objects
+        if (m_contactBuffer.getCount())
+        {
+            DynamicArray<const object::Object*> deleted;
+
+            for (const auto& record : m_objects)
+            {
+                if (record.deleted)
+                    deleted.push_back(record.ptr.get());
+            }
+
+            m_contactBuffer.removeObjects(std::move(deleted));
+        }
+
         // Remove deleted objects
         m_objects.removeDeleted();
+        const bool removed = m_objects.getCount() != count;
 
         // Add pending objects
         m_objects.addPending();
+
+        // Snapshot records must follow objects order
+        if (removed || m_objects.getCount() != count)
+        {
+            m_stateSnapshot.apply();
+            m_stateSnapshot.capture(m_objects);
+        }
     }
 
+    // Aggregate measured zones of finished iteration
+    if (Profiler::isEnabled())
+        Profiler::endIteration(m_iteration);
+
     return (hasUnlimitedIterations() || getIteration() <= getIterations());
 }
 
@@ -595,6 +807,14 @@ void DefaultSimulation::terminate()
         CECE_ASSERT(it->second);
         it->second->finalizeSimulation(*this);
     }
+
+    // Print batch summary
+    if (Profiler::isEnabled() && Profiler::getIterationCount() > 0)
+    {
+        OutStringStream oss;
+        Profiler::writeSummary(oss);
+        Log::info("Profiler summary:\n", oss.str());
+    }
 }
 
 /* ************************************************************************ */
@@ -628,6 +848,7 @@ void DefaultSimulation::draw(render::Context& context)
 
 void DefaultSimulation::updateModules()
 {
+    CECE_PROFILE_ZONE("sim.modules");
     auto _ = measure_time("sim.modules", TimeMeasurement(this));
     m_modules.update();
 }
@@ -636,6 +857,7 @@ void DefaultSimulation::updateModules()
 
 void DefaultSimulation::updateObjects()
 {
+    CECE_PROFILE_ZONE("sim.objects");
     auto _ = measure_time("sim.objects", TimeMeasurement(this));
 
     // Update simulations objects
@@ -645,12 +867,45 @@ void DefaultSimulation::updateObjects()
         auto obj = m_objects[i];
 
         CECE_ASSERT(obj);
+
+        // Measured at call site to include overridden update() of object types
+        ProfilerScope _("object:", Profiler::isEnabled() ? obj->getTypeName() : StringView{});
         obj->update(getTimeStep());
     }
 }
 
 /* ************************************************************************ */
 
+void DefaultSimulation::checkPhysicsFeatures() const
+{
+    const auto name = m_physics->getName();
+
+    if (!m_contactListeners.empty())
+        Log::warning("[simulation] Contact listeners are not notified with '", name, "' physics");
+
+    if (m_contactBuffer.isEnabled())
+        Log::warning("[simulation] Contact events are not recorded with '", name, "' physics");
+
+    bool bounds = false;
+    bool edges = false;
+
+    for (const auto& obj : m_objects)
+    {
+        bounds = bounds || !obj->getBoundObjects().empty();
+
+        for (const auto& shape : obj->getShapes())
+            edges = edges || shape.getType() == ShapeType::Edges;
+    }
+
+    if (bounds)
+        Log::warning("[simulation] Object bounds are ignored with '", name, "' physics");
+
+    if (edges)
+        Log::warning("[simulation] Edge shapes are approximated by bounding circles with '", name, "' physics");
+}
+
+/* ************************************************************************ */
+
 void DefaultSimulation::detectDeserters()
 {
     const auto hh = getWorldSize() * 0.5f;
@@ -42,6 +42,7 @@
 #include "cece/core/VectorUnits.hpp"
 #include "cece/core/String.hpp"
 #include "cece/core/Map.hpp"
+#include "cece/core/DynamicArray.hpp"
 #include "cece/core/UniquePtr.hpp"
 #include "cece/core/ViewPtr.hpp"
 #include "cece/core/FilePath.hpp"
@@ -51,9 +52,12 @@
 #include "cece/init/Container.hpp"
 #include "cece/module/Container.hpp"
 #include "cece/object/Container.hpp"
+#include "cece/object/ContactBuffer.hpp"
+#include "cece/object/StateSnapshot.hpp"
 #include "cece/object/TypeContainer.hpp"
 #include "cece/program/NamedContainer.hpp"
 #include "cece/simulator/Simulation.hpp"
+#include "cece/simulator/PhysicsBackend.hpp"
 
 #ifdef CECE_RENDER
 #include "cece/simulator/Visualization.hpp"
@@ -462,6 +466,28 @@ public:
     }
 
 
+    /**
+     * @brief Returns physics backend.
+     *
+     * @return
+     */
+    PhysicsBackend& getPhysicsBackend() noexcept
+    {
+        return *m_physics;
+    }
+
+
+    /**
+     * @brief Returns physics backend.
+     *
+     * @return
+     */
+    const PhysicsBackend& getPhysicsBackend() const noexcept
+    {
+        return *m_physics;
+    }
+
+
     /**
      * @brief Returns physics engine time step.
      *
@@ -478,6 +504,28 @@ public:
     units::Length getMaxObjectTranslation() const noexcept;
 
 
+    /**
+     * @brief Returns if objects create Box2D bodies.
+     *
+     * @return
+     */
+    bool usesBodies() const noexcept override
+    {
+        return m_physics->usesBodies();
+    }
+
+
+    /**
+     * @brief Returns buffer of contact events from the last physics step.
+     *
+     * @return
+     */
+    ViewPtr<object::ContactBuffer> getContactBuffer() noexcept override
+    {
+        return &m_contactBuffer;
+    }
+
+
 // Public Mutators
 public:
 
@@ -531,6 +579,20 @@ public:
     void setTimeStep(units::Time dt) override;
 
 
+    /**
+     * @brief Change physics backend.
+     *
+     * Objects created without bodies are not simulated by backend which
+     * uses bodies.
+     *
+     * @param backend Physics backend.
+     */
+    void setPhysicsBackend(UniquePtr<PhysicsBackend> backend) noexcept
+    {
+        m_physics = std::move(backend);
+    }
+
+
     /**
      * @brief Set simulation parameter.
      *
@@ -704,6 +766,22 @@ public:
     void setContactListener(object::ContactListener* listener) override;
 
 
+    /**
+     * @brief Add contact listener.
+     *
+     * @param listener Listener.
+     */
+    void addContactListener(object::ContactListener* listener) override;
+
+
+    /**
+     * @brief Remove contact listener.
+     *
+     * @param listener Listener.
+     */
+    void removeContactListener(object::ContactListener* listener) override;
+
+
 // Public Operations
 public:
 
@@ -780,6 +858,13 @@ protected:
     void updateObjects();
 
 
+    /**
+     * @brief Warn about features not simulated by physics backend without
+     * bodies.
+     */
+    void checkPhysicsFeatures() const;
+
+
     /**
      * @brief Detect objects that cannot be visible in the scene and can be
      * safely deleted.
@@ -833,6 +918,18 @@ private:
     class ContactListener;
     UniquePtr<ContactListener> m_contactListener;
 
+    /// Contact events from the last physics step.
+    object::ContactBuffer m_contactBuffer;
+
+    /// Registered contact listeners.
+    DynamicArray<object::ContactListener*> m_contactListeners;
+
+    /// Physics backend which moves objects.
+    UniquePtr<PhysicsBackend> m_physics;
+
+    /// Physics state of simulation objects, must outlive objects.
+    object::StateSnapshot m_stateSnapshot;
+
     /// Simulation objects.
     object::Container m_objects;
 
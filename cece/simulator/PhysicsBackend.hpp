@@ -0,0 +1,134 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// CeCe
+#include "cece/core/String.hpp"
+#include "cece/core/Units.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+    namespace config { class Configuration; }
+    namespace object { class Container; }
+    namespace object { class StateSnapshot; }
+}
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace simulator {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Physics backend which moves simulation objects.
+ *
+ * Objects keep their Box2D bodies as shape and mass storage, the backend
+ * decides how the bodies are moved in simulation step. Backend which
+ * doesn't need Box2D reports it by usesBodies() and objects created while
+ * it's active don't create bodies at all. Object state is
+ * exchanged through the state snapshot: pending object changes are stored
+ * in it before the step and the backend leaves new state in it after the
+ * step. Records of the snapshot match objects in the container.
+ */
+class PhysicsBackend
+{
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Destructor.
+     */
+    virtual ~PhysicsBackend() = 0;
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns backend name used in configuration.
+     *
+     * @return
+     */
+    virtual String getName() const = 0;
+
+
+    /**
+     * @brief Returns if objects need Box2D bodies.
+     *
+     * Without bodies there are no fixtures, joints and contact events.
+     *
+     * @return
+     */
+    virtual bool usesBodies() const noexcept
+    {
+        return true;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Load backend configuration.
+     *
+     * @param config Source configuration.
+     */
+    virtual void loadConfig(const config::Configuration& config);
+
+
+    /**
+     * @brief Store backend configuration.
+     *
+     * @param config Output configuration.
+     */
+    virtual void storeConfig(config::Configuration& config) const;
+
+
+    /**
+     * @brief Move objects by single simulation step.
+     *
+     * @param objects  Simulation objects.
+     * @param snapshot State snapshot of the objects.
+     * @param dt       Simulation time step.
+     */
+    virtual void step(object::Container& objects, object::StateSnapshot& snapshot, units::Time dt) = 0;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
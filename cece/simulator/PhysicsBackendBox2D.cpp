@@ -0,0 +1,57 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/simulator/PhysicsBackendBox2D.hpp"
+
+// Box2D
+#include <Box2D/Box2D.h>
+
+// CeCe
+#include "cece/object/StateSnapshot.hpp"
+#include "cece/simulator/ConverterBox2D.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace simulator {
+
+/* ************************************************************************ */
+
+void PhysicsBackendBox2D::step(object::Container& objects, object::StateSnapshot& snapshot, units::Time)
+{
+    // Write object changes into bodies, step and read new state back.
+    // Box2D uses engine time step, object velocities are scaled by converter.
+    snapshot.apply();
+    m_world.Step(static_cast<float32>(ConverterBox2D::getInstance().getTimeStepBox2D().value()), 10, 10);
+    snapshot.capture(objects);
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,112 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// CeCe
+#include "cece/simulator/PhysicsBackend.hpp"
+
+/* ************************************************************************ */
+
+class b2World;
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace simulator {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Physics backend stepping Box2D world.
+ *
+ * All shapes, joints and contacts are handled by Box2D.
+ */
+class PhysicsBackendBox2D : public PhysicsBackend
+{
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param world Box2D world.
+     */
+    explicit PhysicsBackendBox2D(b2World& world) noexcept
+        : m_world(world)
+    {
+        // Nothing to do
+    }
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns backend name used in configuration.
+     *
+     * @return
+     */
+    String getName() const override
+    {
+        return "box2d";
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Move objects by single simulation step.
+     *
+     * Box2D is stepped by physics engine time step.
+     *
+     * @param objects  Simulation objects.
+     * @param snapshot State snapshot of the objects.
+     * @param dt       Simulation time step.
+     */
+    void step(object::Container& objects, object::StateSnapshot& snapshot, units::Time dt) override;
+
+
+// Private Data Members
+private:
+
+    /// Box2D world.
+    b2World& m_world;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,236 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// Declaration
+#include "cece/simulator/PhysicsBackendParticles.hpp"
+
+// C++
+#include <algorithm>
+
+// Box2D
+#include <Box2D/Box2D.h>
+
+// CeCe
+#include "cece/core/Shape.hpp"
+#include "cece/core/UnitIo.hpp"
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/config/Configuration.hpp"
+#include "cece/object/Object.hpp"
+#include "cece/object/Container.hpp"
+#include "cece/object/StateSnapshot.hpp"
+#include "cece/simulator/ConverterBox2D.hpp"
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace simulator {
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns stiffness value of 1 N/m.
+ *
+ * @return
+ */
+RealType getStiffnessUnit() noexcept
+{
+    return (units::N(1) / units::m(1)).value();
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Returns radius of circle around origin containing all shapes.
+ *
+ * @param shapes Object shapes.
+ *
+ * @return
+ */
+units::Length getBoundingRadius(const DynamicArray<Shape>& shapes) noexcept
+{
+    units::Length radius = Zero;
+
+    for (const auto& shape : shapes)
+    {
+        switch (shape.getType())
+        {
+        case ShapeType::Circle:
+        {
+            const auto& circle = shape.getCircle();
+            radius = std::max(radius, circle.center.getLength() + circle.radius);
+            break;
+        }
+
+        case ShapeType::Rectangle:
+        {
+            const auto& rectangle = shape.getRectangle();
+            radius = std::max(radius, rectangle.center.getLength() + rectangle.size.getLength() / 2);
+            break;
+        }
+
+        case ShapeType::Edges:
+        {
+            const auto& edges = shape.getEdges();
+
+            for (const auto& edge : edges.edges)
+                radius = std::max(radius, (edges.center + edge).getLength());
+
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    return radius;
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+PhysicsBackendParticles::PhysicsBackendParticles(b2World& world) noexcept
+    : m_world(world)
+{
+    // Soft cells in water
+    m_solver.setStiffness(1e-6 * getStiffnessUnit());
+    m_solver.setViscosity(units::Pas(1e-3).value());
+}
+
+/* ************************************************************************ */
+
+void PhysicsBackendParticles::loadConfig(const config::Configuration& config)
+{
+    m_solver.setStiffness(config.get("particle-stiffness", m_solver.getStiffness() / getStiffnessUnit()) * getStiffnessUnit());
+    m_solver.setViscosity(config.get("particle-viscosity", units::DynamicViscosity(m_solver.getViscosity())).value());
+}
+
+/* ************************************************************************ */
+
+void PhysicsBackendParticles::storeConfig(config::Configuration& config) const
+{
+    config.set("particle-stiffness", m_solver.getStiffness() / getStiffnessUnit());
+    config.set("particle-viscosity", units::DynamicViscosity(m_solver.getViscosity()));
+}
+
+/* ************************************************************************ */
+
+void PhysicsBackendParticles::step(object::Container& objects, object::StateSnapshot& snapshot, units::Time dt)
+{
+    // Records must match objects
+    if (snapshot.getSize() != objects.getCount())
+    {
+        snapshot.apply();
+        snapshot.capture(objects);
+    }
+
+    const auto& converter = ConverterBox2D::getInstance();
+    const auto gravity = converter.convertLinearAcceleration(m_world.GetGravity());
+
+    m_solver.resize(objects.getCount());
+
+    auto& positions = m_solver.getPositions();
+    auto& velocities = m_solver.getVelocities();
+    auto& forces = m_solver.getForces();
+    auto& radii = m_solver.getRadii();
+    auto& inverseMasses = m_solver.getInverseMasses();
+
+    std::size_t index = 0;
+
+    for (auto& record : objects)
+    {
+        auto& obj = *record;
+        auto body = obj.getBody();
+
+        // Inactive body has no broadphase proxies and contacts, objects
+        // created with the backend active have no body
+        if (body && body->IsActive())
+            body->SetActive(false);
+
+        const auto position = snapshot.getPosition(index);
+        const auto mass = obj.getMass().value();
+
+        positions.set(index, {position.getX().value(), position.getY().value()});
+        radii[index] = getBoundingRadius(obj.getShapes()).value();
+
+        if (obj.getType() == object::Object::Type::Dynamic && mass > 0)
+        {
+            const auto velocity = snapshot.getVelocity(index);
+            const auto pending = snapshot.getForce(index);
+            const auto force = converter.convertForce(
+                b2Vec2(static_cast<float32>(pending.getX()), static_cast<float32>(pending.getY()))
+            );
+
+            inverseMasses[index] = 1 / mass;
+            velocities.set(index, {velocity.getX().value(), velocity.getY().value()});
+            forces.set(index, {
+                force.getX().value() + mass * gravity.getX().value(),
+                force.getY().value() + mass * gravity.getY().value()
+            });
+        }
+        else
+        {
+            inverseMasses[index] = 0;
+            velocities.set(index, Zero);
+            forces.set(index, Zero);
+        }
+
+        // Forces are consumed here, they must not accumulate in bodies
+        snapshot.clearForce(index);
+        ++index;
+    }
+
+    m_solver.step(dt.value());
+
+    for (index = 0; index < m_solver.getCount(); ++index)
+    {
+        if (inverseMasses[index] <= 0)
+            continue;
+
+        const auto position = positions[index];
+        const auto velocity = velocities[index];
+
+        snapshot.setPosition(index, {units::Length(position.getX()), units::Length(position.getY())});
+        snapshot.setVelocity(index, {units::Velocity(velocity.getX()), units::Velocity(velocity.getY())});
+    }
+
+    // Bodies keep state for rendering and direct queries
+    snapshot.apply();
+}
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
@@ -0,0 +1,169 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+#pragma once
+
+/* ************************************************************************ */
+
+// CeCe
+#include "cece/core/ParticleSolver.hpp"
+#include "cece/simulator/PhysicsBackend.hpp"
+
+/* ************************************************************************ */
+
+class b2World;
+
+/* ************************************************************************ */
+
+namespace cece {
+namespace simulator {
+
+/* ************************************************************************ */
+
+/**
+ * @brief Lightweight physics backend for scenes of simple cells.
+ *
+ * Each object is a circle given by bounding circle of its shapes around
+ * body origin. Overlapping objects repulse and moving objects are slowed
+ * by Stokes drag, see ParticleSolver. Rotations, joints and contact events
+ * are not simulated. Only dynamic objects move, static and pinned ones are
+ * obstacles.
+ *
+ * Objects created with the backend active have no Box2D bodies. Bodies of
+ * objects created before are deactivated so Box2D doesn't keep broadphase
+ * proxies and contacts for them. Gravity is taken from Box2D world.
+ */
+class PhysicsBackendParticles : public PhysicsBackend
+{
+
+// Public Ctors & Dtors
+public:
+
+
+    /**
+     * @brief Constructor.
+     *
+     * @param world Box2D world.
+     */
+    explicit PhysicsBackendParticles(b2World& world) noexcept;
+
+
+// Public Accessors
+public:
+
+
+    /**
+     * @brief Returns backend name used in configuration.
+     *
+     * @return
+     */
+    String getName() const override
+    {
+        return "particles";
+    }
+
+
+    /**
+     * @brief Returns if objects need Box2D bodies.
+     *
+     * @return
+     */
+    bool usesBodies() const noexcept override
+    {
+        return false;
+    }
+
+
+    /**
+     * @brief Returns particle solver.
+     *
+     * Solver values are SI values of simulation units.
+     *
+     * @return
+     */
+    ParticleSolver& getSolver() noexcept
+    {
+        return m_solver;
+    }
+
+
+    /**
+     * @brief Returns particle solver.
+     *
+     * @return
+     */
+    const ParticleSolver& getSolver() const noexcept
+    {
+        return m_solver;
+    }
+
+
+// Public Operations
+public:
+
+
+    /**
+     * @brief Load backend configuration.
+     *
+     * @param config Source configuration.
+     */
+    void loadConfig(const config::Configuration& config) override;
+
+
+    /**
+     * @brief Store backend configuration.
+     *
+     * @param config Output configuration.
+     */
+    void storeConfig(config::Configuration& config) const override;
+
+
+    /**
+     * @brief Move objects by single simulation step.
+     *
+     * @param objects  Simulation objects.
+     * @param snapshot State snapshot of the objects.
+     * @param dt       Simulation time step.
+     */
+    void step(object::Container& objects, object::StateSnapshot& snapshot, units::Time dt) override;
+
+
+// Private Data Members
+private:
+
+    /// Box2D world.
+    b2World& m_world;
+
+    /// Particle solver.
+    ParticleSolver m_solver;
+
+};
+
+/* ************************************************************************ */
+
+}
+}
+
+/* ************************************************************************ */
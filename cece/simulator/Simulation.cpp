@@ -215,6 +215,20 @@ ViewPtr<program::Program> Simulation::createProgram(const config::Configuration&
 
 /* ************************************************************************ */
 
+bool Simulation::usesBodies() const noexcept
+{
+    return true;
+}
+
+/* ************************************************************************ */
+
+ViewPtr<object::ContactBuffer> Simulation::getContactBuffer() noexcept
+{
+    return nullptr;
+}
+
+/* ************************************************************************ */
+
 void Simulation::setContactListener(object::ContactListener* listener)
 {
     // Nothing to do
@@ -222,6 +236,20 @@ void Simulation::setContactListener(object::ContactListener* listener)
 
 /* ************************************************************************ */
 
+void Simulation::addContactListener(object::ContactListener* listener)
+{
+    // Nothing to do
+}
+
+/* ************************************************************************ */
+
+void Simulation::removeContactListener(object::ContactListener* listener)
+{
+    // Nothing to do
+}
+
+/* ************************************************************************ */
+
 void Simulation::loadConfig(const config::Configuration& config)
 {
     setWorldSize(config.get<units::SizeVector>("world-size"));
@@ -56,6 +56,7 @@ namespace cece {
     namespace module { class Module; }
     //namespace object { class Object; }
     namespace object { class ContactListener; }
+    namespace object { class ContactBuffer; }
     namespace object { class Type; }
     namespace program { class Program; }
 
@@ -410,6 +411,17 @@ public:
     virtual const b2World& getWorld() const noexcept = 0;
 
 
+    /**
+     * @brief Returns if objects create Box2D bodies.
+     *
+     * Objects created when it returns false keep their state without body
+     * and getBody() returns nullptr.
+     *
+     * @return
+     */
+    virtual bool usesBodies() const noexcept;
+
+
     /**
      * @brief Returns maximum translation vector magnitude per iteration.
      *
@@ -419,6 +431,16 @@ public:
     virtual units::Length getMaxObjectTranslation() const noexcept = 0;
 
 
+    /**
+     * @brief Returns contact events of the last physics step.
+     *
+     * Events are recorded only while the buffer has a registered consumer.
+     *
+     * @return Contact buffer or nullptr when simulation doesn't support it.
+     */
+    virtual ViewPtr<object::ContactBuffer> getContactBuffer() noexcept;
+
+
 // Public Mutators
 public:
 
@@ -716,11 +738,32 @@ public:
     /**
      * @brief Register contact listener.
      *
-     * @param listener New listener.
+     * Replaces all registered listeners.
+     *
+     * @param listener New listener, nullptr removes all listeners.
      */
     virtual void setContactListener(object::ContactListener* listener);
 
 
+    /**
+     * @brief Add contact listener.
+     *
+     * Listeners are notified after physics step about every contact that
+     * began in the step. Contact buffer type filters don't apply to them.
+     *
+     * @param listener Listener.
+     */
+    virtual void addContactListener(object::ContactListener* listener);
+
+
+    /**
+     * @brief Remove contact listener.
+     *
+     * @param listener Listener.
+     */
+    virtual void removeContactListener(object::ContactListener* listener);
+
+
 // Public Operations
 public:
 
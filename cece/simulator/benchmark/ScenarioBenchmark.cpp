@@ -0,0 +1,249 @@
+/* ************************************************************************ */
+/* Georgiev Lab (c) 2015-2016                                               */
+/* ************************************************************************ */
+/* Department of Cybernetics                                                */
+/* Faculty of Applied Sciences                                              */
+/* University of West Bohemia in Pilsen                                     */
+/* ************************************************************************ */
+/*                                                                          */
+/* This file is part of CeCe.                                               */
+/*                                                                          */
+/* CeCe is free software: you can redistribute it and/or modify             */
+/* it under the terms of the GNU General Public License as published by     */
+/* the Free Software Foundation, either version 3 of the License, or        */
+/* (at your option) any later version.                                      */
+/*                                                                          */
+/* CeCe is distributed in the hope that it will be useful,                  */
+/* but WITHOUT ANY WARRANTY; without even the implied warranty of           */
+/* MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the            */
+/* GNU General Public License for more details.                             */
+/*                                                                          */
+/* You should have received a copy of the GNU General Public License        */
+/* along with CeCe.  If not, see <http://www.gnu.org/licenses/>.            */
+/*                                                                          */
+/* ************************************************************************ */
+
+// C++
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+// Google Benchmark
+#include <benchmark/benchmark.h>
+
+// CeCe
+#include "cece/core/Units.hpp"
+#include "cece/core/UnitsCtors.hpp"
+#include "cece/core/Vector.hpp"
+#include "cece/core/VectorUnits.hpp"
+#include "cece/core/Shape.hpp"
+#include "cece/core/DynamicArray.hpp"
+#include "cece/core/UniquePtr.hpp"
+#include "cece/core/ViewPtr.hpp"
+#include "cece/core/Atomic.hpp"
+#include "cece/core/Profiler.hpp"
+#include "cece/plugin/Manager.hpp"
+#include "cece/module/Module.hpp"
+#include "cece/object/Object.hpp"
+#include "cece/object/BoundData.hpp"
+#include "cece/simulator/DefaultSimulation.hpp"
+#include "cece/simulator/PhysicsBackendParticles.hpp"
+
+/* ************************************************************************ */
+
+using namespace cece;
+
+/* ************************************************************************ */
+
+namespace {
+
+/* ************************************************************************ */
+
+/// Number of simulation steps measured in each scenario.
+constexpr int STEPS = 20;
+
+/* ************************************************************************ */
+
+/// World area per object, it keeps the object density same for all scenarios.
+constexpr RealType AREA_PER_OBJECT = 100; // um2
+
+/* ************************************************************************ */
+
+/**
+ * @brief Module which touches all objects like a typical physics-affecting
+ * module (e.g. streamlines) does.
+ */
+class ForceModule : public module::Module
+{
+public:
+
+    using module::Module::Module;
+
+    void update() override
+    {
+        const units::ForceVector force{units::N(1e-12), units::N(-1e-12)};
+
+        for (auto& object : getSimulation().getObjects())
+            object->applyForce(force);
+    }
+};
+
+/* ************************************************************************ */
+
+/**
+ * @brief Build simulation in code without any plugins.
+ *
+ * @param simulation
+ * @param objects    Number of dynamic objects.
+ * @param modules    Number of modules.
+ * @param bounds     Number of bounds between neighbouring objects.
+ */
+void build(simulator::DefaultSimulation& simulation, int objects, int modules, int bounds)
+{
+    const auto side = units::um(std::sqrt(AREA_PER_OBJECT * objects));
+
+    simulation.setWorldSize({side, side});
+    simulation.setTimeStep(units::ms(10));
+    simulation.setIterations(0);
+
+    for (int i = 0; i < modules; ++i)
+        simulation.addModule("force" + toString(i), makeUnique<ForceModule>(simulation));
+
+    // Objects are placed randomly with fixed seed to have same scenario in
+    // each run
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<RealType> position(-0.45, 0.45);
+    std::uniform_real_distribution<RealType> velocity(-10, 10);
+
+    DynamicArray<ViewPtr<object::Object>> created;
+    created.reserve(objects);
+
+    for (int i = 0; i < objects; ++i)
+    {
+        auto object = simulation.addObject(makeUnique<object::Object>(
+            simulation, "scenario.Object", object::Object::Type::Dynamic
+        ));
+
+        object->setShapes({Shape::makeCircle(units::um(1))});
+        object->initShapes();
+        object->setPosition({side * position(gen), side * position(gen)});
+        object->setVelocity({units::um_s(velocity(gen)), units::um_s(velocity(gen))});
+
+        created.push_back(object);
+    }
+
+    for (int i = 0; i < bounds && i + 1 < objects; ++i)
+        created[i]->createBound(*created[i + 1]);
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Measure simulation steps of scenario.
+ *
+ * Besides the step time, time of each simulation phase per step is reported
+ * in milliseconds.
+ *
+ * @param state     Benchmark state.
+ * @param bounds    Number of bounds.
+ * @param particles If particle physics is used instead of Box2D.
+ */
+void measure(benchmark::State& state, int bounds, bool particles)
+{
+    plugin::Manager manager;
+    simulator::DefaultSimulation simulation(manager.getRepository());
+
+    // Backend must be set before objects are created
+    if (particles)
+        simulation.setPhysicsBackend(makeUnique<simulator::PhysicsBackendParticles>(simulation.getWorld()));
+
+    build(simulation,
+        static_cast<int>(state.range(0)),
+        static_cast<int>(state.range(1)),
+        bounds
+    );
+
+    AtomicBool flag{true};
+    simulation.initialize(flag);
+
+    Profiler::reset();
+    Profiler::setEnabled(true);
+
+    for (auto _ : state)
+        simulation.update();
+
+    Profiler::setEnabled(false);
+
+    const auto stats = Profiler::getStats();
+    const auto steps = static_cast<double>(state.iterations());
+
+    for (const char* name : {"sim.modules", "sim.objects", "sim.physics"})
+    {
+        const auto& zone = stats[Profiler::registerZone(name)];
+
+        // Each phase is entered once per step, lost calls would make the
+        // counters meaningless
+        if (zone.calls != static_cast<std::uint64_t>(state.iterations()))
+        {
+            state.SkipWithError("Profiler lost zone calls");
+            break;
+        }
+
+        state.counters[name] = std::chrono::duration<double, std::milli>(zone.total).count() / steps;
+    }
+
+    state.counters["steps"] = benchmark::Counter(steps, benchmark::Counter::kIsRate);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+    simulation.terminate();
+    Profiler::reset();
+}
+
+/* ************************************************************************ */
+
+}
+
+/* ************************************************************************ */
+
+/**
+ * @brief Measure simulation steps of scenario given by number of objects,
+ * modules and bounds.
+ */
+static void Scenario(benchmark::State& state)
+{
+    measure(state, static_cast<int>(state.range(2)), false);
+}
+
+BENCHMARK(Scenario)
+    ->ArgNames({"objects", "modules", "bounds"})
+    ->Args({1000, 1, 0})
+    ->Args({1000, 4, 100})
+    ->Args({10000, 1, 0})
+    ->Args({10000, 4, 1000})
+    ->Args({100000, 1, 0})
+    ->Args({100000, 4, 10000})
+    ->Args({1000000, 1, 0})
+    ->Iterations(STEPS)
+    ->Unit(benchmark::kMillisecond);
+
+/* ************************************************************************ */
+
+/**
+ * @brief Measure simulation steps of scenario given by number of objects and
+ * modules with particle physics.
+ */
+static void ScenarioParticles(benchmark::State& state)
+{
+    measure(state, 0, true);
+}
+
+BENCHMARK(ScenarioParticles)
+    ->ArgNames({"objects", "modules"})
+    ->Args({1000, 1})
+    ->Args({10000, 1})
+    ->Args({100000, 1})
+    ->Args({1000000, 1})
+    ->Iterations(STEPS)
+    ->Unit(benchmark::kMillisecond);
+
+/* ************************************************************************ */